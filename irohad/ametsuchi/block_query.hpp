@@ -20,7 +20,9 @@
 
 #include <boost/optional.hpp>
 #include <cmath>
+#include <memory>
 #include <rxcpp/rx-observable.hpp>
+#include <utility>
 
 #include "common/types.hpp"
 
@@ -29,9 +31,30 @@ namespace iroha {
   namespace model {
     struct Transaction;
     struct Block;
+    struct TxCursor;
+    struct Pager;
+  }
+
+  namespace protocol {
+    class Block;
   }
 
   namespace ametsuchi {
+    /**
+     * Transaction along with its position in the ledger
+     */
+    using TransactionWithCursor =
+        std::pair<model::TxCursor, model::Transaction>;
+
+    /**
+     * Serialized block, which memory is kept while holder exists
+     */
+    struct RawBlock {
+      const uint8_t *data;
+      size_t size;
+      std::shared_ptr<const void> holder;
+    };
+
     /**
      * Public interface for queries on blocks and transactions
      */
@@ -46,6 +69,16 @@ namespace iroha {
       virtual rxcpp::observable<model::Transaction> getAccountTransactions(
           const std::string &account_id) = 0;
 
+      /**
+       * Get a page of transactions of an account.
+       * @param account_id - account_id (accountName@domainName)
+       * @param pager - cursor and size of the page
+       * @return observable of Model Transaction with its position, ordered
+       * by position in the ledger
+       */
+      virtual rxcpp::observable<TransactionWithCursor> getAccountTransactions(
+          const std::string &account_id, const model::Pager &pager) = 0;
+
       /**
        * Get asset transactions of an account.
        * @param account_id - account_id (accountName@domainName)
@@ -55,6 +88,19 @@ namespace iroha {
       virtual rxcpp::observable<model::Transaction> getAccountAssetTransactions(
           const std::string &account_id, const std::string &asset_id) = 0;
 
+      /**
+       * Get a page of asset transactions of an account.
+       * @param account_id - account_id (accountName@domainName)
+       * @param asset_id - asset_id (assetName#domainName)
+       * @param pager - cursor and size of the page
+       * @return observable of Model Transaction with its position, ordered
+       * by position in the ledger
+       */
+      virtual rxcpp::observable<TransactionWithCursor>
+      getAccountAssetTransactions(const std::string &account_id,
+                                  const std::string &asset_id,
+                                  const model::Pager &pager) = 0;
+
       /**
        * Get transactions from transactions' hashes
        * @param tx_hashes - transactions' hashes to retrieve
@@ -80,6 +126,14 @@ namespace iroha {
       virtual rxcpp::observable<model::Block> getBlocksFrom(
           uint32_t height) = 0;
 
+      /**
+       * Synchronously gets serialized protobuf block as it is kept in block
+       * store, without parsing it
+       * @param height - height of block
+       * @return block bytes or boost::none
+       */
+      virtual boost::optional<RawBlock> getRawBlock(uint32_t height) = 0;
+
       /**
        * Get given number of blocks from top.
        * @param count - number of blocks to retrieve
@@ -87,6 +141,14 @@ namespace iroha {
        */
       virtual rxcpp::observable<model::Block> getTopBlocks(uint32_t count) = 0;
 
+      /**
+       * Synchronously gets block in protobuf representation by its hash
+       * @param hash - hash of block payload
+       * @return block or boost::none
+       */
+      virtual boost::optional<protocol::Block> getProtoBlockByHashSync(
+          const hash256_t &hash) = 0;
+
       /**
        * Synchronously gets transaction by its hash
        * @param hash - hash to search
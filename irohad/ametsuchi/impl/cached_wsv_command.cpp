@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/cached_wsv_command.hpp"
+
+#include "ametsuchi/impl/cached_wsv_query.hpp"
+#include "model/account.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    CachedWsvCommand::CachedWsvCommand(std::unique_ptr<WsvCommand> command,
+                                       CachedWsvQuery &query)
+        : command_(std::move(command)), query_(query) {}
+
+    WsvCommandResult CachedWsvCommand::insertRole(const std::string &role_name) {
+      return command_->insertRole(role_name);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertAccountRole(
+        const std::string &account_id, const std::string &role_name) {
+      query_.overlayAccountRoles(account_id);
+      return command_->insertAccountRole(account_id, role_name);
+    }
+
+    WsvCommandResult CachedWsvCommand::deleteAccountRole(
+        const std::string &account_id, const std::string &role_name) {
+      query_.overlayAccountRoles(account_id);
+      return command_->deleteAccountRole(account_id, role_name);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertRolePermissions(
+        const std::string &role_id, const std::set<std::string> &permissions) {
+      query_.overlayRolePermissions(role_id);
+      return command_->insertRolePermissions(role_id, permissions);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertAccount(
+        const model::Account &account) {
+      query_.overlayAccount(account.account_id);
+      return command_->insertAccount(account);
+    }
+
+    WsvCommandResult CachedWsvCommand::updateAccount(
+        const model::Account &account) {
+      query_.overlayAccount(account.account_id);
+      return command_->updateAccount(account);
+    }
+
+    WsvCommandResult CachedWsvCommand::setAccountKV(
+        const std::string &account_id,
+        const std::string &creator_account_id,
+        const std::string &key,
+        const std::string &val) {
+      query_.overlayAccount(account_id);
+      return command_->setAccountKV(account_id, creator_account_id, key, val);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertAsset(const model::Asset &asset) {
+      return command_->insertAsset(asset);
+    }
+
+    WsvCommandResult CachedWsvCommand::upsertAccountAsset(
+        const model::AccountAsset &asset) {
+      return command_->upsertAccountAsset(asset);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertSignatory(
+        const pubkey_t &signatory) {
+      return command_->insertSignatory(signatory);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertAccountSignatory(
+        const std::string &account_id, const pubkey_t &signatory) {
+      return command_->insertAccountSignatory(account_id, signatory);
+    }
+
+    WsvCommandResult CachedWsvCommand::deleteAccountSignatory(
+        const std::string &account_id, const pubkey_t &signatory) {
+      return command_->deleteAccountSignatory(account_id, signatory);
+    }
+
+    WsvCommandResult CachedWsvCommand::deleteSignatory(
+        const pubkey_t &signatory) {
+      return command_->deleteSignatory(signatory);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertPeer(const model::Peer &peer) {
+      return command_->insertPeer(peer);
+    }
+
+    WsvCommandResult CachedWsvCommand::deletePeer(const model::Peer &peer) {
+      return command_->deletePeer(peer);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertDomain(
+        const model::Domain &domain) {
+      return command_->insertDomain(domain);
+    }
+
+    WsvCommandResult CachedWsvCommand::insertAccountGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      return command_->insertAccountGrantablePermission(
+          permittee_account_id, account_id, permission_id);
+    }
+
+    WsvCommandResult CachedWsvCommand::deleteAccountGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      return command_->deleteAccountGrantablePermission(
+          permittee_account_id, account_id, permission_id);
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
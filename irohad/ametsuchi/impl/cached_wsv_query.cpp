@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/cached_wsv_query.hpp"
+
+#include "model/account_asset.hpp"
+#include "model/asset.hpp"
+#include "model/domain.hpp"
+#include "model/peer.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    CachedWsvQuery::CachedWsvQuery(std::unique_ptr<WsvQuery> wsv,
+                                   std::shared_ptr<WsvCache> cache)
+        : wsv_(std::move(wsv)), cache_(std::move(cache)) {}
+
+    template <typename Lookup, typename Load, typename Store>
+    auto CachedWsvQuery::readThrough(
+        const std::unordered_set<std::string> &overlay,
+        const std::string &key,
+        Lookup &&lookup,
+        Load &&load,
+        Store &&store) -> decltype(load()) {
+      if (overlay.count(key) != 0) {
+        return load();
+      }
+      if (auto cached = lookup()) {
+        return cached;
+      }
+      // version is taken before loading, so value loaded before commit is
+      // not stored after invalidation
+      auto version = cache_->version();
+      auto loaded = load();
+      if (loaded) {
+        store(version, *loaded);
+      }
+      return loaded;
+    }
+
+    nonstd::optional<std::vector<std::string>>
+    CachedWsvQuery::getAccountRoles(const std::string &account_id) {
+      return readThrough(
+          account_roles_overlay_,
+          account_id,
+          [&] { return cache_->getAccountRoles(account_id); },
+          [&] { return wsv_->getAccountRoles(account_id); },
+          [&](auto version, const auto &roles) {
+            cache_->putAccountRoles(version, account_id, roles);
+          });
+    }
+
+    nonstd::optional<std::vector<std::string>>
+    CachedWsvQuery::getRolePermissions(const std::string &role_name) {
+      return readThrough(
+          role_permissions_overlay_,
+          role_name,
+          [&] { return cache_->getRolePermissions(role_name); },
+          [&] { return wsv_->getRolePermissions(role_name); },
+          [&](auto version, const auto &permissions) {
+            cache_->putRolePermissions(version, role_name, permissions);
+          });
+    }
+
+    nonstd::optional<model::Account> CachedWsvQuery::getAccount(
+        const std::string &account_id) {
+      return readThrough(
+          accounts_overlay_,
+          account_id,
+          [&] { return cache_->getAccount(account_id); },
+          [&] { return wsv_->getAccount(account_id); },
+          [&](auto version, const auto &account) {
+            cache_->putAccount(version, account);
+          });
+    }
+
+    nonstd::optional<std::string> CachedWsvQuery::getAccountDetail(
+        const std::string &account_id,
+        const std::string &creator_account_id,
+        const std::string &detail) {
+      return wsv_->getAccountDetail(account_id, creator_account_id, detail);
+    }
+
+    nonstd::optional<std::vector<pubkey_t>> CachedWsvQuery::getSignatories(
+        const std::string &account_id) {
+      return wsv_->getSignatories(account_id);
+    }
+
+    nonstd::optional<model::Asset> CachedWsvQuery::getAsset(
+        const std::string &asset_id) {
+      return wsv_->getAsset(asset_id);
+    }
+
+    nonstd::optional<model::AccountAsset> CachedWsvQuery::getAccountAsset(
+        const std::string &account_id, const std::string &asset_id) {
+      return wsv_->getAccountAsset(account_id, asset_id);
+    }
+
+    nonstd::optional<std::vector<model::Peer>> CachedWsvQuery::getPeers() {
+      return wsv_->getPeers();
+    }
+
+    nonstd::optional<std::vector<std::string>> CachedWsvQuery::getRoles() {
+      return wsv_->getRoles();
+    }
+
+    nonstd::optional<model::Domain> CachedWsvQuery::getDomain(
+        const std::string &domain_id) {
+      return wsv_->getDomain(domain_id);
+    }
+
+    bool CachedWsvQuery::hasAccountGrantablePermission(
+        const std::string &permitee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      return wsv_->hasAccountGrantablePermission(
+          permitee_account_id, account_id, permission_id);
+    }
+
+    void CachedWsvQuery::overlayAccountRoles(const std::string &account_id) {
+      account_roles_overlay_.insert(account_id);
+    }
+
+    void CachedWsvQuery::overlayRolePermissions(const std::string &role_name) {
+      role_permissions_overlay_.insert(role_name);
+    }
+
+    void CachedWsvQuery::overlayAccount(const std::string &account_id) {
+      accounts_overlay_.insert(account_id);
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_CACHED_WSV_QUERY_HPP
+#define IROHA_CACHED_WSV_QUERY_HPP
+
+#include "ametsuchi/wsv_query.hpp"
+
+#include <memory>
+#include <unordered_set>
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * World state view query, which reads accounts, account roles and role
+     * permissions through shared cache of committed state.
+     * Keys modified in the current transaction are kept in the overlay, and
+     * are always read from the underlying query, which sees uncommitted
+     * changes
+     */
+    class CachedWsvQuery : public WsvQuery {
+     public:
+      CachedWsvQuery(std::unique_ptr<WsvQuery> wsv,
+                     std::shared_ptr<WsvCache> cache);
+
+      nonstd::optional<std::vector<std::string>> getAccountRoles(
+          const std::string &account_id) override;
+
+      nonstd::optional<std::vector<std::string>> getRolePermissions(
+          const std::string &role_name) override;
+
+      nonstd::optional<model::Account> getAccount(
+          const std::string &account_id) override;
+      nonstd::optional<std::string> getAccountDetail(
+          const std::string &account_id,
+          const std::string &creator_account_id,
+          const std::string &detail) override;
+      nonstd::optional<std::vector<pubkey_t>> getSignatories(
+          const std::string &account_id) override;
+      nonstd::optional<model::Asset> getAsset(
+          const std::string &asset_id) override;
+      nonstd::optional<model::AccountAsset> getAccountAsset(
+          const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::Peer>> getPeers() override;
+      nonstd::optional<std::vector<std::string>> getRoles() override;
+      nonstd::optional<model::Domain> getDomain(
+          const std::string &domain_id) override;
+      bool hasAccountGrantablePermission(
+          const std::string &permitee_account_id,
+          const std::string &account_id,
+          const std::string &permission_id) override;
+
+      /**
+       * Bypass cache for roles of account, modified in current transaction
+       */
+      void overlayAccountRoles(const std::string &account_id);
+
+      /**
+       * Bypass cache for permissions of role, modified in current transaction
+       */
+      void overlayRolePermissions(const std::string &role_name);
+
+      /**
+       * Bypass cache for account, modified in current transaction
+       */
+      void overlayAccount(const std::string &account_id);
+
+     private:
+      /**
+       * Read value from cache, or load and store it in cache on miss
+       * @param overlay - keys, which are not read from cache
+       * @param key of value
+       * @param lookup - function which reads value from cache
+       * @param load - function which reads value from underlying query
+       * @param store - function which stores loaded value in cache
+       */
+      template <typename Lookup, typename Load, typename Store>
+      auto readThrough(const std::unordered_set<std::string> &overlay,
+                       const std::string &key,
+                       Lookup &&lookup,
+                       Load &&load,
+                       Store &&store) -> decltype(load());
+
+      std::unique_ptr<WsvQuery> wsv_;
+      std::shared_ptr<WsvCache> cache_;
+
+      std::unordered_set<std::string> account_roles_overlay_;
+      std::unordered_set<std::string> role_permissions_overlay_;
+      std::unordered_set<std::string> accounts_overlay_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_CACHED_WSV_QUERY_HPP
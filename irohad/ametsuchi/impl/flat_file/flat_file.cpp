@@ -14,19 +14,103 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <boost/crc.hpp>
+#include <algorithm>
 #include <boost/filesystem.hpp>
-#include <boost/range/adaptor/indexed.hpp>
-#include <boost/range/algorithm/find_if.hpp>
+#include <cstring>
 #include <iomanip>
-#include <iostream>
 #include <sstream>
 #include "common/files.hpp"
 
 using namespace iroha::ametsuchi;
 using Identifier = FlatFile::Identifier;
 
+namespace {
+  const char *kDataExtension = ".data";
+  const char *kIndexExtension = ".index";
+  const char *kCopyExtension = ".copy";
+
+  /**
+   * Size of chunks in which segment data is copied
+   */
+  const size_t kCopyChunkSize = 1024 * 1024;
+
+  /**
+   * Each entry in data file is prefixed with its size and checksum
+   */
+  const size_t kHeaderSize = 2 * sizeof(uint32_t);
+  const size_t kOffsetSize = sizeof(uint64_t);
+
+  uint32_t checksum(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  bool readAt(int fd, void *buf, size_t size, uint64_t offset) {
+    auto ptr = static_cast<char *>(buf);
+    while (size > 0) {
+      auto res = ::pread(fd, ptr, size, offset);
+      if (res <= 0) {
+        return false;
+      }
+      ptr += res;
+      size -= res;
+      offset += res;
+    }
+    return true;
+  }
+
+  bool writeAt(int fd, const void *buf, size_t size, uint64_t offset) {
+    auto ptr = static_cast<const char *>(buf);
+    while (size > 0) {
+      auto res = ::pwrite(fd, ptr, size, offset);
+      if (res <= 0) {
+        return false;
+      }
+      ptr += res;
+      size -= res;
+      offset += res;
+    }
+    return true;
+  }
+
+  /**
+   * Read entry stored in data file by offset
+   * @param fd - data file descriptor
+   * @param offset - offset of entry header
+   * @param limit - size of data file
+   * @return entry if it is complete and not corrupted
+   */
+  nonstd::optional<std::vector<uint8_t>> readEntry(int fd,
+                                                   uint64_t offset,
+                                                   uint64_t limit) {
+    uint32_t header[2];
+    if (offset + kHeaderSize > limit
+        or not readAt(fd, header, kHeaderSize, offset)
+        or offset + kHeaderSize + header[0] > limit) {
+      return nonstd::nullopt;
+    }
+    std::vector<uint8_t> entry(header[0]);
+    if (not readAt(fd, entry.data(), entry.size(), offset + kHeaderSize)
+        or checksum(entry.data(), entry.size()) != header[1]) {
+      return nonstd::nullopt;
+    }
+    return entry;
+  }
+
+  boost::filesystem::path segmentPath(const std::string &dump_dir,
+                                      Identifier first_id,
+                                      const char *extension) {
+    return boost::filesystem::path{dump_dir}
+    / (FlatFile::id_to_name(first_id) + extension);
+  }
+}  // namespace
+
 // ----------| public API |----------
 
 std::string FlatFile::id_to_name(Identifier id) {
@@ -36,7 +120,7 @@ std::string FlatFile::id_to_name(Identifier id) {
 }
 
 nonstd::optional<std::unique_ptr<FlatFile>> FlatFile::create(
-    const std::string &path) {
+    const std::string &path, uint64_t segment_size) {
   auto log_ = logger::log("FlatFile::create()");
 
   boost::system::error_code err;
@@ -46,62 +130,158 @@ nonstd::optional<std::unique_ptr<FlatFile>> FlatFile::create(
     return nonstd::nullopt;
   }
 
-  auto res = FlatFile::check_consistency(path);
-  return std::make_unique<FlatFile>(*res, path, private_tag{});
+  auto segments = FlatFile::recover(path);
+  if (not segments) {
+    return nonstd::nullopt;
+  }
+  Identifier last_id = segments->empty()
+      ? 0
+      : segments->back().first_id + segments->back().offsets.size() - 1;
+  return std::make_unique<FlatFile>(
+      last_id, path, segment_size, std::move(*segments), private_tag{});
 }
 
 bool FlatFile::add(Identifier id, const std::vector<uint8_t> &block) {
   // TODO(x3medima17): Change bool to generic Result return type
 
+  std::unique_lock<std::shared_timed_mutex> write(segments_lock_);
   if (id != current_id_ + 1) {
     log_->warn("Cannot append non-consecutive block");
     return false;
   }
 
-  auto next_id = id;
-  const auto file_name = boost::filesystem::path{dump_dir_} / id_to_name(id);
-
-  // Write block to binary file
-  if (boost::filesystem::exists(file_name)) {
-    // File already exist
-    log_->warn("insertion for {} failed, because file already exists", id);
-    return false;
-  }
-  // New file will be created
-  boost::filesystem::ofstream file(file_name.native(), std::ofstream::binary);
-  if (not file.is_open()) {
-    log_->warn("Cannot open file by index {} for writing", id);
-    return false;
+  if (segments_.empty() or segments_.back().sealed
+      or segments_.back().size >= segment_size_) {
+    if (not startSegment(id)) {
+      return false;
+    }
   }
+  auto &segment = segments_.back();
 
-  auto val_size =
-      sizeof(std::remove_reference<decltype(block)>::type::value_type);
+  std::vector<uint8_t> entry(kHeaderSize + block.size());
+  uint32_t header[2] = {static_cast<uint32_t>(block.size()),
+                        checksum(block.data(), block.size())};
+  std::memcpy(entry.data(), header, kHeaderSize);
+  std::copy(block.begin(), block.end(), entry.begin() + kHeaderSize);
 
-  file.write(reinterpret_cast<const char *>(block.data()),
-             block.size() * val_size);
+  // Entry is visible only after its offset reaches the index, so a failure
+  // between two writes leaves a tail which is truncated on recovery
+  uint64_t offset = segment.size;
+  uint64_t index_offset = segment.offsets.size() * kOffsetSize;
+  if (not writeAt(segment.data_fd, entry.data(), entry.size(), offset)
+      or not writeAt(segment.index_fd, &offset, kOffsetSize, index_offset)) {
+    log_->warn("Cannot write block {} to segment {}", id, segment.first_id);
+    if (::ftruncate(segment.data_fd, offset) != 0
+        or ::ftruncate(segment.index_fd, index_offset) != 0) {
+      log_->error("Cannot revert partially written block {}", id);
+    }
+    return false;
+  }
 
-  // Update internals, release lock
-  current_id_ = next_id;
+  segment.offsets.push_back(offset);
+  segment.size += entry.size();
+  current_id_ = id;
   return true;
 }
 
 nonstd::optional<std::vector<uint8_t>> FlatFile::get(Identifier id) const {
-  const auto filename =
-      boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id);
-  if (not boost::filesystem::exists(filename)) {
-    log_->info("get({}) file not found", id);
+  std::shared_lock<std::shared_timed_mutex> read(segments_lock_);
+  if (id == 0 or id > current_id_) {
+    log_->info("get({}) block not found", id);
+    return nonstd::nullopt;
+  }
+
+  auto segment = std::upper_bound(
+      segments_.begin(),
+      segments_.end(),
+      id,
+      [](Identifier id, const auto &segment) { return id < segment.first_id; });
+  --segment;
+
+  auto entry = readEntry(segment->data_fd,
+                         segment->offsets.at(id - segment->first_id),
+                         segment->size);
+  if (not entry) {
+    log_->info("get({}) problem with reading segment {}",
+               id,
+               segment->first_id);
+  }
+  return entry;
+}
+
+nonstd::optional<FlatFile::View> FlatFile::view(Identifier id) const {
+  std::shared_lock<std::shared_timed_mutex> read(segments_lock_);
+  if (id == 0 or id > current_id_) {
+    log_->info("view({}) block not found", id);
     return nonstd::nullopt;
   }
-  const auto fileSize = boost::filesystem::file_size(filename);
-  std::vector<uint8_t> buf;
-  buf.resize(fileSize);
-  boost::filesystem::ifstream file(filename, std::ifstream::binary);
-  if (not file.is_open()) {
-    log_->info("get({}) problem with opening file", id);
+
+  auto segment = std::upper_bound(
+      segments_.begin(),
+      segments_.end(),
+      id,
+      [](Identifier id, const auto &segment) { return id < segment.first_id; });
+  --segment;
+
+  std::shared_ptr<const void> mapping;
+  {
+    std::lock_guard<std::mutex> lock(mapping_lock_);
+    if (segment->mapped_size < segment->size) {
+      // segment is mapped with space for the following entries, so appending
+      // to the last segment does not require remapping for every entry
+      auto size = std::max(segment->size, segment_size_);
+      auto addr = ::mmap(
+          nullptr, size, PROT_READ, MAP_SHARED, segment->data_fd, 0);
+      if (addr == MAP_FAILED) {
+        log_->error("view({}) cannot map segment {}", id, segment->first_id);
+        return nonstd::nullopt;
+      }
+      segment->mapping = std::shared_ptr<const void>(
+          addr, [size](const void *addr) {
+            ::munmap(const_cast<void *>(addr), size);
+          });
+      segment->mapped_size = size;
+    }
+    mapping = segment->mapping;
+  }
+
+  auto offset = segment->offsets.at(id - segment->first_id);
+  auto data = static_cast<const uint8_t *>(mapping.get()) + offset;
+  uint32_t header[2];
+  std::memcpy(header, data, kHeaderSize);
+  if (offset + kHeaderSize + header[0] > segment->size) {
+    log_->info("view({}) problem with reading segment {}",
+               id,
+               segment->first_id);
     return nonstd::nullopt;
   }
-  file.read(reinterpret_cast<char *>(buf.data()), fileSize);
-  return buf;
+  return View{data + kHeaderSize, header[0], std::move(mapping)};
+}
+
+bool FlatFile::sync() {
+  std::unique_lock<std::shared_timed_mutex> write(segments_lock_);
+  for (auto i = unsynced_segment_; i < segments_.size(); ++i) {
+    if (::fdatasync(segments_[i].data_fd) != 0
+        or ::fdatasync(segments_[i].index_fd) != 0) {
+      log_->error("Cannot flush segment {}", segments_[i].first_id);
+      return false;
+    }
+  }
+  if (unsynced_directory_) {
+    // new segment files are durable only after their directory is flushed
+    auto dir_fd = ::open(dump_dir_.c_str(), O_RDONLY | O_DIRECTORY);
+    auto synced = dir_fd >= 0 and ::fsync(dir_fd) == 0;
+    if (dir_fd >= 0) {
+      ::close(dir_fd);
+    }
+    if (not synced) {
+      log_->error("Cannot flush storage dir {}", dump_dir_);
+      return false;
+    }
+    unsynced_directory_ = false;
+  }
+  unsynced_segment_ = segments_.empty() ? 0 : segments_.size() - 1;
+  return true;
 }
 
 std::string FlatFile::directory() const {
@@ -112,23 +292,197 @@ Identifier FlatFile::last_id() const {
   return current_id_.load();
 }
 
-void FlatFile::dropAll() {
+void FlatFile::rollback(Identifier last_id) {
+  std::unique_lock<std::shared_timed_mutex> write(segments_lock_);
+  if (last_id >= current_id_) {
+    return;
+  }
+
+  // views keep removed segment files mapped, so they stay readable
+  auto first_removed = std::upper_bound(
+      segments_.begin(),
+      segments_.end(),
+      last_id,
+      [](Identifier id, const auto &segment) { return id < segment.first_id; });
+  while (segments_.end() != first_removed) {
+    auto first_id = segments_.back().first_id;
+    segments_.pop_back();
+    removeSegmentFiles(first_id);
+  }
+
+  if (not segments_.empty()
+      and segments_.back().offsets.size()
+          > last_id - segments_.back().first_id + 1) {
+    truncateSegment(segments_.back(), last_id - segments_.back().first_id + 1);
+  }
+  unsynced_segment_ = std::min<size_t>(
+      unsynced_segment_, segments_.empty() ? 0 : segments_.size() - 1);
+  current_id_ = last_id;
+}
+
+bool FlatFile::dropAll() {
+  std::unique_lock<std::shared_timed_mutex> write(segments_lock_);
+  if (std::any_of(segments_.begin(), segments_.end(), isViewed)) {
+    log_->error("Cannot drop storage while its blocks are viewed");
+    return false;
+  }
+  segments_.clear();
+  unsynced_segment_ = 0;
+  unsynced_directory_ = false;
   remove_all(dump_dir_);
   auto res = FlatFile::check_consistency(dump_dir_);
   current_id_.store(*res);
+  return true;
 }
 
 // ----------| private API |----------
 
 FlatFile::FlatFile(Identifier current_id,
                    const std::string &path,
+                   uint64_t segment_size,
+                   std::vector<Segment> segments,
                    FlatFile::private_tag)
-    : dump_dir_(path) {
+    : dump_dir_(path),
+      segment_size_(segment_size),
+      segments_(std::move(segments)),
+      unsynced_segment_(segments_.empty() ? 0 : segments_.size() - 1),
+      unsynced_directory_(false) {
   log_ = logger::log("FlatFile");
   current_id_.store(current_id);
 }
 
-nonstd::optional<Identifier> FlatFile::check_consistency(
+FlatFile::Segment::Segment(Identifier first_id, int data_fd, int index_fd)
+    : first_id(first_id),
+      size(0),
+      data_fd(data_fd),
+      index_fd(index_fd),
+      mapped_size(0),
+      sealed(false) {}
+
+FlatFile::Segment::Segment(Segment &&rhs) noexcept
+    : first_id(rhs.first_id),
+      offsets(std::move(rhs.offsets)),
+      size(rhs.size),
+      data_fd(rhs.data_fd),
+      index_fd(rhs.index_fd),
+      mapping(std::move(rhs.mapping)),
+      mapped_size(rhs.mapped_size),
+      sealed(rhs.sealed) {
+  rhs.data_fd = -1;
+  rhs.index_fd = -1;
+}
+
+FlatFile::Segment::~Segment() {
+  if (data_fd >= 0) {
+    ::close(data_fd);
+  }
+  if (index_fd >= 0) {
+    ::close(index_fd);
+  }
+}
+
+bool FlatFile::startSegment(Identifier first_id) {
+  const auto data_path = segmentPath(dump_dir_, first_id, kDataExtension);
+  const auto index_path = segmentPath(dump_dir_, first_id, kIndexExtension);
+
+  // Existing files are never overwritten
+  auto data_fd =
+      ::open(data_path.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  if (data_fd < 0) {
+    log_->warn("Cannot create segment file {}", data_path.string());
+    return false;
+  }
+  // Index without data file is left from a removed segment and is outdated
+  auto index_fd =
+      ::open(index_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (index_fd < 0) {
+    log_->warn("Cannot create segment file {}", index_path.string());
+    ::close(data_fd);
+    boost::filesystem::remove(data_path);
+    return false;
+  }
+
+  segments_.emplace_back(first_id, data_fd, index_fd);
+  unsynced_directory_ = true;
+  return true;
+}
+
+bool FlatFile::isViewed(const Segment &segment) {
+  // views are created under shared lock, so while storage is locked for
+  // writing the count may only decrease
+  return segment.mapping.use_count() > 1;
+}
+
+void FlatFile::truncateSegment(Segment &segment, size_t count) {
+  auto size = segment.offsets.at(count);
+  if (isViewed(segment)) {
+    // truncating mapped file would break views, so the file is replaced by
+    // its truncated copy, while views keep the mapping of the original one
+    auto copy_fd = copySegmentData(segment, size);
+    if (copy_fd >= 0) {
+      ::close(segment.data_fd);
+      segment.data_fd = copy_fd;
+      segment.mapping.reset();
+      segment.mapped_size = 0;
+      unsynced_directory_ = true;
+    } else {
+      // removed entries are not overwritten while views may read them, and
+      // are truncated on recovery
+      log_->error("Cannot copy segment {}, it is sealed", segment.first_id);
+      segment.sealed = true;
+    }
+  } else if (::ftruncate(segment.data_fd, size) != 0) {
+    log_->error("Cannot truncate segment {}", segment.first_id);
+    segment.sealed = true;
+  }
+  // data is truncated first, so entries of not truncated index are
+  // dropped on recovery as incomplete
+  if (::ftruncate(segment.index_fd, count * kOffsetSize) != 0) {
+    log_->error("Cannot truncate index of segment {}", segment.first_id);
+    segment.sealed = true;
+  }
+  segment.size = size;
+  segment.offsets.resize(count);
+}
+
+int FlatFile::copySegmentData(const Segment &segment, uint64_t size) const {
+  auto path = segmentPath(dump_dir_, segment.first_id, kDataExtension);
+  auto copy_path = segmentPath(dump_dir_, segment.first_id, kCopyExtension);
+  auto fd =
+      ::open(copy_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+  if (fd < 0) {
+    return -1;
+  }
+  std::vector<uint8_t> buffer(kCopyChunkSize);
+  for (uint64_t offset = 0; offset < size; offset += buffer.size()) {
+    auto chunk = std::min<uint64_t>(buffer.size(), size - offset);
+    if (not readAt(segment.data_fd, buffer.data(), chunk, offset)
+        or not writeAt(fd, buffer.data(), chunk, offset)) {
+      ::close(fd);
+      boost::filesystem::remove(copy_path);
+      return -1;
+    }
+  }
+  boost::system::error_code err;
+  boost::filesystem::rename(copy_path, path, err);
+  if (err) {
+    ::close(fd);
+    boost::filesystem::remove(copy_path, err);
+    return -1;
+  }
+  return fd;
+}
+
+void FlatFile::removeSegmentFiles(Identifier first_id) {
+  boost::system::error_code err;
+  boost::filesystem::remove(segmentPath(dump_dir_, first_id, kDataExtension),
+                            err);
+  boost::filesystem::remove(segmentPath(dump_dir_, first_id, kIndexExtension),
+                            err);
+  unsynced_directory_ = true;
+}
+
+nonstd::optional<std::vector<FlatFile::Segment>> FlatFile::recover(
     const std::string &dump_dir) {
   auto log = logger::log("FLAT_FILE");
 
@@ -137,24 +491,95 @@ nonstd::optional<Identifier> FlatFile::check_consistency(
     return nonstd::nullopt;
   }
 
+  // copy of segment left by interrupted rollback is incomplete
+  for (boost::filesystem::directory_iterator it{dump_dir}, end; it != end;
+       ++it) {
+    if (it->path().extension() == kCopyExtension) {
+      boost::filesystem::remove(it->path());
+    }
+  }
+
   auto const files = [&dump_dir] {
     std::vector<boost::filesystem::path> ps;
-    std::copy(boost::filesystem::directory_iterator{dump_dir},
-              boost::filesystem::directory_iterator{},
-              std::back_inserter(ps));
+    std::copy_if(boost::filesystem::directory_iterator{dump_dir},
+                 boost::filesystem::directory_iterator{},
+                 std::back_inserter(ps),
+                 [](const boost::filesystem::path &p) {
+                   return p.extension() == kDataExtension;
+                 });
     std::sort(ps.begin(), ps.end(), std::less<boost::filesystem::path>());
     return ps;
   }();
 
-  auto const missing = boost::range::find_if(
-      files | boost::adaptors::indexed(1), [](const auto &it) {
-        return FlatFile::id_to_name(it.index()) != it.value().filename();
-      });
+  std::vector<Segment> segments;
+  Identifier expected_id = 1;
+  auto file = files.cbegin();
+  for (; file != files.cend(); ++file) {
+    if (file->stem() != FlatFile::id_to_name(expected_id)) {
+      break;
+    }
+    auto index_path = segmentPath(dump_dir, expected_id, kIndexExtension);
+    auto data_fd = ::open(file->c_str(), O_RDWR);
+    // Index may be absent if segment creation was interrupted
+    auto index_fd =
+        ::open(index_path.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    Segment segment(expected_id, data_fd, index_fd);
+    if (data_fd < 0 or index_fd < 0) {
+      log->error("Cannot open segment {}", file->string());
+      return nonstd::nullopt;
+    }
+
+    boost::system::error_code err;
+    auto data_size = boost::filesystem::file_size(*file, err);
+    auto index_size = boost::filesystem::file_size(index_path, err);
+    segment.offsets.resize(index_size / kOffsetSize);
+    if (not readAt(index_fd,
+                   segment.offsets.data(),
+                   segment.offsets.size() * kOffsetSize,
+                   0)) {
+      log->error("Cannot read index of segment {}", file->string());
+      return nonstd::nullopt;
+    }
+
+    // Only the tail of the last written entries may be torn
+    nonstd::optional<std::vector<uint8_t>> last_entry;
+    while (not segment.offsets.empty()
+           and not(last_entry = readEntry(
+                       data_fd, segment.offsets.back(), data_size))) {
+      segment.offsets.pop_back();
+    }
+    segment.size = segment.offsets.empty()
+        ? 0
+        : segment.offsets.back() + kHeaderSize + last_entry->size();
+    if (::ftruncate(data_fd, segment.size) != 0
+        or ::ftruncate(index_fd, segment.offsets.size() * kOffsetSize) != 0) {
+      log->error("Cannot truncate segment {}", file->string());
+      return nonstd::nullopt;
+    }
+    if (segment.offsets.empty()) {
+      break;
+    }
 
-  std::for_each(
-      missing.get(), files.cend(), [](const boost::filesystem::path &p) {
-        boost::filesystem::remove(p);
-      });
+    expected_id += segment.offsets.size();
+    segments.push_back(std::move(segment));
+  }
+
+  std::for_each(file, files.cend(), [](const boost::filesystem::path &p) {
+    boost::filesystem::remove(p);
+    boost::filesystem::remove(
+        boost::filesystem::path{p}.replace_extension(kIndexExtension));
+  });
 
-  return missing.get() - files.cbegin();
+  return nonstd::make_optional(std::move(segments));
+}
+
+nonstd::optional<Identifier> FlatFile::check_consistency(
+    const std::string &dump_dir) {
+  auto segments = FlatFile::recover(dump_dir);
+  if (not segments) {
+    return nonstd::nullopt;
+  }
+  return segments->empty()
+      ? 0
+      : segments->back().first_id + segments->back().offsets.size() - 1;
 }
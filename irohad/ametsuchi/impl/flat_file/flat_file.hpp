@@ -20,7 +20,9 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <nonstd/optional.hpp>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -30,7 +32,10 @@ namespace iroha {
   namespace ametsuchi {
 
     /**
-     * Solid storage based on raw files
+     * Solid storage based on raw files.
+     * Entries are appended to segment files of limited size. Every segment
+     * has a companion index file with offsets of its entries, so opening the
+     * storage and reading an entry does not depend on the number of entries.
      */
     class FlatFile {
       /**
@@ -49,6 +54,24 @@ namespace iroha {
 
       static const uint32_t DIGIT_CAPACITY = 16;
 
+      /**
+       * Size of segment file after which the next segment is started
+       */
+      static const uint64_t DEFAULT_SEGMENT_SIZE = 64 * 1024 * 1024;
+
+      /**
+       * Entity data mapped to memory from segment file
+       */
+      struct View {
+        const uint8_t *data;
+        size_t size;
+
+        /**
+         * Keeps memory mapped while the view exists
+         */
+        std::shared_ptr<const void> mapping;
+      };
+
       /**
        * Convert id to a string representation. The string representation is
        * always DIGIT_CAPACITY-character width regardless of the value of `id`.
@@ -66,13 +89,17 @@ namespace iroha {
       /**
        * Create storage in paths
        * @param path - target path for creating
+       * @param segment_size - size of segment file after which the next
+       * segment is started
        * @return created storage
        */
       static nonstd::optional<std::unique_ptr<FlatFile>> create(
-          const std::string &path);
+          const std::string &path,
+          uint64_t segment_size = DEFAULT_SEGMENT_SIZE);
 
       /**
-       * Add entity with binary data
+       * Add entity with binary data. Data is not guaranteed to be on disk
+       * until sync() is called
        * @param id - reference key
        * @param blob - data associated with key
        */
@@ -85,6 +112,21 @@ namespace iroha {
        */
       nonstd::optional<std::vector<uint8_t>> get(Identifier id) const;
 
+      /**
+       * Get data associated with key without copying it from segment file.
+       * Unlike get(), checksum of data is not verified
+       * @param id - reference key
+       * @return - view of blob, if exists
+       */
+      nonstd::optional<View> view(Identifier id) const;
+
+      /**
+       * Flush all added entities to disk, so a batch of additions costs
+       * a single flush
+       * @return true if flush succeeded
+       */
+      bool sync();
+
       /**
        * @return folder of storage
        */
@@ -97,15 +139,29 @@ namespace iroha {
 
       /**
        * Checking consistency of storage for provided folder
-       * If some block in the middle is missing all blocks following it are
-       * deleted
+       * If some segment in the middle is missing all segments following it are
+       * deleted. Partially written entries at the end of a segment are
+       * truncated
        * @param dump_dir - folder of storage
        * @return - last available identifier
        */
       static nonstd::optional<Identifier> check_consistency(
           const std::string &dump_dir);
 
-      void dropAll();
+      /**
+       * Remove entries added after given key, e.g. when they cannot be
+       * flushed. Existing views of removed entries stay readable. If files
+       * cannot be truncated, removed entries are dropped on recovery
+       * @param last_id - key of the last entry to keep
+       */
+      void rollback(Identifier last_id);
+
+      /**
+       * Remove all entries with segment files. Storage is not dropped while
+       * views of its entries exist, because they reference segment files
+       * @return true if storage was dropped
+       */
+      bool dropAll();
 
       // ----------| modify operations |----------
 
@@ -117,15 +173,112 @@ namespace iroha {
 
       FlatFile &operator=(FlatFile &&rhs) = delete;
 
+     private:
+      /**
+       * Opened segment of storage
+       */
+      struct Segment {
+        Segment(Identifier first_id, int data_fd, int index_fd);
+
+        Segment(Segment &&rhs) noexcept;
+
+        Segment(const Segment &rhs) = delete;
+
+        Segment &operator=(const Segment &rhs) = delete;
+
+        Segment &operator=(Segment &&rhs) = delete;
+
+        ~Segment();
+
+        /**
+         * Key of the first entry in segment
+         */
+        Identifier first_id;
+
+        /**
+         * Offsets of entries in data file
+         */
+        std::vector<uint64_t> offsets;
+
+        /**
+         * Size of data file
+         */
+        uint64_t size;
+
+        int data_fd;
+        int index_fd;
+
+        /**
+         * Read-only mapping of data file and its length, created on demand
+         */
+        mutable std::shared_ptr<const void> mapping;
+        mutable uint64_t mapped_size;
+
+        /**
+         * Whether following entries are appended to a new segment, because
+         * data after the end of this one may still be read by views
+         */
+        bool sealed;
+      };
+
+      /**
+       * Open all segments of storage, truncating torn entries and removing
+       * segments which do not follow the previous ones
+       * @param dump_dir - folder of storage
+       * @return segments in order of keys
+       */
+      static nonstd::optional<std::vector<Segment>> recover(
+          const std::string &dump_dir);
+
+      /**
+       * Create segment files for entries starting with given key
+       * @param first_id - key of the first entry in segment
+       * @return true if segment was created
+       */
+      bool startSegment(Identifier first_id);
+
+      /**
+       * @return true if some view keeps mapping of the segment
+       */
+      static bool isViewed(const Segment &segment);
+
+      /**
+       * Keep first entries of segment, removing the following ones from
+       * memory and segment files
+       * @param segment - segment to truncate
+       * @param count - number of entries to keep
+       */
+      void truncateSegment(Segment &segment, size_t count);
+
+      /**
+       * Replace data file of segment with its copy of given size
+       * @param segment - segment to copy
+       * @param size - size of data to copy
+       * @return descriptor of the copy, or -1 if it is not created
+       */
+      int copySegmentData(const Segment &segment, uint64_t size) const;
+
+      /**
+       * Remove files of closed segment
+       * @param first_id - key of the first entry in segment
+       */
+      void removeSegmentFiles(Identifier first_id);
+
+     public:
       // ----------| private API |----------
 
       /**
        * Create storage in path with respect to last key
        * @param last_id - maximal key written in storage
        * @param path - folder of storage
+       * @param segment_size - size of segment file after which the next
+       * segment is started
+       * @param segments - opened segments of storage
        */
       FlatFile(Identifier last_id,
                const std::string &path,
+               uint64_t segment_size,
+               std::vector<Segment> segments,
                FlatFile::private_tag);
 
      private:
@@ -141,6 +294,28 @@ namespace iroha {
        */
       const std::string dump_dir_;
 
+      const uint64_t segment_size_;
+
+      std::vector<Segment> segments_;
+
+      /**
+       * Index of the first segment with data which is not flushed yet
+       */
+      size_t unsynced_segment_;
+
+      /**
+       * Whether segment files were created after the last flush
+       */
+      bool unsynced_directory_;
+
+      // Allows multiple readers and a single writer
+      mutable std::shared_timed_mutex segments_lock_;
+
+      /**
+       * Guards mappings of segments, which are created by readers
+       */
+      mutable std::mutex mapping_lock_;
+
       logger::Logger log_;
 
      public:
@@ -16,6 +16,8 @@
  */
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/cached_wsv_command.hpp"
+#include "ametsuchi/impl/cached_wsv_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "model/execution/command_executor_factory.hpp"
@@ -27,14 +29,18 @@ namespace iroha {
   namespace ametsuchi {
     MutableStorageImpl::MutableStorageImpl(
         hash256_t top_hash,
-        std::unique_ptr<pqxx::lazyconnection> connection,
+        PooledConnection connection,
         std::unique_ptr<pqxx::nontransaction> transaction,
-        std::shared_ptr<model::CommandExecutorFactory> command_executors)
+        std::shared_ptr<model::CommandExecutorFactory> command_executors,
+        std::shared_ptr<WsvCache> wsv_cache)
         : top_hash_(top_hash),
           connection_(std::move(connection)),
           transaction_(std::move(transaction)),
-          wsv_(std::make_unique<PostgresWsvQuery>(*transaction_)),
-          executor_(std::make_unique<PostgresWsvCommand>(*transaction_)),
+          wsv_(std::make_unique<CachedWsvQuery>(
+              std::make_unique<PostgresWsvQuery>(*transaction_),
+              std::move(wsv_cache))),
+          executor_(std::make_unique<CachedWsvCommand>(
+              std::make_unique<PostgresWsvCommand>(*transaction_), *wsv_)),
           block_index_(std::make_unique<PostgresBlockIndex>(*transaction_)),
           command_executors_(std::move(command_executors)),
           committed(false),
@@ -69,9 +75,14 @@ namespace iroha {
                           block.transactions.end(),
                           execute_transaction);
 
+      if (result
+          and not block_index_->index(shared_model::proto::from_old(block))) {
+        log_->error("Cannot index block {}", block.height);
+        result = false;
+      }
+
       if (result) {
         block_store_.insert(std::make_pair(block.height, block));
-        block_index_->index(shared_model::proto::from_old(block));
 
         top_hash_ = block.hash;
         transaction_->exec("RELEASE SAVEPOINT savepoint_;");
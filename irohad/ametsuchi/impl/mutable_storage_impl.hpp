@@ -18,11 +18,12 @@
 #ifndef IROHA_MUTABLE_STORAGE_IMPL_HPP
 #define IROHA_MUTABLE_STORAGE_IMPL_HPP
 
-#include <pqxx/connection>
 #include <pqxx/nontransaction>
 #include <unordered_map>
 
 #include "ametsuchi/mutable_storage.hpp"
+#include "ametsuchi/impl/postgres_connection_pool.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -34,6 +35,7 @@ namespace iroha {
   namespace ametsuchi {
 
     class BlockIndex;
+    class CachedWsvQuery;
     class WsvCommand;
 
     class MutableStorageImpl : public MutableStorage {
@@ -42,9 +44,10 @@ namespace iroha {
      public:
       MutableStorageImpl(
           hash256_t top_hash,
-          std::unique_ptr<pqxx::lazyconnection> connection,
+          PooledConnection connection,
           std::unique_ptr<pqxx::nontransaction> transaction,
-          std::shared_ptr<model::CommandExecutorFactory> command_executors);
+          std::shared_ptr<model::CommandExecutorFactory> command_executors,
+          std::shared_ptr<WsvCache> wsv_cache);
 
       bool apply(const model::Block &block,
                  std::function<bool(const model::Block &,
@@ -59,9 +62,9 @@ namespace iroha {
       // StorageImpl::commit
       std::map<uint32_t, model::Block> block_store_;
 
-      std::unique_ptr<pqxx::lazyconnection> connection_;
+      PooledConnection connection_;
       std::unique_ptr<pqxx::nontransaction> transaction_;
-      std::unique_ptr<WsvQuery> wsv_;
+      std::unique_ptr<CachedWsvQuery> wsv_;
       std::unique_ptr<WsvCommand> executor_;
       std::unique_ptr<BlockIndex> block_index_;
       std::shared_ptr<model::CommandExecutorFactory> command_executors_;
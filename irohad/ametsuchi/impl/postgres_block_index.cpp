@@ -15,15 +15,10 @@
  * limitations under the License.
  */
 
-#include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
-#include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/for_each.hpp>
-#include <boost/range/numeric.hpp>
-#include <unordered_set>
 
 #include "ametsuchi/impl/postgres_block_index.hpp"
-#include "common/types.hpp"
 #include "common/visitor.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 #include "interfaces/commands/transfer_asset.hpp"
@@ -32,95 +27,170 @@
 namespace iroha {
   namespace ametsuchi {
 
+    const std::string kInsertHeightByHash = "block_index_height_by_hash";
+    const std::string kInsertBlockHashes = "block_index_block_hashes";
+    const std::string kInsertHeightByAccount =
+        "block_index_height_by_account_set";
+    const std::string kInsertIndexByCreator =
+        "block_index_index_by_creator_height";
+    const std::string kInsertIndexByAsset =
+        "block_index_index_by_id_height_asset";
+
+    namespace {
+      /**
+       * Make literal of Postgres array, which is bound as a single parameter
+       * @param values of array elements
+       * @return literal with quoted and escaped elements
+       */
+      template <typename Values>
+      std::string makeArray(const Values &values) {
+        std::string array = "{";
+        for (const auto &value : values) {
+          if (array.size() > 1) {
+            array += ',';
+          }
+          array += '"';
+          for (auto c : value) {
+            if (c == '"' or c == '\\') {
+              array += '\\';
+            }
+            array += c;
+          }
+          array += '"';
+        }
+        return array + "}";
+      }
+    }  // namespace
+
     PostgresBlockIndex::PostgresBlockIndex(pqxx::nontransaction &transaction)
         : transaction_(transaction),
           log_(logger::log("PostgresBlockIndex")),
-          execute_{makeExecuteOptional(transaction_, log_)} {}
+          execute_{makeExecutePreparedOptional(transaction_, log_)} {
+      // rows of the block are bound as arrays, so each table is written by a
+      // single execution of its statement
+      prepareStatements(
+          transaction_,
+          {{kInsertHeightByHash,
+            "INSERT INTO height_by_hash(hash, height) "
+            "SELECT unnest($1::bytea[]), $2::bigint;"},
+           {kInsertBlockHashes,
+            "INSERT INTO height_by_hash(hash, height) "
+            "SELECT hash, height "
+            "FROM unnest($1::bytea[], $2::bigint[]) AS batch(hash, height) "
+            "WHERE NOT EXISTS (SELECT 1 FROM height_by_hash AS indexed "
+            "WHERE indexed.hash = batch.hash "
+            "AND indexed.height = batch.height);"},
+           {kInsertHeightByAccount,
+            "INSERT INTO height_by_account_set(account_id, height) "
+            "SELECT unnest($1::text[]), $2::bigint;"},
+           {kInsertIndexByCreator,
+            "INSERT INTO index_by_creator_height(creator_id, height, index) "
+            "SELECT creator_id, $3::bigint, index "
+            "FROM unnest($1::text[], $2::int[]) AS row(creator_id, index);"},
+           {kInsertIndexByAsset,
+            "INSERT INTO index_by_id_height_asset(id, height, asset_id, "
+            "index) SELECT id, $4::bigint, asset_id, index "
+            "FROM unnest($1::text[], $2::text[], $3::int[]) "
+            "AS row(id, asset_id, index);"}});
+    }
 
-    auto PostgresBlockIndex::indexAccountIdHeight(const std::string &account_id,
-                                                  const std::string &height) {
-      return this->execute(
-          "INSERT INTO height_by_account_set(account_id, height) "
-          "VALUES ("
-          + transaction_.quote(account_id) + ", " + transaction_.quote(height)
-          + ");");
+    void PostgresBlockIndex::indexAccountIdHeight(
+        Rows &rows, const std::string &account_id) {
+      rows.height_by_account_set.insert(account_id);
     }
 
-    auto PostgresBlockIndex::indexAccountAssets(
+    void PostgresBlockIndex::indexAccountAssets(
+        Rows &rows,
         const std::string &account_id,
-        const std::string &height,
         const std::string &index,
         const shared_model::interface::Transaction::CommandsType &commands) {
       // flat map abstract commands to transfers
+      for (const auto &cmd : commands) {
+        visit_in_place(
+            cmd->get(),
+            [&](const shared_model::detail::PolymorphicWrapper<
+                shared_model::interface::TransferAsset> &command) {
+              this->indexAccountIdHeight(rows, command->srcAccountId());
+              this->indexAccountIdHeight(rows, command->destAccountId());
 
-      return std::accumulate(
-          commands.begin(),
-          commands.end(),
-          true,
-          [&](auto &status, const auto &cmd) {
-            return visit_in_place(
-                cmd->get(),
-                [&](const shared_model::detail::PolymorphicWrapper<
-                    shared_model::interface::TransferAsset> &command) {
-                  status &= this->indexAccountIdHeight(command->srcAccountId(),
-                                                       height)
-                      & this->indexAccountIdHeight(command->destAccountId(),
-                                                   height);
-
-                  auto ids = {account_id,
-                              command->srcAccountId(),
-                              command->destAccountId()};
-                  // flat map accounts to unindexed keys
-                  boost::for_each(ids, [&](const auto &id) {
-                    auto res = execute_(
-                        "INSERT INTO index_by_id_height_asset(id, "
-                        "height, asset_id, "
-                        "index) "
-                        "VALUES ("
-                        + transaction_.quote(id) + ", "
-                        + transaction_.quote(height) + ", "
-                        + transaction_.quote(command->assetId()) + ", "
-                        + transaction_.quote(index) + ");");
-                    status &= res != boost::none;
-                  });
-                  return status;
-                },
-                [&](const auto &command) { return true; });
-
-          });
+              auto ids = {account_id,
+                          command->srcAccountId(),
+                          command->destAccountId()};
+              // flat map accounts to unindexed keys
+              boost::for_each(ids, [&](const auto &id) {
+                rows.index_by_id_height_asset.emplace(
+                    id, command->assetId(), index);
+              });
+            },
+            [&](const auto &command) {});
+      }
     }
 
-    void PostgresBlockIndex::index(
+    bool PostgresBlockIndex::index(
         const shared_model::interface::Block &block) {
       const auto &height = std::to_string(block.height());
+      Rows rows;
+
+      // block hash -> its height, hash is taken from payload as in model
+      rows.height_by_hash.push_back(
+          "\\x" + sha3_256(block.payload().blob()).to_hexstring());
+
       boost::for_each(
           block.transactions() | boost::adaptors::indexed(0),
           [&](const auto &tx) {
             const auto &creator_id = tx.value()->creatorAccountId();
-            const auto &hash = tx.value()->hash().blob();
             const auto &index = std::to_string(tx.index());
 
             // tx hash -> block where hash is stored
-            this->execute("INSERT INTO height_by_hash(hash, height) VALUES ("
-                          + transaction_.quote(
-                                pqxx::binarystring(hash.data(), hash.size()))
-                          + ", " + transaction_.quote(height) + ");");
+            rows.height_by_hash.push_back(
+                "\\x" + tx.value()->hash().hex());
 
-            this->indexAccountIdHeight(creator_id, height);
+            this->indexAccountIdHeight(rows, creator_id);
 
             // to make index account_id:height -> list of tx indexes
             // (where tx is placed in the block)
-            execute_(
-                "INSERT INTO index_by_creator_height(creator_id, "
-                "height, index) "
-                "VALUES ("
-                + transaction_.quote(creator_id) + ", "
-                + transaction_.quote(height) + ", " + transaction_.quote(index)
-                + ");");
+            rows.creators.push_back(creator_id);
+            rows.creator_indexes.push_back(index);
 
             this->indexAccountAssets(
-                creator_id, height, index, tx.value()->commands());
+                rows, creator_id, index, tx.value()->commands());
           });
+
+      std::vector<std::string> ids, asset_ids, indexes;
+      for (const auto &row : rows.index_by_id_height_asset) {
+        ids.push_back(std::get<0>(row));
+        asset_ids.push_back(std::get<1>(row));
+        indexes.push_back(std::get<2>(row));
+      }
+
+      // failed statement aborts the transaction, so the rest is not executed
+      auto indexed =
+          this->execute(
+              kInsertHeightByHash, makeArray(rows.height_by_hash), height)
+          and this->execute(kInsertHeightByAccount,
+                            makeArray(rows.height_by_account_set),
+                            height)
+          and this->execute(kInsertIndexByCreator,
+                            makeArray(rows.creators),
+                            makeArray(rows.creator_indexes),
+                            height)
+          and this->execute(kInsertIndexByAsset,
+                            makeArray(ids),
+                            makeArray(asset_ids),
+                            makeArray(indexes),
+                            height);
+      return indexed;
+    }
+
+    bool PostgresBlockIndex::indexBlockHashes(
+        const std::vector<std::pair<hash256_t, uint64_t>> &hashes) {
+      std::vector<std::string> hex_hashes, heights;
+      for (const auto &hash : hashes) {
+        hex_hashes.push_back("\\x" + hash.first.to_hexstring());
+        heights.push_back(std::to_string(hash.second));
+      }
+      return this->execute(
+          kInsertBlockHashes, makeArray(hex_hashes), makeArray(heights));
     }
   }  // namespace ametsuchi
 }  // namespace iroha
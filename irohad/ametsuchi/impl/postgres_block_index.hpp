@@ -18,11 +18,15 @@
 #ifndef IROHA_POSTGRES_BLOCK_INDEX_HPP
 #define IROHA_POSTGRES_BLOCK_INDEX_HPP
 
-#include <boost/format.hpp>
 #include <pqxx/nontransaction>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "ametsuchi/impl/block_index.hpp"
 #include "ametsuchi/impl/postgres_wsv_common.hpp"
+#include "common/types.hpp"
 #include "logger/logger.hpp"
 #include "interfaces/transaction.hpp"
 
@@ -32,40 +36,66 @@ namespace iroha {
      public:
       explicit PostgresBlockIndex(pqxx::nontransaction &transaction);
 
-      void index(const shared_model::interface::Block &block) override;
+      bool index(const shared_model::interface::Block &block) override;
+
+      /**
+       * Index hashes of already stored blocks, which are not indexed yet
+       * @param hashes of blocks paired with their heights
+       * @return true if all rows were written, false otherwise
+       */
+      bool indexBlockHashes(
+          const std::vector<std::pair<hash256_t, uint64_t>> &hashes);
 
      private:
+      /**
+       * Columns of rows of a single block, grouped by index table.
+       * Rows of sets are not distinct by themselves, and are inserted once.
+       * Height is the same for all rows, and is bound separately
+       */
+      struct Rows {
+        /// hex of hashes prefixed with \x, as bytea is read from text
+        std::vector<std::string> height_by_hash;
+        std::set<std::string> height_by_account_set;
+        std::vector<std::string> creators;
+        std::vector<std::string> creator_indexes;
+        /// account id, asset id and index of transaction
+        std::set<std::tuple<std::string, std::string, std::string>>
+            index_by_id_height_asset;
+      };
+
       /**
        * Make index account_id -> list of blocks where his txs exist
+       * @param rows to append index row to
        * @param account_id of transaction creator
-       * @param height of block
        */
-      auto indexAccountIdHeight(const std::string &account_id,
-                                const std::string &height);
+      void indexAccountIdHeight(Rows &rows, const std::string &account_id);
 
       /**
        * Collect all assets belonging to creator, sender, and receiver
        * to make account_id:height:asset_id -> list of tx indexes (where
        * tx with certain asset is placed in the block)
+       * @param rows to append index rows to
        * @param account_id of transaction creator
-       * @param height of block
        * @param index of transaction in the block
        * @param commands in the transaction
        */
-      auto indexAccountAssets(
+      void indexAccountAssets(
+          Rows &rows,
           const std::string &account_id,
-          const std::string &height,
           const std::string &index,
           const shared_model::interface::Transaction::CommandsType &commands);
 
       pqxx::nontransaction &transaction_;
       logger::Logger log_;
-      using ExecuteType = decltype(makeExecuteOptional(transaction_, log_));
+      using ExecuteType =
+          decltype(makeExecutePreparedOptional(transaction_, log_));
       ExecuteType execute_;
 
       // TODO: refactor to return Result when it is introduced IR-775
-      bool execute(const std::string &statement) noexcept {
-        return static_cast<bool>(execute_(statement));
+      template <typename... Args>
+      bool execute(const std::string &statement,
+                   const Args &... parameters) noexcept {
+        return static_cast<bool>(execute_(statement, parameters...));
       }
     };
   }  // namespace ametsuchi
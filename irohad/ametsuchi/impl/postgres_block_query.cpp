@@ -16,10 +16,26 @@
  */
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
-#include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/for_each.hpp>
+#include "model/converters/pb_common.hpp"
 #include "model/sha3_hash.hpp"
 
+namespace {
+  /**
+   * Makes the end of range query over (height, index) columns, which
+   * selects rows of the page in the order of the ledger
+   * @param pager - cursor and size of the page
+   * @return SQL condition with ordering and limit
+   */
+  std::string pageClause(const iroha::model::Pager &pager) {
+    return " AND (height, index) > (" + std::to_string(pager.cursor.height)
+        + ", " + std::to_string(pager.cursor.index)
+        + ") ORDER BY height, index"
+        + (pager.page_size == 0 ? ""
+                                : " LIMIT " + std::to_string(pager.page_size))
+        + ";";
+  }
+}  // namespace
+
 namespace iroha {
   namespace ametsuchi {
 
@@ -45,13 +61,7 @@ namespace iroha {
             s.on_completed();
             return;
           }
-          auto document =
-              model::converters::stringToJson(bytesToString(bytes.value()));
-          if (not document.has_value()) {
-            s.on_completed();
-            return;
-          }
-          auto block = serializer_.deserialize(document.value());
+          auto block = this->deserializeBlock(bytes.value());
           if (not block.has_value()) {
             s.on_completed();
             return;
@@ -67,6 +77,16 @@ namespace iroha {
       return getBlocks(height, block_store_.last_id());
     }
 
+    boost::optional<RawBlock> PostgresBlockQuery::getRawBlock(
+        uint32_t height) {
+      // data stays in mapped segment, which is kept by the holder
+      auto view = block_store_.view(height);
+      if (not view) {
+        return boost::none;
+      }
+      return RawBlock{view->data, view->size, std::move(view->mapping)};
+    }
+
     rxcpp::observable<model::Block> PostgresBlockQuery::getTopBlocks(
         uint32_t count) {
       auto last_id = block_store_.last_id();
@@ -74,22 +94,6 @@ namespace iroha {
       return getBlocks(last_id - count + 1, count);
     }
 
-    std::vector<iroha::model::Block::BlockHeightType>
-    PostgresBlockQuery::getBlockIds(const std::string &account_id) {
-      return execute_(
-                 "SELECT DISTINCT height FROM height_by_account_set WHERE "
-                 "account_id = "
-                 + transaction_.quote(account_id) + ";")
-                 | [&](const auto &result)
-                 -> std::vector<iroha::model::Block::BlockHeightType> {
-        return transform<iroha::model::Block::BlockHeightType>(
-            result, [&](const auto &row) {
-              return row.at("height")
-                  .template as<iroha::model::Block::BlockHeightType>();
-            });
-      };
-    }
-
     boost::optional<iroha::model::Block::BlockHeightType>
     PostgresBlockQuery::getBlockId(const std::string &hash) {
       boost::optional<uint64_t> blockId;
@@ -109,41 +113,45 @@ namespace iroha {
     }
 
     std::function<void(pqxx::result &result)> PostgresBlockQuery::callback(
-        const rxcpp::subscriber<model::Transaction> &subscriber,
-        uint64_t block_id) {
-      return [this, &subscriber, block_id](pqxx::result &result) {
-        auto block = block_store_.get(block_id) | [](auto bytes) {
-          return model::converters::stringToJson(bytesToString(bytes));
-        } | [this](const auto &json) { return serializer_.deserialize(json); };
-        boost::for_each(
-            result | boost::adaptors::transformed([&block](const auto &x) {
-              return x.at("index").template as<size_t>();
-            }),
-            [&](auto x) {
-              const auto &tx = block->transactions.at(x);
-              subscriber.on_next(tx);
-            });
+        const rxcpp::subscriber<TransactionWithCursor> &subscriber) {
+      return [this, &subscriber](pqxx::result &result) {
+        // rows are ordered by height, so every block is read once
+        nonstd::optional<model::Block> block;
+        model::TxCursor cursor;
+        for (const auto &row : result) {
+          auto height =
+              row.at("height").template as<model::Block::BlockHeightType>();
+          if (height != cursor.height) {
+            block = block_store_.get(height) | [this](const auto &bytes) {
+              return this->deserializeBlock(bytes);
+            };
+          }
+          cursor.height = height;
+          cursor.index = row.at("index").template as<uint32_t>();
+          if (block) {
+            subscriber.on_next(
+                std::make_pair(cursor, block->transactions.at(cursor.index)));
+          }
+        }
       };
     }
 
     rxcpp::observable<model::Transaction>
     PostgresBlockQuery::getAccountTransactions(const std::string &account_id) {
-      return rxcpp::observable<>::create<model::Transaction>(
-          [this, account_id](auto subscriber) {
-            auto block_ids = this->getBlockIds(account_id);
-            if (block_ids.empty()) {
-              subscriber.on_completed();
-              return;
-            }
-
-            for (const auto &block_id : block_ids) {
-              execute_(
-                  "SELECT DISTINCT index FROM index_by_creator_height WHERE "
-                  "creator_id = "
-                  + transaction_.quote(account_id)
-                  + " AND height = " + transaction_.quote(block_id) + ";")
-                  | this->callback(subscriber, block_id);
-            }
+      return getAccountTransactions(account_id, model::Pager{})
+          .map([](const auto &tx) { return tx.second; });
+    }
+
+    rxcpp::observable<TransactionWithCursor>
+    PostgresBlockQuery::getAccountTransactions(const std::string &account_id,
+                                               const model::Pager &pager) {
+      return rxcpp::observable<>::create<TransactionWithCursor>(
+          [this, account_id, pager](auto subscriber) {
+            execute_(
+                "SELECT DISTINCT height, index FROM index_by_creator_height "
+                "WHERE creator_id = "
+                + transaction_.quote(account_id) + pageClause(pager))
+                | this->callback(subscriber);
             subscriber.on_completed();
           });
     }
@@ -151,24 +159,26 @@ namespace iroha {
     rxcpp::observable<model::Transaction>
     PostgresBlockQuery::getAccountAssetTransactions(
         const std::string &account_id, const std::string &asset_id) {
-      return rxcpp::observable<>::create<
-          model::Transaction>([this, account_id, asset_id](auto subscriber) {
-        auto block_ids = this->getBlockIds(account_id);
-        if (block_ids.empty()) {
-          subscriber.on_completed();
-          return;
-        }
+      return getAccountAssetTransactions(account_id, asset_id, model::Pager{})
+          .map([](const auto &tx) { return tx.second; });
+    }
 
-        for (const auto &block_id : block_ids) {
-          execute_(
-              "SELECT DISTINCT index FROM index_by_id_height_asset WHERE id = "
-              + transaction_.quote(account_id)
-              + " AND height = " + transaction_.quote(block_id)
-              + " AND asset_id = " + transaction_.quote(asset_id) + ";")
-              | this->callback(subscriber, block_id);
-        }
-        subscriber.on_completed();
-      });
+    rxcpp::observable<TransactionWithCursor>
+    PostgresBlockQuery::getAccountAssetTransactions(
+        const std::string &account_id,
+        const std::string &asset_id,
+        const model::Pager &pager) {
+      return rxcpp::observable<>::create<TransactionWithCursor>(
+          [this, account_id, asset_id, pager](auto subscriber) {
+            execute_(
+                "SELECT DISTINCT height, index FROM index_by_id_height_asset "
+                "WHERE id = "
+                + transaction_.quote(account_id)
+                + " AND asset_id = " + transaction_.quote(asset_id)
+                + pageClause(pager))
+                | this->callback(subscriber);
+            subscriber.on_completed();
+          });
     }
 
     rxcpp::observable<boost::optional<model::Transaction>>
@@ -190,10 +200,7 @@ namespace iroha {
         const std::string &hash) {
       return getBlockId(hash) |
           [this](auto blockId) { return block_store_.get(blockId); } |
-          [](auto bytes) {
-            return model::converters::stringToJson(bytesToString(bytes));
-          }
-      | [this](const auto &json) { return serializer_.deserialize(json); }
+          [this](const auto &bytes) { return this->deserializeBlock(bytes); }
       | [&](const auto &block) {
           auto it = std::find_if(
               block.transactions.begin(),
@@ -205,5 +212,36 @@ namespace iroha {
         };
     }
 
+    boost::optional<protocol::Block>
+    PostgresBlockQuery::getProtoBlockByHashSync(const hash256_t &hash) {
+      return getBlockId(hash.to_string()) |
+          [this](auto blockId) { return block_store_.view(blockId); } |
+          [&](const auto &view) -> boost::optional<protocol::Block> {
+        protocol::Block block;
+        // transaction hashes are stored in the same index, so the block found
+        // is checked to be the requested one
+        if (not block.ParseFromArray(view.data, view.size)
+            or iroha::hash(block) != hash) {
+          return boost::none;
+        }
+        return block;
+      };
+    }
+
+    nonstd::optional<model::Block> PostgresBlockQuery::deserializeBlock(
+        const std::vector<uint8_t> &bytes) const {
+      protocol::Block pb_block;
+      if (not pb_block.ParseFromArray(bytes.data(), bytes.size())) {
+        log_->error("Cannot parse block from block store");
+        return nonstd::nullopt;
+      }
+      try {
+        return serializer_.deserialize(pb_block);
+      } catch (const BadFormatException &e) {
+        log_->error("Malformed block in block store: {}", e.what());
+        return nonstd::nullopt;
+      }
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
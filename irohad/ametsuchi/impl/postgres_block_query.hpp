@@ -24,13 +24,11 @@
 #include "logger/logger.hpp"
 #include "postgres_wsv_common.hpp"
 
-#include "model/converters/json_block_factory.hpp"
+#include "model/converters/pb_block_factory.hpp"
+#include "model/queries/get_transactions.hpp"
 
 #include <boost/optional.hpp>
 
-#include "model/converters/json_block_factory.hpp"
-
-
 namespace iroha {
   namespace ametsuchi {
 
@@ -47,55 +45,68 @@ namespace iroha {
       rxcpp::observable<model::Transaction> getAccountTransactions(
           const std::string &account_id) override;
 
+      rxcpp::observable<TransactionWithCursor> getAccountTransactions(
+          const std::string &account_id, const model::Pager &pager) override;
+
       rxcpp::observable<model::Transaction> getAccountAssetTransactions(
           const std::string &account_id, const std::string &asset_id) override;
 
+      rxcpp::observable<TransactionWithCursor> getAccountAssetTransactions(
+          const std::string &account_id,
+          const std::string &asset_id,
+          const model::Pager &pager) override;
+
       rxcpp::observable<boost::optional<model::Transaction>> getTransactions(
           const std::vector<iroha::hash256_t> &tx_hashes) override;
 
       boost::optional<model::Transaction> getTxByHashSync(
           const std::string &hash) override;
 
+      boost::optional<protocol::Block> getProtoBlockByHashSync(
+          const hash256_t &hash) override;
+
       rxcpp::observable<model::Block> getBlocks(uint32_t height,
                                                 uint32_t count) override;
 
       rxcpp::observable<model::Block> getBlocksFrom(uint32_t height) override;
 
+      boost::optional<RawBlock> getRawBlock(uint32_t height) override;
+
       rxcpp::observable<model::Block> getTopBlocks(uint32_t count) override;
 
      private:
       /**
-       * Returns all blocks' ids containing given account id
-       * @param account_id
-       * @return vector of block ids
-       */
-      std::vector<iroha::model::Block::BlockHeightType> getBlockIds(
-          const std::string &account_id);
-
-      /**
-       * Returns block id which contains transaction with a given hash
-       * @param hash - hash of transaction
+       * Returns block id which contains transaction with a given hash, or id
+       * of block with a given hash
+       * @param hash - hash of transaction or block
        * @return block id or boost::none
        */
       boost::optional<iroha::model::Block::BlockHeightType> getBlockId(
           const std::string &hash);
 
       /**
-       * creates callback to lrange query to Postgres to supply result to
-       * subscriber s
+       * creates callback to range query to Postgres, which supplies
+       * transactions at returned (height, index) positions to subscriber s
        * @param s
-       * @param block_id
        * @return
        */
       std::function<void(pqxx::result &result)> callback(
-          const rxcpp::subscriber<model::Transaction> &s, uint64_t block_id);
+          const rxcpp::subscriber<TransactionWithCursor> &s);
+
+      /**
+       * Parse block from its binary representation in block store
+       * @param bytes - serialized protocol::Block
+       * @return block or nonstd::nullopt if bytes are malformed
+       */
+      nonstd::optional<model::Block> deserializeBlock(
+          const std::vector<uint8_t> &bytes) const;
 
       FlatFile &block_store_;
       pqxx::nontransaction &transaction_;
       logger::Logger log_;
       using ExecuteType = decltype(makeExecuteOptional(transaction_, log_));
       ExecuteType execute_;
-      model::converters::JsonBlockFactory serializer_;
+      model::converters::PbBlockFactory serializer_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -0,0 +1,171 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/postgres_connection_pool.hpp"
+
+#include <algorithm>
+#include <boost/format.hpp>
+#include <pqxx/nontransaction>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    const char *kPoolPsqlBroken = "Connection to PostgreSQL broken: %s";
+    const char *kPoolExhausted =
+        "No PostgreSQL connection was released in %d ms";
+
+    const size_t PostgresConnectionPool::kDefaultSize;
+    const std::chrono::milliseconds PostgresConnectionPool::kDefaultTimeout{
+        5000};
+
+    expected::Result<std::shared_ptr<PostgresConnectionPool>, std::string>
+    PostgresConnectionPool::create(std::string postgres_options,
+                                   size_t size,
+                                   std::chrono::milliseconds timeout) {
+      std::vector<std::unique_ptr<pqxx::lazyconnection>> connections;
+      std::string error;
+      for (size_t i = 0; i < size; ++i) {
+        auto connected = connect(postgres_options)
+                             .match(
+                                 [&](expected::Value<std::unique_ptr<
+                                         pqxx::lazyconnection>> &connection) {
+                                   connections.push_back(
+                                       std::move(connection.value));
+                                   return true;
+                                 },
+                                 [&](expected::Error<std::string> &e) {
+                                   error = e.error;
+                                   return false;
+                                 });
+        if (not connected) {
+          return expected::makeError(error);
+        }
+      }
+      return expected::makeValue(std::shared_ptr<PostgresConnectionPool>(
+          new PostgresConnectionPool(std::move(postgres_options),
+                                     size,
+                                     timeout,
+                                     std::move(connections))));
+    }
+
+    PostgresConnectionPool::PostgresConnectionPool(
+        std::string postgres_options,
+        size_t size,
+        std::chrono::milliseconds timeout,
+        std::vector<std::unique_ptr<pqxx::lazyconnection>> connections)
+        : postgres_options_(std::move(postgres_options)),
+          size_(size),
+          timeout_(timeout),
+          idle_(std::move(connections)),
+          opened_(idle_.size()),
+          log_(logger::log("PostgresConnectionPool")) {}
+
+    expected::Result<std::unique_ptr<pqxx::lazyconnection>, std::string>
+    PostgresConnectionPool::connect(const std::string &postgres_options) {
+      auto connection =
+          std::make_unique<pqxx::lazyconnection>(postgres_options);
+      try {
+        connection->activate();
+      } catch (const pqxx::broken_connection &e) {
+        return expected::makeError(
+            (boost::format(kPoolPsqlBroken) % e.what()).str());
+      }
+      return expected::makeValue(std::move(connection));
+    }
+
+    expected::Result<PooledConnection, std::string>
+    PostgresConnectionPool::acquire() {
+      auto start = std::chrono::steady_clock::now();
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (not released_.wait_for(lock, timeout_, [this] {
+            return not idle_.empty() or opened_ < size_;
+          })) {
+        ++metrics_.timeouts;
+        return expected::makeError(
+            (boost::format(kPoolExhausted) % timeout_.count()).str());
+      }
+
+      auto wait = std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - start);
+      ++metrics_.acquired;
+      metrics_.total_wait += wait;
+      metrics_.max_wait = std::max(metrics_.max_wait, wait);
+      log_->debug("connection acquired in {} us", wait.count());
+
+      std::unique_ptr<pqxx::lazyconnection> connection;
+      if (not idle_.empty()) {
+        connection = std::move(idle_.back());
+        idle_.pop_back();
+      } else {
+        // previously dropped connection is reopened outside of the lock
+        ++opened_;
+        lock.unlock();
+        std::string error;
+        auto reopened = connect(postgres_options_)
+                            .match(
+                                [&](expected::Value<std::unique_ptr<
+                                        pqxx::lazyconnection>> &reopened) {
+                                  connection = std::move(reopened.value);
+                                  return true;
+                                },
+                                [&](expected::Error<std::string> &e) {
+                                  error = e.error;
+                                  return false;
+                                });
+        if (not reopened) {
+          lock.lock();
+          --opened_;
+          released_.notify_one();
+          return expected::makeError(error);
+        }
+      }
+
+      std::weak_ptr<PostgresConnectionPool> pool = shared_from_this();
+      return expected::makeValue(PooledConnection(
+          connection.release(), [pool](pqxx::lazyconnection *connection) {
+            std::unique_ptr<pqxx::lazyconnection> owned(connection);
+            if (auto alive = pool.lock()) {
+              alive->release(std::move(owned));
+            }
+          }));
+    }
+
+    void PostgresConnectionPool::release(
+        std::unique_ptr<pqxx::lazyconnection> connection) {
+      try {
+        pqxx::nontransaction reset(*connection, "ConnectionPoolReset");
+        reset.exec("RESET ALL;");
+      } catch (const std::exception &e) {
+        log_->warn("connection is dropped: {}", e.what());
+        connection.reset();
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (connection) {
+        idle_.push_back(std::move(connection));
+      } else {
+        --opened_;
+      }
+      released_.notify_one();
+    }
+
+    PostgresConnectionPool::Metrics PostgresConnectionPool::metrics() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return metrics_;
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,130 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_POSTGRES_CONNECTION_POOL_HPP
+#define IROHA_POSTGRES_CONNECTION_POOL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <pqxx/connection>
+#include <vector>
+
+#include "common/result.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Connection borrowed from the pool, which is returned back on destruction
+     */
+    using PooledConnection =
+        std::unique_ptr<pqxx::lazyconnection,
+                        std::function<void(pqxx::lazyconnection *)>>;
+
+    /**
+     * Bounded pool of PostgreSQL connections.
+     * Connections are opened on creation of the pool and are reused by
+     * temporary wsv and mutable storage, so prepared statements of a
+     * connection outlive a single proposal or commit
+     */
+    class PostgresConnectionPool
+        : public std::enable_shared_from_this<PostgresConnectionPool> {
+     public:
+      static const size_t kDefaultSize = 4;
+      static const std::chrono::milliseconds kDefaultTimeout;
+
+      /**
+       * Time spent waiting for a connection
+       */
+      struct Metrics {
+        /// number of successful acquisitions
+        size_t acquired = 0;
+        /// number of acquisitions failed due to timeout
+        size_t timeouts = 0;
+        std::chrono::microseconds total_wait{0};
+        std::chrono::microseconds max_wait{0};
+      };
+
+      /**
+       * Create the pool and open all of its connections
+       * @param postgres_options postgres connection string
+       * @param size - maximal number of connections
+       * @param timeout - maximal time to wait for a released connection
+       * @return created pool, or error if connection can not be opened
+       */
+      static expected::Result<std::shared_ptr<PostgresConnectionPool>,
+                              std::string>
+      create(std::string postgres_options,
+             size_t size = kDefaultSize,
+             std::chrono::milliseconds timeout = kDefaultTimeout);
+
+      /**
+       * Take a connection from the pool. If all connections are in use, waits
+       * until one of them is returned
+       * @return connection, or error if no connection was returned in time
+       * or connection can not be reopened
+       */
+      expected::Result<PooledConnection, std::string> acquire();
+
+      /**
+       * @return wait time statistics of all acquisitions
+       */
+      Metrics metrics() const;
+
+     private:
+      PostgresConnectionPool(
+          std::string postgres_options,
+          size_t size,
+          std::chrono::milliseconds timeout,
+          std::vector<std::unique_ptr<pqxx::lazyconnection>> connections);
+
+      /**
+       * Open new connection with options of the pool
+       */
+      static expected::Result<std::unique_ptr<pqxx::lazyconnection>,
+                              std::string>
+      connect(const std::string &postgres_options);
+
+      /**
+       * Reset session state of the connection and put it back to the pool.
+       * Connection, which can not be reset, is closed and will be reopened
+       * on demand
+       */
+      void release(std::unique_ptr<pqxx::lazyconnection> connection);
+
+      const std::string postgres_options_;
+      const size_t size_;
+      const std::chrono::milliseconds timeout_;
+
+      std::vector<std::unique_ptr<pqxx::lazyconnection>> idle_;
+      /// number of open connections, both idle and acquired
+      size_t opened_;
+      Metrics metrics_;
+
+      mutable std::mutex mutex_;
+      std::condition_variable released_;
+
+      logger::Logger log_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_CONNECTION_POOL_HPP
@@ -28,14 +28,95 @@
 namespace iroha {
   namespace ametsuchi {
 
+    const std::string kInsertRole = "wsv_command_insert_role";
+    const std::string kInsertAccountRole = "wsv_command_insert_account_role";
+    const std::string kDeleteAccountRole = "wsv_command_delete_account_role";
+    const std::string kInsertRolePermission =
+        "wsv_command_insert_role_permission";
+    const std::string kInsertGrantablePermission =
+        "wsv_command_insert_grantable_permission";
+    const std::string kDeleteGrantablePermission =
+        "wsv_command_delete_grantable_permission";
+    const std::string kInsertAccount = "wsv_command_insert_account";
+    const std::string kInsertAsset = "wsv_command_insert_asset";
+    const std::string kUpsertAccountAsset = "wsv_command_upsert_account_asset";
+    const std::string kInsertSignatory = "wsv_command_insert_signatory";
+    const std::string kInsertAccountSignatory =
+        "wsv_command_insert_account_signatory";
+    const std::string kDeleteAccountSignatory =
+        "wsv_command_delete_account_signatory";
+    const std::string kDeleteSignatory = "wsv_command_delete_signatory";
+    const std::string kInsertPeer = "wsv_command_insert_peer";
+    const std::string kDeletePeer = "wsv_command_delete_peer";
+    const std::string kInsertDomain = "wsv_command_insert_domain";
+    const std::string kUpdateAccount = "wsv_command_update_account";
+    const std::string kSetAccountKV = "wsv_command_set_account_kv";
+
     PostgresWsvCommand::PostgresWsvCommand(pqxx::nontransaction &transaction)
         : transaction_(transaction),
-          execute_{makeExecuteResult(transaction_)} {}
+          execute_{makeExecutePreparedResult(transaction_)} {
+      prepareStatements(
+          transaction_,
+          {{kInsertRole, "INSERT INTO role(role_id) VALUES ($1);"},
+           {kInsertAccountRole,
+            "INSERT INTO account_has_roles(account_id, role_id) VALUES "
+            "($1, $2);"},
+           {kDeleteAccountRole,
+            "DELETE FROM account_has_roles WHERE account_id = $1 AND "
+            "role_id = $2;"},
+           {kInsertRolePermission,
+            "INSERT INTO role_has_permissions(role_id, permission_id) VALUES "
+            "($1, $2);"},
+           {kInsertGrantablePermission,
+            "INSERT INTO account_has_grantable_permissions("
+            "permittee_account_id, account_id, permission_id) VALUES "
+            "($1, $2, $3);"},
+           {kDeleteGrantablePermission,
+            "DELETE FROM account_has_grantable_permissions WHERE "
+            "permittee_account_id = $1 AND account_id = $2 AND "
+            "permission_id = $3;"},
+           {kInsertAccount,
+            "INSERT INTO account(account_id, domain_id, quorum, "
+            "transaction_count, data) VALUES ($1, $2, $3, $4, $5);"},
+           {kInsertAsset,
+            "INSERT INTO asset(asset_id, domain_id, \"precision\", data) "
+            "VALUES ($1, $2, $3, NULL);"},
+           {kUpsertAccountAsset,
+            "INSERT INTO account_has_asset(account_id, asset_id, amount) "
+            "VALUES ($1, $2, $3) ON CONFLICT (account_id, asset_id) DO "
+            "UPDATE SET amount = EXCLUDED.amount;"},
+           {kInsertSignatory,
+            "INSERT INTO signatory(public_key) VALUES ($1) ON CONFLICT DO "
+            "NOTHING;"},
+           {kInsertAccountSignatory,
+            "INSERT INTO account_has_signatory(account_id, public_key) "
+            "VALUES ($1, $2);"},
+           {kDeleteAccountSignatory,
+            "DELETE FROM account_has_signatory WHERE account_id = $1 AND "
+            "public_key = $2;"},
+           {kDeleteSignatory,
+            "DELETE FROM signatory WHERE public_key = $1 AND NOT EXISTS "
+            "(SELECT 1 FROM account_has_signatory WHERE public_key = $1) "
+            "AND NOT EXISTS (SELECT 1 FROM peer WHERE public_key = $1);"},
+           {kInsertPeer,
+            "INSERT INTO peer(public_key, address) VALUES ($1, $2);"},
+           {kDeletePeer,
+            "DELETE FROM peer WHERE public_key = $1 AND address = $2;"},
+           {kInsertDomain,
+            "INSERT INTO domain(domain_id, default_role) VALUES ($1, $2);"},
+           {kUpdateAccount,
+            "UPDATE account SET quorum = $1, transaction_count = $2 WHERE "
+            "account_id = $3;"},
+           {kSetAccountKV,
+            "UPDATE account SET data = jsonb_set(CASE WHEN data ? $1 THEN "
+            "data ELSE jsonb_set(data, ARRAY[$1::text], '{}') END, "
+            "ARRAY[$1::text, $2::text], to_jsonb($3::text)) WHERE "
+            "account_id = $4;"}});
+    }
 
     WsvCommandResult PostgresWsvCommand::insertRole(
         const std::string &role_name) {
-      auto result = execute_("INSERT INTO role(role_id) VALUES ("
-                             + transaction_.quote(role_name) + ");");
+      auto result = execute_(kInsertRole, role_name);
 
       auto message_gen = [&] {
         return (boost::format("failed to insert role: '%s'") % role_name).str();
@@ -46,10 +127,7 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertAccountRole(
         const std::string &account_id, const std::string &role_name) {
-      auto result =
-          execute_("INSERT INTO account_has_roles(account_id, role_id) VALUES ("
-                   + transaction_.quote(account_id) + ", "
-                   + transaction_.quote(role_name) + ");");
+      auto result = execute_(kInsertAccountRole, account_id, role_name);
 
       auto message_gen = [&] {
         return (boost::format("failed to insert account role, account: '%s', "
@@ -63,9 +141,7 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::deleteAccountRole(
         const std::string &account_id, const std::string &role_name) {
-      auto result = execute_("DELETE FROM account_has_roles WHERE account_id="
-                             + transaction_.quote(account_id) + "AND role_id="
-                             + transaction_.quote(role_name) + ";");
+      auto result = execute_(kDeleteAccountRole, account_id, role_name);
       auto message_gen = [&] {
         return (boost::format(
                     "failed to delete account role, account id: '%s', "
@@ -79,11 +155,6 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertRolePermissions(
         const std::string &role_id, const std::set<std::string> &permissions) {
-      auto entry = [this, &role_id](auto permission) {
-        return "(" + transaction_.quote(role_id) + ", "
-            + transaction_.quote(permission) + ")";
-      };
-
       // generate string with all permissions,
       // applying transform_func to each permission
       auto generate_perm_string = [&permissions](auto transform_func) {
@@ -95,9 +166,15 @@ namespace iroha {
                                });
       };
 
-      auto result = execute_(
-          "INSERT INTO role_has_permissions(role_id, permission_id) VALUES "
-          + generate_perm_string(entry) + ";");
+      // every permission is inserted by the same prepared statement,
+      // insertion stops at the first failure
+      expected::Result<pqxx::result, std::string> result =
+          expected::makeValue(pqxx::result());
+      for (const auto &permission : permissions) {
+        result = result | [&] {
+          return execute_(kInsertRolePermission, role_id, permission);
+        };
+      }
 
       auto message_gen = [&] {
         return (boost::format("failed to insert role permissions, role "
@@ -113,13 +190,10 @@ namespace iroha {
         const std::string &permittee_account_id,
         const std::string &account_id,
         const std::string &permission_id) {
-      auto result = execute_(
-          "INSERT INTO "
-          "account_has_grantable_permissions(permittee_account_id, "
-          "account_id, permission_id) VALUES ("
-          + transaction_.quote(permittee_account_id) + ", "
-          + transaction_.quote(account_id) + ", "
-          + transaction_.quote(permission_id) + ");");
+      auto result = execute_(kInsertGrantablePermission,
+                             permittee_account_id,
+                             account_id,
+                             permission_id);
 
       auto message_gen = [&] {
         return (boost::format("failed to insert account grantable permission, "
@@ -137,12 +211,10 @@ namespace iroha {
         const std::string &permittee_account_id,
         const std::string &account_id,
         const std::string &permission_id) {
-      auto result = execute_(
-          "DELETE FROM public.account_has_grantable_permissions WHERE "
-          "permittee_account_id="
-          + transaction_.quote(permittee_account_id)
-          + " AND account_id=" + transaction_.quote(account_id)
-          + " AND permission_id=" + transaction_.quote(permission_id) + " ;");
+      auto result = execute_(kDeleteGrantablePermission,
+                             permittee_account_id,
+                             account_id,
+                             permission_id);
 
       auto message_gen = [&] {
         return (boost::format("failed to delete account grantable permission, "
@@ -158,16 +230,13 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertAccount(
         const model::Account &account) {
-      auto result = execute_(
-          "INSERT INTO account(account_id, domain_id, quorum, "
-          "transaction_count, data) VALUES ("
-          + transaction_.quote(account.account_id) + ", "
-          + transaction_.quote(account.domain_id) + ", "
-          + transaction_.quote(account.quorum)
-          + ", "
-          // Transaction counter
-          + transaction_.quote(default_tx_counter) + ", "
-          + transaction_.quote(account.json_data) + ");");
+      auto result = execute_(kInsertAccount,
+                             account.account_id,
+                             account.domain_id,
+                             account.quorum,
+                             // Transaction counter
+                             default_tx_counter,
+                             account.json_data);
 
       auto message_gen = [&] {
         return (boost::format("failed to insert account, "
@@ -187,13 +256,8 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertAsset(
         const model::Asset &asset) {
       uint32_t precision = asset.precision;
-      auto result = execute_(
-          "INSERT INTO asset(asset_id, domain_id, \"precision\", data) "
-          "VALUES ("
-          + transaction_.quote(asset.asset_id) + ", "
-          + transaction_.quote(asset.domain_id) + ", "
-          + transaction_.quote(precision) + ", " + /*asset.data*/ "NULL"
-          + ");");
+      auto result =
+          execute_(kInsertAsset, asset.asset_id, asset.domain_id, precision);
 
       auto message_gen = [&] {
         return (boost::format("failed to insert asset, asset id: '%s', "
@@ -207,14 +271,10 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::upsertAccountAsset(
         const model::AccountAsset &asset) {
-      auto result = execute_(
-            "INSERT INTO account_has_asset(account_id, asset_id, amount) "
-            "VALUES ("
-            + transaction_.quote(asset.account_id) + ", "
-            + transaction_.quote(asset.asset_id) + ", "
-            + transaction_.quote(asset.balance.to_string())
-            + ") ON CONFLICT (account_id, asset_id) DO UPDATE SET "
-            "amount = EXCLUDED.amount;");
+      auto result = execute_(kUpsertAccountAsset,
+                             asset.account_id,
+                             asset.asset_id,
+                             asset.balance.to_string());
 
       auto message_gen = [&] {
         return (boost::format("failed to upsert account, account id: '%s', "
@@ -228,10 +288,9 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertSignatory(
         const pubkey_t &signatory) {
-      auto result = execute_("INSERT INTO signatory(public_key) VALUES ("
-                             + transaction_.quote(pqxx::binarystring(
-                                   signatory.data(), signatory.size()))
-                             + ") ON CONFLICT DO NOTHING;");
+      auto result = execute_(
+          kInsertSignatory,
+          pqxx::binarystring(signatory.data(), signatory.size()));
 
       auto message_gen = [&] {
         return (boost::format("failed to insert signatory, signatory hex string: '%s'")
@@ -244,11 +303,9 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertAccountSignatory(
         const std::string &account_id, const pubkey_t &signatory) {
       auto result = execute_(
-          "INSERT INTO account_has_signatory(account_id, public_key) VALUES ("
-          + transaction_.quote(account_id) + ", "
-          + transaction_.quote(
-                pqxx::binarystring(signatory.data(), signatory.size()))
-          + ");");
+          kInsertAccountSignatory,
+          account_id,
+          pqxx::binarystring(signatory.data(), signatory.size()));
 
       auto message_gen = [&] {
         return (boost::format("failed to insert account signatory, account id: "
@@ -261,12 +318,10 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::deleteAccountSignatory(
         const std::string &account_id, const pubkey_t &signatory) {
-      auto result =
-          execute_("DELETE FROM account_has_signatory WHERE account_id = "
-                   + transaction_.quote(account_id) + " AND public_key = "
-                   + transaction_.quote(
-                         pqxx::binarystring(signatory.data(), signatory.size()))
-                   + ";");
+      auto result = execute_(
+          kDeleteAccountSignatory,
+          account_id,
+          pqxx::binarystring(signatory.data(), signatory.size()));
 
       auto message_gen = [&] {
         return (boost::format("failed to delete account signatory, account id: "
@@ -279,14 +334,9 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::deleteSignatory(
         const pubkey_t &signatory) {
-      pqxx::binarystring public_key(signatory.data(), signatory.size());
-      auto result = execute_("DELETE FROM signatory WHERE public_key = "
-                    + transaction_.quote(public_key)
-                    + " AND NOT EXISTS (SELECT 1 FROM account_has_signatory "
-                        "WHERE public_key = "
-                    + transaction_.quote(public_key)
-                    + ") AND NOT EXISTS (SELECT 1 FROM peer WHERE public_key = "
-                    + transaction_.quote(public_key) + ");");
+      auto result = execute_(
+          kDeleteSignatory,
+          pqxx::binarystring(signatory.data(), signatory.size()));
 
       auto message_gen = [&] {
         return (boost::format("failed to delete signatory, signatory hex string: '%s'")
@@ -297,10 +347,10 @@ namespace iroha {
     }
 
     WsvCommandResult PostgresWsvCommand::insertPeer(const model::Peer &peer) {
-      auto result = execute_("INSERT INTO peer(public_key, address) VALUES ("
-                             + transaction_.quote(pqxx::binarystring(
-                                   peer.pubkey.data(), peer.pubkey.size()))
-                             + ", " + transaction_.quote(peer.address) + ");");
+      auto result = execute_(
+          kInsertPeer,
+          pqxx::binarystring(peer.pubkey.data(), peer.pubkey.size()),
+          peer.address);
 
       auto message_gen = [&] {
         return (boost::format(
@@ -312,11 +362,10 @@ namespace iroha {
     }
 
     WsvCommandResult PostgresWsvCommand::deletePeer(const model::Peer &peer) {
-      auto result = execute_("DELETE FROM peer WHERE public_key = "
-                             + transaction_.quote(pqxx::binarystring(
-                                   peer.pubkey.data(), peer.pubkey.size()))
-                             + " AND address = "
-                             + transaction_.quote(peer.address) + ";");
+      auto result = execute_(
+          kDeletePeer,
+          pqxx::binarystring(peer.pubkey.data(), peer.pubkey.size()),
+          peer.address);
 
       auto message_gen = [&] {
         return (boost::format(
@@ -330,9 +379,7 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertDomain(
         const model::Domain &domain) {
       auto result =
-          execute_("INSERT INTO domain(domain_id, default_role) VALUES ("
-                   + transaction_.quote(domain.domain_id) + ", "
-                   + transaction_.quote(domain.default_role) + ");");
+          execute_(kInsertDomain, domain.domain_id, domain.default_role);
 
       auto message_gen = [&] {
         return (boost::format("failed to insert domain, domain id: '%s', "
@@ -345,15 +392,10 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::updateAccount(
         const model::Account &account) {
-      auto result = execute_(
-            "UPDATE account\n"
-            "   SET quorum=" +
-            transaction_.quote(account.quorum) +
-            ", transaction_count=" +
-            /*account.transaction_count*/ transaction_.quote(default_tx_counter) +
-            "\n"
-            " WHERE account_id=" +
-            transaction_.quote(account.account_id) + ";");
+      auto result = execute_(kUpdateAccount,
+                             account.quorum,
+                             /*account.transaction_count*/ default_tx_counter,
+                             account.account_id);
 
       auto message_gen = [&] {
         return (boost::format(
@@ -369,15 +411,10 @@ namespace iroha {
         const std::string &creator_account_id,
         const std::string &key,
         const std::string &val) {
-      auto result = execute_(
-          "UPDATE account SET data = jsonb_set(CASE WHEN data ?"
-          + transaction_.quote(creator_account_id)
-          + " THEN data ELSE jsonb_set(data, "
-          + transaction_.quote("{" + creator_account_id + "}") + ","
-          + transaction_.quote("{}") + ") END,"
-          + transaction_.quote("{" + creator_account_id + ", " + key + "}")
-          + "," + transaction_.quote("\"" + val + "\"")
-          + ") WHERE account_id=" + transaction_.quote(account_id) + ";");
+      // path and value are bound as text, so quotes, commas and braces in
+      // them are not parsed as array or json literals
+      auto result =
+          execute_(kSetAccountKV, creator_account_id, key, val, account_id);
 
       auto message_gen = [&] {
         return (boost::format(
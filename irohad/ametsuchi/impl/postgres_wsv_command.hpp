@@ -84,7 +84,7 @@ namespace iroha {
 
       pqxx::nontransaction &transaction_;
 
-      using ExecuteType = decltype(makeExecuteResult(transaction_));
+      using ExecuteType = decltype(makeExecutePreparedResult(transaction_));
       ExecuteType execute_;
 
       /**
@@ -20,7 +20,10 @@
 
 #include <boost/optional.hpp>
 #include <pqxx/nontransaction>
+#include <pqxx/prepared_statement>
 #include <pqxx/result>
+#include <utility>
+#include <vector>
 #include "common/result.hpp"
 #include "logger/logger.hpp"
 
@@ -66,6 +69,88 @@ namespace iroha {
       };
     }
 
+    /// Prepared statement: its name and SQL with $n placeholders
+    using PreparedStatement = std::pair<std::string, std::string>;
+
+    /**
+     * Prepare statements on the connection of provided transaction.
+     * Statement with the same name and SQL can be prepared several times,
+     * Postgres parses and plans it once per connection, on first execution
+     * @param transaction whose connection is used
+     * @param statements to prepare
+     */
+    inline void prepareStatements(
+        pqxx::nontransaction &transaction,
+        const std::vector<PreparedStatement> &statements) {
+      for (const auto &statement : statements) {
+        transaction.conn().prepare(statement.first, statement.second);
+      }
+    }
+
+    /**
+     * Bind parameters to invocation of prepared statement.
+     * Binary strings are passed in binary format
+     * @param invocation of prepared statement
+     * @return invocation with all parameters bound
+     */
+    inline pqxx::prepare::invocation &bindParameters(
+        pqxx::prepare::invocation &invocation) {
+      return invocation;
+    }
+
+    template <typename T, typename... Args>
+    pqxx::prepare::invocation &bindParameters(
+        pqxx::prepare::invocation &invocation,
+        const T &parameter,
+        const Args &... parameters) {
+      return bindParameters(invocation(parameter), parameters...);
+    }
+
+    /**
+     * Return function which can execute prepared statements with given
+     * parameters on provided transaction
+     * @param transaction on which to apply statement.
+     * @return Result with pqxx::result in value case, or exception message
+     * if exception was caught
+     */
+    inline auto makeExecutePreparedResult(
+        pqxx::nontransaction &transaction) noexcept {
+      return [&](const std::string &statement,
+                 const auto &... parameters) noexcept
+          ->expected::Result<pqxx::result, std::string> {
+        try {
+          auto invocation = transaction.prepared(statement);
+          return expected::makeValue(
+              bindParameters(invocation, parameters...).exec());
+        } catch (const std::exception &e) {
+          return expected::makeError(e.what());
+        }
+      };
+    }
+
+    /**
+     * Return function which can execute prepared statements with given
+     * parameters on provided transaction
+     * @param transaction on which to apply statement.
+     * @param logger is used to report an error.
+     * @return nonstd::optional with pqxx::result in successful case, or nullopt
+     * if exception was caught
+     */
+    inline auto makeExecutePreparedOptional(pqxx::nontransaction &transaction,
+                                            logger::Logger &logger) noexcept {
+      return [&](const std::string &statement,
+                 const auto &... parameters) noexcept
+          ->boost::optional<pqxx::result> {
+        try {
+          auto invocation = transaction.prepared(statement);
+          return bindParameters(invocation, parameters...).exec();
+        } catch (const std::exception &e) {
+          logger->error(e.what());
+          return boost::none;
+        }
+      };
+    }
+
     /**
      * Transforms pqxx::result to vector of Ts by applying transform_func
      * @tparam T - type to transform to
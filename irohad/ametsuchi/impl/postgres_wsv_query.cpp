@@ -33,34 +33,64 @@ namespace iroha {
     const std::string kAccountId = "account_id";
     const std::string kDomainId = "domain_id";
 
+    const std::string kHasGrantablePermission =
+        "wsv_query_has_grantable_permission";
+    const std::string kGetAccountRoles = "wsv_query_get_account_roles";
+    const std::string kGetRolePermissions = "wsv_query_get_role_permissions";
+    const std::string kGetRoles = "wsv_query_get_roles";
+    const std::string kGetAccount = "wsv_query_get_account";
+    const std::string kGetAccountDetail = "wsv_query_get_account_detail";
+    const std::string kGetSignatories = "wsv_query_get_signatories";
+    const std::string kGetAsset = "wsv_query_get_asset";
+    const std::string kGetAccountAsset = "wsv_query_get_account_asset";
+    const std::string kGetDomain = "wsv_query_get_domain";
+    const std::string kGetPeers = "wsv_query_get_peers";
+
     PostgresWsvQuery::PostgresWsvQuery(pqxx::nontransaction &transaction)
         : transaction_(transaction),
           log_(logger::log("PostgresWsvQuery")),
-          execute_{makeExecuteOptional
-                       (transaction_, log_)} {}
+          execute_{makeExecutePreparedOptional(transaction_, log_)} {
+      prepareStatements(
+          transaction_,
+          {{kHasGrantablePermission,
+            "SELECT * FROM account_has_grantable_permissions WHERE "
+            "permittee_account_id = $1 AND account_id = $2 AND "
+            "permission_id = $3;"},
+           {kGetAccountRoles,
+            "SELECT role_id FROM account_has_roles WHERE account_id = $1;"},
+           {kGetRolePermissions,
+            "SELECT permission_id FROM role_has_permissions WHERE "
+            "role_id = $1;"},
+           {kGetRoles, "SELECT role_id FROM role;"},
+           {kGetAccount, "SELECT * FROM account WHERE account_id = $1;"},
+           {kGetAccountDetail,
+            "SELECT data#>>ARRAY[$1::text, $2::text] FROM account WHERE "
+            "account_id = $3;"},
+           {kGetSignatories,
+            "SELECT public_key FROM account_has_signatory WHERE "
+            "account_id = $1;"},
+           {kGetAsset, "SELECT * FROM asset WHERE asset_id = $1;"},
+           {kGetAccountAsset,
+            "SELECT * FROM account_has_asset WHERE account_id = $1 AND "
+            "asset_id = $2;"},
+           {kGetDomain, "SELECT * FROM domain WHERE domain_id = $1;"},
+           {kGetPeers, "SELECT * FROM peer;"}});
+    }
 
     bool PostgresWsvQuery::hasAccountGrantablePermission(
         const std::string &permitee_account_id,
         const std::string &account_id,
         const std::string &permission_id) {
-      return execute_(
-                 "SELECT * FROM account_has_grantable_permissions WHERE "
-                 "permittee_account_id = "
-                 + transaction_.quote(permitee_account_id)
-                 + " AND account_id = "
-                 + transaction_.quote(account_id)
-                 + " AND permission_id = "
-                 + transaction_.quote(permission_id)
-                 + ";")
+      return execute_(kHasGrantablePermission,
+                      permitee_account_id,
+                      account_id,
+                      permission_id)
           | [](const auto &result) { return result.size() == 1; };
     }
 
     nonstd::optional<std::vector<std::string>>
     PostgresWsvQuery::getAccountRoles(const std::string &account_id) {
-      return execute_(
-                 "SELECT role_id FROM account_has_roles WHERE account_id = "
-                 + transaction_.quote(account_id)
-                 + ";")
+      return execute_(kGetAccountRoles, account_id)
           | [&](const auto &result) {
               return transform<std::string>(result, [](const auto &row) {
                 return row.at(kRoleId).c_str();
@@ -70,11 +100,7 @@ namespace iroha {
 
     nonstd::optional<std::vector<std::string>>
     PostgresWsvQuery::getRolePermissions(const std::string &role_name) {
-      return execute_(
-                 "SELECT permission_id FROM role_has_permissions WHERE role_id "
-                 "= "
-                 + transaction_.quote(role_name)
-                 + ";")
+      return execute_(kGetRolePermissions, role_name)
           | [&](const auto &result) {
               return transform<std::string>(result, [](const auto &row) {
                 return row.at("permission_id").c_str();
@@ -83,7 +109,7 @@ namespace iroha {
     }
 
     nonstd::optional<std::vector<std::string>> PostgresWsvQuery::getRoles() {
-      return execute_("SELECT role_id FROM role;") | [&](const auto &result) {
+      return execute_(kGetRoles) | [&](const auto &result) {
         return transform<std::string>(
             result, [](const auto &row) { return row.at(kRoleId).c_str(); });
       };
@@ -91,9 +117,7 @@ namespace iroha {
 
     nonstd::optional<model::Account> PostgresWsvQuery::getAccount(
         const std::string &account_id) {
-      return execute_("SELECT * FROM account WHERE account_id = "
-                      + transaction_.quote(account_id)
-                      + ";")
+      return execute_(kGetAccount, account_id)
                  | [&](const auto &result) -> nonstd::optional<model::Account> {
         if (result.empty()) {
           log_->info(kAccountNotFound, account_id);
@@ -113,12 +137,7 @@ namespace iroha {
         const std::string &account_id,
         const std::string &creator_account_id,
         const std::string &detail) {
-      return execute_("SELECT data#>>"
-                      + transaction_.quote(
-                            "{" + creator_account_id + ", " + detail + "}")
-                      + " FROM account WHERE account_id = "
-                      + transaction_.quote(account_id)
-                      + ";")
+      return execute_(kGetAccountDetail, creator_account_id, detail, account_id)
                  | [&](const auto &result) -> nonstd::optional<std::string> {
         if (result.empty()) {
           log_->info(kAccountNotFound, account_id);
@@ -138,11 +157,7 @@ namespace iroha {
 
     nonstd::optional<std::vector<pubkey_t>> PostgresWsvQuery::getSignatories(
         const std::string &account_id) {
-      return execute_(
-                 "SELECT public_key FROM account_has_signatory WHERE "
-                 "account_id = "
-                 + transaction_.quote(account_id)
-                 + ";")
+      return execute_(kGetSignatories, account_id)
           |
           [&](const auto &result) {
             return transform<pubkey_t>(result, [&](const auto &row) {
@@ -157,10 +172,7 @@ namespace iroha {
 
     nonstd::optional<model::Asset> PostgresWsvQuery::getAsset(
         const std::string &asset_id) {
-      pqxx::result result;
-      return execute_("SELECT * FROM asset WHERE asset_id = "
-                      + transaction_.quote(asset_id)
-                      + ";")
+      return execute_(kGetAsset, asset_id)
                  | [&](const auto &result) -> nonstd::optional<model::Asset> {
         if (result.empty()) {
           log_->info("Asset {} not found", asset_id);
@@ -179,11 +191,7 @@ namespace iroha {
 
     nonstd::optional<model::AccountAsset> PostgresWsvQuery::getAccountAsset(
         const std::string &account_id, const std::string &asset_id) {
-      return execute_("SELECT * FROM account_has_asset WHERE account_id = "
-                      + transaction_.quote(account_id)
-                      + " AND asset_id = "
-                      + transaction_.quote(asset_id)
-                      + ";")
+      return execute_(kGetAccountAsset, account_id, asset_id)
                  | [&](const auto &result)
                  -> nonstd::optional<model::AccountAsset> {
         if (result.empty()) {
@@ -203,9 +211,7 @@ namespace iroha {
 
     nonstd::optional<model::Domain> PostgresWsvQuery::getDomain(
         const std::string &domain_id) {
-      return execute_("SELECT * FROM domain WHERE domain_id = "
-                      + transaction_.quote(domain_id)
-                      + ";")
+      return execute_(kGetDomain, domain_id)
                  | [&](const auto &result) -> nonstd::optional<model::Domain> {
         if (result.empty()) {
           log_->info("Domain {} not found", domain_id);
@@ -220,8 +226,7 @@ namespace iroha {
     }
 
     nonstd::optional<std::vector<model::Peer>> PostgresWsvQuery::getPeers() {
-      pqxx::result result;
-      return execute_("SELECT * FROM peer;") | [&](const auto &result) {
+      return execute_(kGetPeers) | [&](const auto &result) {
         return transform<model::Peer>(result, [](const auto &row) {
           model::Peer peer;
           pqxx::binarystring public_key_str(row.at(kPublicKey));
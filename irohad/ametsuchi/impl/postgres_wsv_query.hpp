@@ -58,7 +58,8 @@ namespace iroha {
       pqxx::nontransaction &transaction_;
       logger::Logger log_;
 
-      using ExecuteType = decltype(makeExecuteOptional(transaction_, log_));
+      using ExecuteType =
+          decltype(makeExecutePreparedOptional(transaction_, log_));
       ExecuteType execute_;
     };
   }  // namespace ametsuchi
@@ -17,15 +17,18 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include "ametsuchi/impl/cached_wsv_query.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"  // for FlatFile
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
-#include "model/converters/json_common.hpp"
+#include "model/converters/pb_common.hpp"
 #include "model/execution/command_executor_factory.hpp"  // for CommandExecutorFactory
 #include "postgres_ordering_service_persistent_state.hpp"
 
+#include <algorithm>
 #include <boost/format.hpp>
 
 namespace iroha {
@@ -34,14 +37,17 @@ namespace iroha {
     const char *kCommandExecutorError = "Cannot create CommandExecutorFactory";
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
+    const size_t kIndexBatchSize = 1000;
 
     ConnectionContext::ConnectionContext(
         std::unique_ptr<FlatFile> block_store,
         std::unique_ptr<pqxx::lazyconnection> pg_lazy,
-        std::unique_ptr<pqxx::nontransaction> pg_nontx)
+        std::unique_ptr<pqxx::nontransaction> pg_nontx,
+        std::shared_ptr<PostgresConnectionPool> pg_pool)
         : block_store(std::move(block_store)),
           pg_lazy(std::move(pg_lazy)),
-          pg_nontx(std::move(pg_nontx)) {}
+          pg_nontx(std::move(pg_nontx)),
+          pg_pool(std::move(pg_pool)) {}
 
     StorageImpl::~StorageImpl() {
       wsv_transaction_->commit();
@@ -54,61 +60,106 @@ namespace iroha {
         std::string postgres_options,
         std::unique_ptr<FlatFile> block_store,
         std::unique_ptr<pqxx::lazyconnection> wsv_connection,
-        std::unique_ptr<pqxx::nontransaction> wsv_transaction)
+        std::unique_ptr<pqxx::nontransaction> wsv_transaction,
+        std::shared_ptr<PostgresConnectionPool> connection_pool,
+        std::shared_ptr<model::CommandExecutorFactory> command_executors)
         : block_store_dir_(std::move(block_store_dir)),
           postgres_options_(std::move(postgres_options)),
           block_store_(std::move(block_store)),
           wsv_connection_(std::move(wsv_connection)),
           wsv_transaction_(std::move(wsv_transaction)),
-          wsv_(std::make_shared<PostgresWsvQuery>(*wsv_transaction_)),
+          connection_pool_(std::move(connection_pool)),
+          command_executors_(std::move(command_executors)),
+          wsv_cache_(std::make_shared<WsvCache>()),
+          wsv_(std::make_shared<CachedWsvQuery>(
+              std::make_unique<PostgresWsvQuery>(*wsv_transaction_),
+              wsv_cache_)),
           blocks_(std::make_shared<PostgresBlockQuery>(*wsv_transaction_,
                                                        *block_store_)) {
       log_ = logger::log("StorageImpl");
 
       wsv_transaction_->exec(init_);
+      indexBlockHashes();
       wsv_transaction_->exec(
           "SET SESSION CHARACTERISTICS AS TRANSACTION READ ONLY;");
     }
 
-    expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
-    StorageImpl::createTemporaryWsv() {
-      auto command_executors = model::CommandExecutorFactory::create();
-      if (not command_executors.has_value()) {
-        return expected::makeError(kCommandExecutorError);
+    void StorageImpl::indexBlockHashes() {
+      auto hash_of = [this](auto height) -> nonstd::optional<hash256_t> {
+        auto view = block_store_->view(height);
+        protocol::Block block;
+        if (not view or not block.ParseFromArray(view->data, view->size)) {
+          log_->error("Cannot read block {} from block store", height);
+          return nonstd::nullopt;
+        }
+        return iroha::hash(block);
+      };
+
+      // blocks are indexed all at once, so the first one is the marker
+      auto last_id = block_store_->last_id();
+      if (last_id == 0) {
+        return;
+      }
+      auto first_hash = hash_of(1);
+      if (not first_hash or blocks_->getProtoBlockByHashSync(*first_hash)) {
+        return;
       }
 
-      auto postgres_connection =
-          std::make_unique<pqxx::lazyconnection>(postgres_options_);
-      try {
-        postgres_connection->activate();
-      } catch (const pqxx::broken_connection &e) {
-        return expected::makeError(
-            (boost::format(kPsqlBroken) % e.what()).str());
+      log_->info("Index hashes of {} blocks", last_id);
+      PostgresBlockIndex block_index(*wsv_transaction_);
+      std::vector<std::pair<hash256_t, uint64_t>> hashes;
+      wsv_transaction_->exec("BEGIN;");
+      for (decltype(last_id) height = 1; height <= last_id; ++height) {
+        auto hash = hash_of(height);
+        if (not hash) {
+          wsv_transaction_->exec("ROLLBACK;");
+          return;
+        }
+        hashes.emplace_back(*hash, height);
+        if (hashes.size() == kIndexBatchSize or height == last_id) {
+          if (not block_index.indexBlockHashes(hashes)) {
+            wsv_transaction_->exec("ROLLBACK;");
+            return;
+          }
+          hashes.clear();
+        }
       }
-      auto wsv_transaction =
-          std::make_unique<pqxx::nontransaction>(*postgres_connection, kTmpWsv);
+      wsv_transaction_->exec("COMMIT;");
+    }
 
-      return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
-          std::make_unique<TemporaryWsvImpl>(
-              std::move(postgres_connection),
-              std::move(wsv_transaction),
-              std::move(command_executors.value())));
+    expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+    StorageImpl::createTemporaryWsv() {
+      expected::Result<std::unique_ptr<TemporaryWsv>, std::string> wsv;
+      connection_pool_->acquire().match(
+          [&](expected::Value<PooledConnection> &connection) {
+            auto wsv_transaction = std::make_unique<pqxx::nontransaction>(
+                *connection.value, kTmpWsv);
+            wsv = expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+                std::make_unique<TemporaryWsvImpl>(std::move(connection.value),
+                                                   std::move(wsv_transaction),
+                                                   command_executors_,
+                                                   wsv_cache_));
+          },
+          [&](expected::Error<std::string> &error) { wsv = error; });
+      return wsv;
     }
 
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
     StorageImpl::createMutableStorage() {
-      auto command_executors = model::CommandExecutorFactory::create();
-      if (not command_executors.has_value()) {
-        return expected::makeError(kCommandExecutorError);
-      }
-
-      auto postgres_connection =
-          std::make_unique<pqxx::lazyconnection>(postgres_options_);
-      try {
-        postgres_connection->activate();
-      } catch (const pqxx::broken_connection &e) {
-        return expected::makeError(
-            (boost::format(kPsqlBroken) % e.what()).str());
+      expected::Result<PooledConnection, std::string> connection =
+          connection_pool_->acquire();
+      PooledConnection postgres_connection;
+      std::string error;
+      if (not connection.match(
+              [&](expected::Value<PooledConnection> &connection) {
+                postgres_connection = std::move(connection.value);
+                return true;
+              },
+              [&](expected::Error<std::string> &e) {
+                error = e.error;
+                return false;
+              })) {
+        return expected::makeError(error);
       }
       auto wsv_transaction =
           std::make_unique<pqxx::nontransaction>(*postgres_connection, kTmpWsv);
@@ -125,7 +176,8 @@ namespace iroha {
               top_hash.value_or(hash256_t{}),
               std::move(postgres_connection),
               std::move(wsv_transaction),
-              std::move(command_executors.value())));
+              command_executors_,
+              wsv_cache_));
     }
 
     bool StorageImpl::insertBlock(model::Block block) {
@@ -141,7 +193,7 @@ namespace iroha {
                                         auto &query,
                                         const auto &top_hash) { return true; });
             log_->info("block inserted: {}", inserted);
-            commit(std::move(storage.value));
+            inserted = commit(std::move(storage.value)) and inserted;
           },
           [&](expected::Error<std::string> &error) {
             log_->error(error.error);
@@ -180,15 +232,19 @@ DROP TABLE IF EXISTS index_by_id_height_asset;
       pqxx::work init_txn(connection);
       init_txn.exec(init_);
       init_txn.commit();
+      wsv_cache_->invalidate();
 
       // erase blocks
       log_->info("drop block store");
-      block_store_->dropAll();
+      if (not block_store_->dropAll()) {
+        log_->error("Cannot drop block store");
+      }
     }
 
     expected::Result<ConnectionContext, std::string>
     StorageImpl::initConnections(std::string block_store_dir,
-                                 std::string postgres_options) {
+                                 std::string postgres_options,
+                                 size_t pool_size) {
       auto log_ = logger::log("StorageImpl:initConnection");
       log_->info("Start storage creation");
 
@@ -214,16 +270,34 @@ DROP TABLE IF EXISTS index_by_id_height_asset;
           *postgres_connection, "Storage");
       log_->info("transaction to PostgreSQL initialized");
 
-      return expected::makeValue(
-          ConnectionContext(std::move(*block_store),
-                            std::move(postgres_connection),
-                            std::move(wsv_transaction)));
+      using ContextResult = expected::Result<ConnectionContext, std::string>;
+      return PostgresConnectionPool::create(postgres_options, pool_size)
+          .match(
+              [&](expected::Value<std::shared_ptr<PostgresConnectionPool>>
+                      &pool) -> ContextResult {
+                log_->info("connection pool of size {} created", pool_size);
+                return expected::makeValue(
+                    ConnectionContext(std::move(*block_store),
+                                      std::move(postgres_connection),
+                                      std::move(wsv_transaction),
+                                      std::move(pool.value)));
+              },
+              [](expected::Error<std::string> &error) -> ContextResult {
+                return error;
+              });
     }
 
     expected::Result<std::shared_ptr<StorageImpl>, std::string>
     StorageImpl::create(std::string block_store_dir,
-                        std::string postgres_options) {
-      auto ctx_result = initConnections(block_store_dir, postgres_options);
+                        std::string postgres_options,
+                        size_t pool_size) {
+      auto command_executors = model::CommandExecutorFactory::create();
+      if (not command_executors.has_value()) {
+        return expected::makeError(kCommandExecutorError);
+      }
+
+      auto ctx_result =
+          initConnections(block_store_dir, postgres_options, pool_size);
       expected::Result<std::shared_ptr<StorageImpl>, std::string> storage;
       ctx_result.match(
           [&](expected::Value<ConnectionContext> &ctx) {
@@ -232,24 +306,40 @@ DROP TABLE IF EXISTS index_by_id_height_asset;
                                 postgres_options,
                                 std::move(ctx.value.block_store),
                                 std::move(ctx.value.pg_lazy),
-                                std::move(ctx.value.pg_nontx))));
+                                std::move(ctx.value.pg_nontx),
+                                std::move(ctx.value.pg_pool),
+                                std::move(command_executors.value()))));
           },
           [&](expected::Error<std::string> &error) { storage = error; });
       return storage;
     }
 
-    void StorageImpl::commit(std::unique_ptr<MutableStorage> mutableStorage) {
+    bool StorageImpl::commit(std::unique_ptr<MutableStorage> mutableStorage) {
       std::unique_lock<std::shared_timed_mutex> write(rw_lock_);
       auto storage_ptr = std::move(mutableStorage);  // get ownership of storage
       auto storage = static_cast<MutableStorageImpl *>(storage_ptr.get());
-      for (const auto &block : storage->block_store_) {
-        block_store_->add(block.first,
-                          stringToBytes(model::converters::jsonToString(
-                              serializer_.serialize(block.second))));
+      auto last_id = block_store_->last_id();
+      auto stored = std::all_of(
+          storage->block_store_.begin(),
+          storage->block_store_.end(),
+          [this](const auto &block) {
+            return block_store_->add(
+                block.first,
+                stringToBytes(
+                    serializer_.serialize(block.second).SerializeAsString()));
+          });
+      // blocks of the whole batch reach the disk before wsv is committed
+      if (not stored or not block_store_->sync()) {
+        // wsv is rolled back when mutable storage is destroyed
+        log_->error("Cannot store blocks, rolling back to block {}", last_id);
+        block_store_->rollback(last_id);
+        return false;
       }
 
       storage->transaction_->exec("COMMIT;");
       storage->committed = true;
+      wsv_cache_->invalidate();
+      return true;
     }
 
     std::shared_ptr<WsvQuery> StorageImpl::getWsvQuery() const {
@@ -259,5 +349,14 @@ DROP TABLE IF EXISTS index_by_id_height_asset;
     std::shared_ptr<BlockQuery> StorageImpl::getBlockQuery() const {
       return blocks_;
     }
+
+    PostgresConnectionPool::Metrics StorageImpl::connectionPoolMetrics()
+        const {
+      return connection_pool_->metrics();
+    }
+
+    WsvCache::Metrics StorageImpl::wsvCacheMetrics() const {
+      return wsv_cache_->metrics();
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -24,10 +24,17 @@
 #include <nonstd/optional.hpp>
 #include <pqxx/pqxx>
 #include <shared_mutex>
+#include "ametsuchi/impl/postgres_connection_pool.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "logger/logger.hpp"
-#include "model/converters/json_block_factory.hpp"
+#include "model/converters/pb_block_factory.hpp"
 
 namespace iroha {
+
+  namespace model {
+    class CommandExecutorFactory;
+  }
+
   namespace ametsuchi {
 
     class FlatFile;
@@ -35,21 +42,35 @@ namespace iroha {
     struct ConnectionContext {
       ConnectionContext(std::unique_ptr<FlatFile> block_store,
                         std::unique_ptr<pqxx::lazyconnection> pg_lazy,
-                        std::unique_ptr<pqxx::nontransaction> pg_nontx);
+                        std::unique_ptr<pqxx::nontransaction> pg_nontx,
+                        std::shared_ptr<PostgresConnectionPool> pg_pool);
 
       std::unique_ptr<FlatFile> block_store;
       std::unique_ptr<pqxx::lazyconnection> pg_lazy;
       std::unique_ptr<pqxx::nontransaction> pg_nontx;
+      std::shared_ptr<PostgresConnectionPool> pg_pool;
     };
 
     class StorageImpl : public Storage {
      protected:
       static expected::Result<ConnectionContext, std::string> initConnections(
-          std::string block_store_dir, std::string postgres_options);
+          std::string block_store_dir,
+          std::string postgres_options,
+          size_t pool_size);
 
      public:
+      /**
+       * Create storage
+       * @param block_store_dir - folder with raw blocks
+       * @param postgres_connection - postgres connection string
+       * @param pool_size - number of connections kept open for temporary wsv
+       * and mutable storage
+       * @return created storage, or error message
+       */
       static expected::Result<std::shared_ptr<StorageImpl>, std::string> create(
-          std::string block_store_dir, std::string postgres_connection);
+          std::string block_store_dir,
+          std::string postgres_connection,
+          size_t pool_size = PostgresConnectionPool::kDefaultSize);
 
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
@@ -61,12 +82,24 @@ namespace iroha {
 
       virtual void dropStorage() override;
 
-      void commit(std::unique_ptr<MutableStorage> mutableStorage) override;
+      bool commit(std::unique_ptr<MutableStorage> mutableStorage) override;
 
       std::shared_ptr<WsvQuery> getWsvQuery() const override;
 
       std::shared_ptr<BlockQuery> getBlockQuery() const override;
 
+      /**
+       * @return wait time statistics of connections for temporary wsv and
+       * mutable storage
+       */
+      PostgresConnectionPool::Metrics connectionPoolMetrics() const;
+
+      /**
+       * @return hits and misses of the cache of accounts, roles and
+       * permissions
+       */
+      WsvCache::Metrics wsvCacheMetrics() const;
+
       ~StorageImpl() override;
 
      protected:
@@ -74,7 +107,16 @@ namespace iroha {
                   std::string postgres_options,
                   std::unique_ptr<FlatFile> block_store,
                   std::unique_ptr<pqxx::lazyconnection> wsv_connection,
-                  std::unique_ptr<pqxx::nontransaction> wsv_transaction);
+                  std::unique_ptr<pqxx::nontransaction> wsv_transaction,
+                  std::shared_ptr<PostgresConnectionPool> connection_pool,
+                  std::shared_ptr<model::CommandExecutorFactory>
+                      command_executors);
+
+      /**
+       * Record hashes of blocks from block store, which were committed
+       * before block hashes were indexed, so that blocks can be found by hash
+       */
+      void indexBlockHashes();
 
       /**
        * Folder with raw blocks
@@ -94,11 +136,26 @@ namespace iroha {
 
       std::unique_ptr<pqxx::nontransaction> wsv_transaction_;
 
+      /**
+       * Connections for temporary wsv and mutable storage
+       */
+      std::shared_ptr<PostgresConnectionPool> connection_pool_;
+
+      /**
+       * Stateless executors shared by all temporary wsvs and mutable storages
+       */
+      std::shared_ptr<model::CommandExecutorFactory> command_executors_;
+
+      /**
+       * Committed state read by all world state views, invalidated on commit
+       */
+      std::shared_ptr<WsvCache> wsv_cache_;
+
       std::shared_ptr<WsvQuery> wsv_;
 
       std::shared_ptr<BlockQuery> blocks_;
 
-      model::converters::JsonBlockFactory serializer_;
+      model::converters::PbBlockFactory serializer_;
 
       // Allows multiple readers and a single writer
       std::shared_timed_mutex rw_lock_;
@@ -169,24 +226,50 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
 );
 CREATE TABLE IF NOT EXISTS height_by_hash (
     hash bytea,
-    height text
+    height bigint
 );
 CREATE TABLE IF NOT EXISTS height_by_account_set (
     account_id text,
-    height text
+    height bigint
 );
 CREATE TABLE IF NOT EXISTS index_by_creator_height (
     id serial,
     creator_id text,
-    height text,
-    index text
+    height bigint,
+    index int
 );
 CREATE TABLE IF NOT EXISTS index_by_id_height_asset (
     id text,
-    height text,
+    height bigint,
     asset_id text,
-    index text
+    index int
 );
+DO $$
+BEGIN
+    -- migrate block index tables created with text heights and indexes
+    IF EXISTS (SELECT 1 FROM information_schema.columns
+               WHERE table_name = 'height_by_hash'
+               AND column_name = 'height' AND data_type = 'text') THEN
+        ALTER TABLE height_by_hash
+            ALTER COLUMN height TYPE bigint USING height::bigint;
+        ALTER TABLE height_by_account_set
+            ALTER COLUMN height TYPE bigint USING height::bigint;
+        ALTER TABLE index_by_creator_height
+            ALTER COLUMN height TYPE bigint USING height::bigint,
+            ALTER COLUMN index TYPE int USING index::int;
+        ALTER TABLE index_by_id_height_asset
+            ALTER COLUMN height TYPE bigint USING height::bigint,
+            ALTER COLUMN index TYPE int USING index::int;
+    END IF;
+END $$;
+CREATE INDEX IF NOT EXISTS height_by_hash_hash_index
+    ON height_by_hash (hash);
+CREATE INDEX IF NOT EXISTS height_by_account_set_account_id_height_index
+    ON height_by_account_set (account_id, height);
+CREATE INDEX IF NOT EXISTS index_by_creator_height_creator_id_height_index
+    ON index_by_creator_height (creator_id, height, index);
+CREATE INDEX IF NOT EXISTS index_by_id_height_asset_id_asset_id_height_index
+    ON index_by_id_height_asset (id, asset_id, height, index);
 )";
     };
   }  // namespace ametsuchi
@@ -16,8 +16,9 @@
  */
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
-#include "ametsuchi/impl/postgres_wsv_command.hpp"
+#include "ametsuchi/impl/cached_wsv_query.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_overlay.hpp"
 #include "amount/amount.hpp"
 #include "backend/protobuf/from_old_model.hpp"
 #include "model/execution/command_executor_factory.hpp"
@@ -25,13 +26,15 @@
 namespace iroha {
   namespace ametsuchi {
     TemporaryWsvImpl::TemporaryWsvImpl(
-        std::unique_ptr<pqxx::lazyconnection> connection,
+        PooledConnection connection,
         std::unique_ptr<pqxx::nontransaction> transaction,
-        std::shared_ptr<model::CommandExecutorFactory> command_executors)
+        std::shared_ptr<model::CommandExecutorFactory> command_executors,
+        std::shared_ptr<WsvCache> wsv_cache)
         : connection_(std::move(connection)),
           transaction_(std::move(transaction)),
-          wsv_(std::make_unique<PostgresWsvQuery>(*transaction_)),
-          executor_(std::make_unique<PostgresWsvCommand>(*transaction_)),
+          wsv_(std::make_unique<WsvOverlay>(std::make_unique<CachedWsvQuery>(
+              std::make_unique<PostgresWsvQuery>(*transaction_),
+              std::move(wsv_cache)))),
           command_executors_(std::move(command_executors)),
           log_(logger::log("TemporaryWSV")) {
       transaction_->exec("BEGIN;");
@@ -47,8 +50,7 @@ namespace iroha {
         if (not executor->validate(*command, *wsv_, tx_creator)) {
           return false;
         }
-        auto result =
-            executor->execute(*command, *wsv_, *executor_, tx_creator);
+        auto result = executor->execute(*command, *wsv_, *wsv_, tx_creator);
         return result.match(
             [](expected::Value<void> &v) { return true; },
             [this](expected::Error<iroha::model::ExecutionError> &e) {
@@ -57,7 +59,7 @@ namespace iroha {
             });
       };
 
-      transaction_->exec("SAVEPOINT savepoint_;");
+      wsv_->savepoint();
       auto commands =
           std::accumulate(tx.commands().begin(),
                           tx.commands().end(),
@@ -73,9 +75,9 @@ namespace iroha {
                           commands.end(),
                           execute_command);
       if (result) {
-        transaction_->exec("RELEASE SAVEPOINT savepoint_;");
+        wsv_->release();
       } else {
-        transaction_->exec("ROLLBACK TO SAVEPOINT savepoint_;");
+        wsv_->rollback();
       }
       return result;
     }
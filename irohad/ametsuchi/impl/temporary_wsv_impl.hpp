@@ -18,10 +18,11 @@
 #ifndef IROHA_TEMPORARY_WSV_IMPL_HPP
 #define IROHA_TEMPORARY_WSV_IMPL_HPP
 
-#include <pqxx/connection>
 #include <pqxx/nontransaction>
 
 #include "ametsuchi/temporary_wsv.hpp"
+#include "ametsuchi/impl/postgres_connection_pool.hpp"
+#include "ametsuchi/impl/wsv_cache.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -31,12 +32,16 @@ namespace iroha {
   }
 
   namespace ametsuchi {
+
+    class WsvOverlay;
+
     class TemporaryWsvImpl : public TemporaryWsv {
      public:
       TemporaryWsvImpl(
-          std::unique_ptr<pqxx::lazyconnection> connection,
+          PooledConnection connection,
           std::unique_ptr<pqxx::nontransaction> transaction,
-          std::shared_ptr<model::CommandExecutorFactory> command_executors);
+          std::shared_ptr<model::CommandExecutorFactory> command_executors,
+          std::shared_ptr<WsvCache> wsv_cache);
 
       bool apply(
           const shared_model::interface::Transaction &,
@@ -46,10 +51,10 @@ namespace iroha {
       ~TemporaryWsvImpl() override;
 
      private:
-      std::unique_ptr<pqxx::lazyconnection> connection_;
+      PooledConnection connection_;
       std::unique_ptr<pqxx::nontransaction> transaction_;
-      std::unique_ptr<WsvQuery> wsv_;
-      std::unique_ptr<WsvCommand> executor_;
+      /// changes of validated transactions, which are never written
+      std::unique_ptr<WsvOverlay> wsv_;
       std::shared_ptr<model::CommandExecutorFactory> command_executors_;
 
       logger::Logger log_;
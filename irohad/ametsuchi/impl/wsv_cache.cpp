@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/wsv_cache.hpp"
+
+#include <mutex>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    const size_t WsvCache::kMaxEntries;
+
+    WsvCache::Version WsvCache::version() const {
+      std::shared_lock<std::shared_timed_mutex> read(mutex_);
+      return version_;
+    }
+
+    template <typename T>
+    nonstd::optional<T> WsvCache::get(const Entries<T> &entries,
+                                      const std::string &key) {
+      std::shared_lock<std::shared_timed_mutex> read(mutex_);
+      auto it = entries.find(key);
+      if (it == entries.end()) {
+        ++misses_;
+        return nonstd::nullopt;
+      }
+      ++hits_;
+      return it->second;
+    }
+
+    template <typename T>
+    void WsvCache::put(Version version,
+                       Entries<T> &entries,
+                       const std::string &key,
+                       const T &value) {
+      std::unique_lock<std::shared_timed_mutex> write(mutex_);
+      if (version != version_) {
+        return;
+      }
+      // cache is bounded by dropping all entries of the kind
+      if (entries.size() >= kMaxEntries) {
+        entries.clear();
+      }
+      entries[key] = value;
+    }
+
+    nonstd::optional<std::vector<std::string>> WsvCache::getAccountRoles(
+        const std::string &account_id) {
+      return get(account_roles_, account_id);
+    }
+
+    nonstd::optional<std::vector<std::string>> WsvCache::getRolePermissions(
+        const std::string &role_name) {
+      return get(role_permissions_, role_name);
+    }
+
+    nonstd::optional<model::Account> WsvCache::getAccount(
+        const std::string &account_id) {
+      return get(accounts_, account_id);
+    }
+
+    void WsvCache::putAccountRoles(Version version,
+                                   const std::string &account_id,
+                                   const std::vector<std::string> &roles) {
+      put(version, account_roles_, account_id, roles);
+    }
+
+    void WsvCache::putRolePermissions(
+        Version version,
+        const std::string &role_name,
+        const std::vector<std::string> &permissions) {
+      put(version, role_permissions_, role_name, permissions);
+    }
+
+    void WsvCache::putAccount(Version version, const model::Account &account) {
+      put(version, accounts_, account.account_id, account);
+    }
+
+    void WsvCache::invalidate() {
+      std::unique_lock<std::shared_timed_mutex> write(mutex_);
+      ++version_;
+      account_roles_.clear();
+      role_permissions_.clear();
+      accounts_.clear();
+    }
+
+    WsvCache::Metrics WsvCache::metrics() const {
+      return {hits_.load(), misses_.load()};
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_WSV_CACHE_HPP
+#define IROHA_WSV_CACHE_HPP
+
+#include <atomic>
+#include <nonstd/optional.hpp>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "model/account.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Committed accounts, account roles and role permissions, which are read
+     * by every command during validation and execution.
+     * Cache is shared by all world state views of the storage. Each commit
+     * invalidates the whole cache and increments its version, so values read
+     * before commit are not stored after it
+     */
+    class WsvCache {
+     public:
+      using Version = uint64_t;
+
+      /// maximal number of entries of a single kind
+      static const size_t kMaxEntries = 10000;
+
+      struct Metrics {
+        size_t hits;
+        size_t misses;
+      };
+
+      /**
+       * @return current version of cached state
+       */
+      Version version() const;
+
+      nonstd::optional<std::vector<std::string>> getAccountRoles(
+          const std::string &account_id);
+
+      nonstd::optional<std::vector<std::string>> getRolePermissions(
+          const std::string &role_name);
+
+      nonstd::optional<model::Account> getAccount(
+          const std::string &account_id);
+
+      /**
+       * Store roles of account, loaded from committed state
+       * @param version of the cache before roles were loaded, value is
+       * discarded if cache was invalidated since then
+       */
+      void putAccountRoles(Version version,
+                           const std::string &account_id,
+                           const std::vector<std::string> &roles);
+
+      void putRolePermissions(Version version,
+                              const std::string &role_name,
+                              const std::vector<std::string> &permissions);
+
+      void putAccount(Version version, const model::Account &account);
+
+      /**
+       * Drop all entries, called after world state view is committed
+       */
+      void invalidate();
+
+      /**
+       * @return number of lookups found and not found in cache
+       */
+      Metrics metrics() const;
+
+     private:
+      template <typename T>
+      using Entries = std::unordered_map<std::string, T>;
+
+      template <typename T>
+      nonstd::optional<T> get(const Entries<T> &entries,
+                              const std::string &key);
+
+      template <typename T>
+      void put(Version version,
+               Entries<T> &entries,
+               const std::string &key,
+               const T &value);
+
+      mutable std::shared_timed_mutex mutex_;
+      Version version_ = 0;
+      Entries<std::vector<std::string>> account_roles_;
+      Entries<std::vector<std::string>> role_permissions_;
+      Entries<model::Account> accounts_;
+
+      std::atomic<size_t> hits_{0};
+      std::atomic<size_t> misses_{0};
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_CACHE_HPP
@@ -0,0 +1,601 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ametsuchi/impl/wsv_overlay.hpp"
+
+#include <algorithm>
+
+#include <boost/algorithm/string/join.hpp>
+#include <boost/format.hpp>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    namespace {
+      const char *kDuplicateKey = "duplicate key value";
+      const char *kMissingReference = "referenced row does not exist";
+      const char *kValueTooLong = "value too long for type character varying";
+      const char *kInvalidJson = "invalid input syntax for type json";
+      const char *kInvalidJsonPath = "cannot set path in json value";
+
+      // lengths of character varying columns of the schema
+      const size_t kRoleIdLength = 45;
+      const size_t kPermissionIdLength = 45;
+      const size_t kDomainIdLength = 164;
+      const size_t kAccountIdLength = 197;
+      const size_t kAssetIdLength = 197;
+      const size_t kPeerAddressLength = 21;
+
+      WsvCommandResult makeCommandError(const boost::format &message,
+                                        const char *reason) {
+        return expected::makeError(message.str() + "\n" + reason);
+      }
+
+      /**
+       * Check that values fit into character varying columns, which limit
+       * the number of characters rather than bytes of UTF-8 string
+       * @param columns - pairs of value and length of its column
+       * @return true if every value fits its column
+       */
+      bool fitColumns(
+          std::initializer_list<std::pair<const std::string &, size_t>>
+              columns) {
+        return std::all_of(
+            columns.begin(), columns.end(), [](const auto &column) {
+              auto characters = std::count_if(
+                  column.first.begin(), column.first.end(), [](char c) {
+                    // continuation bytes do not start a character
+                    return (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+                  });
+              return static_cast<size_t>(characters) <= column.second;
+            });
+      }
+
+      template <typename Container, typename Value>
+      bool contains(const Container &container, const Value &value) {
+        return std::find(container.begin(), container.end(), value)
+            != container.end();
+      }
+    }  // namespace
+
+    WsvOverlay::WsvOverlay(std::unique_ptr<WsvQuery> wsv)
+        : wsv_(std::move(wsv)) {}
+
+    void WsvOverlay::savepoint() {
+      undo_.clear();
+      recording_ = true;
+    }
+
+    void WsvOverlay::release() {
+      undo_.clear();
+      recording_ = false;
+    }
+
+    void WsvOverlay::rollback() {
+      std::for_each(
+          undo_.rbegin(), undo_.rend(), [](const auto &undo) { undo(); });
+      release();
+    }
+
+    template <typename Map, typename Load>
+    typename Map::mapped_type &WsvOverlay::row(
+        Map &rows, const typename Map::key_type &key, Load &&load) {
+      auto it = rows.find(key);
+      if (it == rows.end()) {
+        it = rows.emplace(key, load()).first;
+      }
+      return it->second;
+    }
+
+    template <typename Map>
+    void WsvOverlay::journal(Map &rows, const typename Map::key_type &key) {
+      journal(rows.at(key));
+    }
+
+    template <typename T>
+    void WsvOverlay::journal(T &value) {
+      if (recording_) {
+        // references to elements of maps are stable, elements are not erased
+        undo_.emplace_back([&value, old = value] { value = old; });
+      }
+    }
+
+    nonstd::optional<std::vector<std::string>> &WsvOverlay::roles() {
+      if (not roles_loaded_) {
+        roles_ = wsv_->getRoles();
+        roles_loaded_ = true;
+      }
+      return roles_;
+    }
+
+    nonstd::optional<std::vector<model::Peer>> &WsvOverlay::peers() {
+      if (not peers_loaded_) {
+        peers_ = wsv_->getPeers();
+        peers_loaded_ = true;
+      }
+      return peers_;
+    }
+
+    bool WsvOverlay::roleExists(const std::string &role_name) {
+      auto &all = roles();
+      return all and contains(*all, role_name);
+    }
+
+    bool WsvOverlay::accountExists(const std::string &account_id) {
+      return static_cast<bool>(getAccount(account_id));
+    }
+
+    bool WsvOverlay::hasAccountGrantablePermission(
+        const std::string &permitee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      return row(grantable_permissions_,
+                 GrantableKey(permitee_account_id, account_id, permission_id),
+                 [&] {
+                   return wsv_->hasAccountGrantablePermission(
+                       permitee_account_id, account_id, permission_id);
+                 });
+    }
+
+    nonstd::optional<model::Domain> WsvOverlay::getDomain(
+        const std::string &domain_id) {
+      return row(
+          domains_, domain_id, [&] { return wsv_->getDomain(domain_id); });
+    }
+
+    nonstd::optional<std::vector<std::string>> WsvOverlay::getAccountRoles(
+        const std::string &account_id) {
+      return row(account_roles_, account_id, [&] {
+        return wsv_->getAccountRoles(account_id);
+      });
+    }
+
+    nonstd::optional<std::vector<std::string>> WsvOverlay::getRolePermissions(
+        const std::string &role_name) {
+      return row(role_permissions_, role_name, [&] {
+        return wsv_->getRolePermissions(role_name);
+      });
+    }
+
+    nonstd::optional<std::vector<std::string>> WsvOverlay::getRoles() {
+      return roles();
+    }
+
+    nonstd::optional<model::Account> WsvOverlay::getAccount(
+        const std::string &account_id) {
+      return row(
+          accounts_, account_id, [&] { return wsv_->getAccount(account_id); });
+    }
+
+    nonstd::optional<std::string> WsvOverlay::getAccountDetail(
+        const std::string &account_id,
+        const std::string &creator_account_id,
+        const std::string &detail) {
+      auto account = getAccount(account_id);
+      if (not account) {
+        return nonstd::nullopt;
+      }
+      rapidjson::Document document;
+      if (document.Parse(account->json_data.c_str()).HasParseError()
+          or not document.IsObject()) {
+        return nonstd::nullopt;
+      }
+      auto creator = document.FindMember(creator_account_id.c_str());
+      if (creator == document.MemberEnd() or not creator->value.IsObject()) {
+        return nonstd::nullopt;
+      }
+      auto value = creator->value.FindMember(detail.c_str());
+      if (value == creator->value.MemberEnd()) {
+        return nonstd::nullopt;
+      }
+      if (value->value.IsString()) {
+        std::string result = value->value.GetString();
+        // empty value is not distinguished from missing key
+        return result.empty() ? nonstd::nullopt : nonstd::make_optional(result);
+      }
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+      value->value.Accept(writer);
+      return std::string(buffer.GetString());
+    }
+
+    nonstd::optional<std::vector<pubkey_t>> WsvOverlay::getSignatories(
+        const std::string &account_id) {
+      return row(signatories_, account_id, [&] {
+        return wsv_->getSignatories(account_id);
+      });
+    }
+
+    nonstd::optional<model::Asset> WsvOverlay::getAsset(
+        const std::string &asset_id) {
+      return row(assets_, asset_id, [&] { return wsv_->getAsset(asset_id); });
+    }
+
+    nonstd::optional<model::AccountAsset> WsvOverlay::getAccountAsset(
+        const std::string &account_id, const std::string &asset_id) {
+      return row(account_assets_, AccountAssetKey(account_id, asset_id), [&] {
+        return wsv_->getAccountAsset(account_id, asset_id);
+      });
+    }
+
+    nonstd::optional<std::vector<model::Peer>> WsvOverlay::getPeers() {
+      return peers();
+    }
+
+    WsvCommandResult WsvOverlay::insertRole(const std::string &role_name) {
+      auto message = boost::format("failed to insert role: '%s'") % role_name;
+      if (not fitColumns({{role_name, kRoleIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      auto &all = roles();
+      if (not all or contains(*all, role_name)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      journal(roles_);
+      all->push_back(role_name);
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertAccountRole(
+        const std::string &account_id, const std::string &role_name) {
+      auto message = boost::format(
+                         "failed to insert account role, account: '%s', "
+                         "role name: '%s'")
+          % account_id % role_name;
+      if (not fitColumns(
+              {{account_id, kAccountIdLength}, {role_name, kRoleIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (not accountExists(account_id) or not roleExists(role_name)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      getAccountRoles(account_id);
+      auto &account_roles = account_roles_.at(account_id);
+      if (not account_roles or contains(*account_roles, role_name)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      journal(account_roles_, account_id);
+      account_roles->push_back(role_name);
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::deleteAccountRole(
+        const std::string &account_id, const std::string &role_name) {
+      getAccountRoles(account_id);
+      auto &account_roles = account_roles_.at(account_id);
+      if (account_roles and contains(*account_roles, role_name)) {
+        journal(account_roles_, account_id);
+        account_roles->erase(std::find(
+            account_roles->begin(), account_roles->end(), role_name));
+      }
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertRolePermissions(
+        const std::string &role_id, const std::set<std::string> &permissions) {
+      auto message = boost::format("failed to insert role permissions, role "
+                                   "id: '%s', permissions: [%s]")
+          % role_id % boost::algorithm::join(permissions, ", ");
+      if (not fitColumns({{role_id, kRoleIdLength}})
+          or std::any_of(permissions.begin(),
+                         permissions.end(),
+                         [](const auto &permission) {
+                           return not fitColumns(
+                               {{permission, kPermissionIdLength}});
+                         })) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (not roleExists(role_id)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      getRolePermissions(role_id);
+      auto &role_permissions = role_permissions_.at(role_id);
+      if (not role_permissions
+          or std::any_of(permissions.begin(),
+                         permissions.end(),
+                         [&role_permissions](const auto &permission) {
+                           return contains(*role_permissions, permission);
+                         })) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      journal(role_permissions_, role_id);
+      role_permissions->insert(
+          role_permissions->end(), permissions.begin(), permissions.end());
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertAccountGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      auto message =
+          boost::format(
+              "failed to insert account grantable permission, "
+              "permittee account id: '%s', "
+              "account id: '%s', "
+              "permission id: '%s'")
+          % permittee_account_id % account_id % permission_id;
+      if (not fitColumns({{permittee_account_id, kAccountIdLength},
+                          {account_id, kAccountIdLength},
+                          {permission_id, kPermissionIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (not accountExists(permittee_account_id)
+          or not accountExists(account_id)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      if (hasAccountGrantablePermission(
+              permittee_account_id, account_id, permission_id)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      GrantableKey key(permittee_account_id, account_id, permission_id);
+      journal(grantable_permissions_, key);
+      grantable_permissions_.at(key) = true;
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::deleteAccountGrantablePermission(
+        const std::string &permittee_account_id,
+        const std::string &account_id,
+        const std::string &permission_id) {
+      if (hasAccountGrantablePermission(
+              permittee_account_id, account_id, permission_id)) {
+        GrantableKey key(permittee_account_id, account_id, permission_id);
+        journal(grantable_permissions_, key);
+        grantable_permissions_.at(key) = false;
+      }
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertAccount(const model::Account &account) {
+      auto message = boost::format("failed to insert account, "
+                                   "account id: '%s', "
+                                   "domain id: '%s', "
+                                   "quorum: '%d', "
+                                   "json_data: %s")
+          % account.account_id % account.domain_id % account.quorum
+          % account.json_data;
+      if (not fitColumns({{account.account_id, kAccountIdLength},
+                          {account.domain_id, kDomainIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      rapidjson::Document document;
+      if (document.Parse(account.json_data.c_str()).HasParseError()) {
+        return makeCommandError(message, kInvalidJson);
+      }
+      if (accountExists(account.account_id)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      if (not getDomain(account.domain_id)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      journal(accounts_, account.account_id);
+      accounts_.at(account.account_id) = account;
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::updateAccount(const model::Account &account) {
+      if (accountExists(account.account_id)) {
+        auto &existing = accounts_.at(account.account_id);
+        journal(accounts_, account.account_id);
+        existing->quorum = account.quorum;
+      }
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::setAccountKV(
+        const std::string &account_id,
+        const std::string &creator_account_id,
+        const std::string &key,
+        const std::string &val) {
+      auto message = boost::format(
+                         "failed to set account key-value, account id: '%s', "
+                         "creator account id: '%s',\n key: '%s', value: '%s'")
+          % account_id % creator_account_id % key % val;
+      if (not accountExists(account_id)) {
+        return {};
+      }
+      auto &account = accounts_.at(account_id);
+      // data is never inserted as NULL, so it is empty only when read from
+      // NULL column, which jsonb_set keeps as is
+      if (account->json_data.empty()) {
+        return {};
+      }
+      rapidjson::Document document;
+      if (document.Parse(account->json_data.c_str()).HasParseError()) {
+        return makeCommandError(message, kInvalidJson);
+      }
+      // path of text keys can be set only through objects
+      if (not document.IsObject()) {
+        return makeCommandError(message, kInvalidJsonPath);
+      }
+      auto &allocator = document.GetAllocator();
+      auto creator = document.FindMember(creator_account_id.c_str());
+      if (creator == document.MemberEnd()) {
+        document.AddMember(
+            rapidjson::Value(creator_account_id.c_str(), allocator),
+            rapidjson::Value(rapidjson::kObjectType),
+            allocator);
+        creator = document.FindMember(creator_account_id.c_str());
+      }
+      if (creator->value.IsArray()) {
+        return makeCommandError(message, kInvalidJsonPath);
+      }
+      // jsonb_set leaves value unchanged when path goes through a scalar
+      if (not creator->value.IsObject()) {
+        return {};
+      }
+      rapidjson::Value value(val.c_str(), allocator);
+      auto existing = creator->value.FindMember(key.c_str());
+      if (existing != creator->value.MemberEnd()) {
+        existing->value = value;
+      } else {
+        creator->value.AddMember(
+            rapidjson::Value(key.c_str(), allocator), value, allocator);
+      }
+      rapidjson::StringBuffer buffer;
+      rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+      document.Accept(writer);
+
+      journal(accounts_, account_id);
+      account->json_data = buffer.GetString();
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertAsset(const model::Asset &asset) {
+      auto message = boost::format("failed to insert asset, asset id: '%s', "
+                                   "domain id: '%s', precision: %d")
+          % asset.asset_id % asset.domain_id
+          % static_cast<uint32_t>(asset.precision);
+      if (not fitColumns({{asset.asset_id, kAssetIdLength},
+                          {asset.domain_id, kDomainIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (getAsset(asset.asset_id)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      if (not getDomain(asset.domain_id)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      journal(assets_, asset.asset_id);
+      assets_.at(asset.asset_id) = asset;
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::upsertAccountAsset(
+        const model::AccountAsset &asset) {
+      auto message = boost::format("failed to upsert account, account id: "
+                                   "'%s', asset id: '%s', balance: %s")
+          % asset.account_id % asset.asset_id % asset.balance.to_string();
+      if (not fitColumns({{asset.account_id, kAccountIdLength},
+                          {asset.asset_id, kAssetIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (not accountExists(asset.account_id) or not getAsset(asset.asset_id)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      AccountAssetKey key(asset.account_id, asset.asset_id);
+      getAccountAsset(asset.account_id, asset.asset_id);
+      journal(account_assets_, key);
+      account_assets_.at(key) = asset;
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertSignatory(const pubkey_t &) {
+      // signatories are inserted on conflict do nothing and are referenced
+      // only by account signatories, which are checked separately
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertAccountSignatory(
+        const std::string &account_id, const pubkey_t &signatory) {
+      auto message = boost::format(
+                         "failed to insert account signatory, account id: "
+                         "'%s', signatory hex string: '%s'")
+          % account_id % signatory.to_hexstring();
+      if (not fitColumns({{account_id, kAccountIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (not accountExists(account_id)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      getSignatories(account_id);
+      auto &signatories = signatories_.at(account_id);
+      if (not signatories or contains(*signatories, signatory)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      journal(signatories_, account_id);
+      signatories->push_back(signatory);
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::deleteAccountSignatory(
+        const std::string &account_id, const pubkey_t &signatory) {
+      getSignatories(account_id);
+      auto &signatories = signatories_.at(account_id);
+      if (signatories and contains(*signatories, signatory)) {
+        journal(signatories_, account_id);
+        signatories->erase(
+            std::find(signatories->begin(), signatories->end(), signatory));
+      }
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::deleteSignatory(const pubkey_t &) {
+      // signatory is deleted only when it is not referenced, which has no
+      // effect on world state view queries
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertPeer(const model::Peer &peer) {
+      auto message =
+          boost::format(
+              "failed to insert peer, public key: '%s', address: '%s'")
+          % peer.pubkey.to_hexstring() % peer.address;
+      if (not fitColumns({{peer.address, kPeerAddressLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      auto &all = peers();
+      if (not all
+          or std::any_of(all->begin(), all->end(), [&peer](const auto &p) {
+               return p.pubkey == peer.pubkey or p.address == peer.address;
+             })) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      journal(peers_);
+      all->push_back(peer);
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::deletePeer(const model::Peer &peer) {
+      auto &all = peers();
+      if (not all) {
+        return {};
+      }
+      auto it = std::find_if(all->begin(), all->end(), [&peer](const auto &p) {
+        return p.pubkey == peer.pubkey and p.address == peer.address;
+      });
+      if (it != all->end()) {
+        journal(peers_);
+        all->erase(it);
+      }
+      return {};
+    }
+
+    WsvCommandResult WsvOverlay::insertDomain(const model::Domain &domain) {
+      auto message = boost::format("failed to insert domain, domain id: '%s', "
+                                   "default role: '%s'")
+          % domain.domain_id % domain.default_role;
+      if (not fitColumns({{domain.domain_id, kDomainIdLength},
+                          {domain.default_role, kRoleIdLength}})) {
+        return makeCommandError(message, kValueTooLong);
+      }
+      if (getDomain(domain.domain_id)) {
+        return makeCommandError(message, kDuplicateKey);
+      }
+      if (not roleExists(domain.default_role)) {
+        return makeCommandError(message, kMissingReference);
+      }
+      journal(domains_, domain.domain_id);
+      domains_.at(domain.domain_id) = domain;
+      return {};
+    }
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,194 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_WSV_OVERLAY_HPP
+#define IROHA_WSV_OVERLAY_HPP
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "ametsuchi/wsv_command.hpp"
+#include "ametsuchi/wsv_query.hpp"
+#include "model/account.hpp"
+#include "model/account_asset.hpp"
+#include "model/asset.hpp"
+#include "model/domain.hpp"
+#include "model/peer.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * In-memory copy-on-write view of world state.
+     * Rows are read from underlying query once and kept in memory, commands
+     * modify only the kept copies and are never sent to the database.
+     * Constraints of the database schema, such as unique and foreign keys,
+     * lengths of character varying columns and validity of json data, are
+     * checked in memory, so commands fail in the same cases as SQL ones.
+     * Changes since the last savepoint are recorded in undo journal, which
+     * replaces per transaction SAVEPOINT statements
+     */
+    class WsvOverlay : public WsvQuery, public WsvCommand {
+     public:
+      /**
+       * @param wsv - query of state, which is not changed while overlay is
+       * in use
+       */
+      explicit WsvOverlay(std::unique_ptr<WsvQuery> wsv);
+
+      /**
+       * Start recording changes, previous savepoint is released
+       */
+      void savepoint();
+
+      /**
+       * Keep changes since the savepoint
+       */
+      void release();
+
+      /**
+       * Discard changes since the savepoint
+       */
+      void rollback();
+
+      // WsvQuery
+
+      bool hasAccountGrantablePermission(
+          const std::string &permitee_account_id,
+          const std::string &account_id,
+          const std::string &permission_id) override;
+      nonstd::optional<model::Domain> getDomain(
+          const std::string &domain_id) override;
+      nonstd::optional<std::vector<std::string>> getAccountRoles(
+          const std::string &account_id) override;
+      nonstd::optional<std::vector<std::string>> getRolePermissions(
+          const std::string &role_name) override;
+      nonstd::optional<std::vector<std::string>> getRoles() override;
+      nonstd::optional<model::Account> getAccount(
+          const std::string &account_id) override;
+      nonstd::optional<std::string> getAccountDetail(
+          const std::string &account_id,
+          const std::string &creator_account_id,
+          const std::string &detail) override;
+      nonstd::optional<std::vector<pubkey_t>> getSignatories(
+          const std::string &account_id) override;
+      nonstd::optional<model::Asset> getAsset(
+          const std::string &asset_id) override;
+      nonstd::optional<model::AccountAsset> getAccountAsset(
+          const std::string &account_id, const std::string &asset_id) override;
+      nonstd::optional<std::vector<model::Peer>> getPeers() override;
+
+      // WsvCommand
+
+      WsvCommandResult insertRole(const std::string &role_name) override;
+      WsvCommandResult insertAccountRole(const std::string &account_id,
+                                         const std::string &role_name) override;
+      WsvCommandResult deleteAccountRole(const std::string &account_id,
+                                         const std::string &role_name) override;
+      WsvCommandResult insertRolePermissions(
+          const std::string &role_id,
+          const std::set<std::string> &permissions) override;
+      WsvCommandResult insertAccountGrantablePermission(
+          const std::string &permittee_account_id,
+          const std::string &account_id,
+          const std::string &permission_id) override;
+      WsvCommandResult deleteAccountGrantablePermission(
+          const std::string &permittee_account_id,
+          const std::string &account_id,
+          const std::string &permission_id) override;
+      WsvCommandResult insertAccount(const model::Account &account) override;
+      WsvCommandResult updateAccount(const model::Account &account) override;
+      WsvCommandResult setAccountKV(const std::string &account_id,
+                                    const std::string &creator_account_id,
+                                    const std::string &key,
+                                    const std::string &val) override;
+      WsvCommandResult insertAsset(const model::Asset &asset) override;
+      WsvCommandResult upsertAccountAsset(
+          const model::AccountAsset &asset) override;
+      WsvCommandResult insertSignatory(const pubkey_t &signatory) override;
+      WsvCommandResult insertAccountSignatory(
+          const std::string &account_id, const pubkey_t &signatory) override;
+      WsvCommandResult deleteAccountSignatory(
+          const std::string &account_id, const pubkey_t &signatory) override;
+      WsvCommandResult deleteSignatory(const pubkey_t &signatory) override;
+      WsvCommandResult insertPeer(const model::Peer &peer) override;
+      WsvCommandResult deletePeer(const model::Peer &peer) override;
+      WsvCommandResult insertDomain(const model::Domain &domain) override;
+
+     private:
+      template <typename T>
+      using Rows = std::unordered_map<std::string, nonstd::optional<T>>;
+      using GrantableKey = std::tuple<std::string, std::string, std::string>;
+      using AccountAssetKey = std::pair<std::string, std::string>;
+
+      /**
+       * Return row kept in memory, or load it from underlying query
+       * @param rows - kept rows of the table
+       * @param key - key of the row
+       * @param load - function which reads the row from underlying query
+       * @return reference to the kept row
+       */
+      template <typename Map, typename Load>
+      typename Map::mapped_type &row(Map &rows,
+                                     const typename Map::key_type &key,
+                                     Load &&load);
+
+      /**
+       * Record current value of the row in undo journal before change
+       */
+      template <typename Map>
+      void journal(Map &rows, const typename Map::key_type &key);
+
+      /**
+       * Record current value in undo journal before change
+       */
+      template <typename T>
+      void journal(T &value);
+
+      nonstd::optional<std::vector<std::string>> &roles();
+      nonstd::optional<std::vector<model::Peer>> &peers();
+      bool roleExists(const std::string &role_name);
+      bool accountExists(const std::string &account_id);
+
+      std::unique_ptr<WsvQuery> wsv_;
+
+      Rows<model::Account> accounts_;
+      Rows<std::vector<std::string>> account_roles_;
+      Rows<std::vector<std::string>> role_permissions_;
+      Rows<std::vector<pubkey_t>> signatories_;
+      Rows<model::Asset> assets_;
+      Rows<model::Domain> domains_;
+      std::map<AccountAssetKey, nonstd::optional<model::AccountAsset>>
+          account_assets_;
+      std::map<GrantableKey, bool> grantable_permissions_;
+      nonstd::optional<std::vector<std::string>> roles_;
+      nonstd::optional<std::vector<model::Peer>> peers_;
+      bool roles_loaded_ = false;
+      bool peers_loaded_ = false;
+      bool recording_ = false;
+
+      /// functions restoring values changed since the savepoint
+      std::vector<std::function<void()>> undo_;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_OVERLAY_HPP
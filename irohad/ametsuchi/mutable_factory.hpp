@@ -41,8 +41,10 @@ namespace iroha {
        * This transforms Ametsuchi to the new state consistent with
        * MutableStorage.
        * @param mutableStorage
+       * @return true if blocks were stored and state was committed, otherwise
+       * Ametsuchi is left in the previous state
        */
-      virtual void commit(std::unique_ptr<MutableStorage> mutableStorage) = 0;
+      virtual bool commit(std::unique_ptr<MutableStorage> mutableStorage) = 0;
 
       virtual ~MutableFactory() = default;
     };
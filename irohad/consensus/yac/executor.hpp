@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_YAC_EXECUTOR_HPP
+#define IROHA_YAC_EXECUTOR_HPP
+
+#include <functional>
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Interface provide threads for processing of yac messages
+       */
+      class Executor {
+       public:
+        /**
+         * Run task, which does not touch state of consensus round,
+         * e.g. crypto verification, possibly in parallel with other tasks
+         * @param task - function, that will be invoked
+         */
+        virtual void runConcurrently(std::function<void()> task) = 0;
+
+        /**
+         * Run task, which changes state of consensus round. Such tasks are
+         * invoked one by one in order of submission
+         * @param task - function, that will be invoked
+         */
+        virtual void runSequentially(std::function<void()> task) = 0;
+
+        /**
+         * Run task, which delivers outcome of consensus to subscribers.
+         * Such tasks are invoked one by one in order of submission, apart
+         * from sequential tasks, so subscribers do not stall the round
+         * @param task - function, that will be invoked
+         */
+        virtual void runNotification(std::function<void()> task) = 0;
+
+        virtual ~Executor() = default;
+      };
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+#endif  // IROHA_YAC_EXECUTOR_HPP
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "consensus/yac/impl/executor_impl.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+      ExecutorImpl::ExecutorImpl(size_t workers)
+          : consensus_thread_([this] { consume(sequential_tasks_); }),
+            notification_thread_([this] { consume(notification_tasks_); }) {
+        for (size_t i = 0; i < workers; ++i) {
+          workers_.emplace_back([this] { consume(concurrent_tasks_); });
+        }
+      }
+
+      void ExecutorImpl::runConcurrently(std::function<void()> task) {
+        submit(concurrent_tasks_, std::move(task));
+      }
+
+      void ExecutorImpl::runSequentially(std::function<void()> task) {
+        submit(sequential_tasks_, std::move(task));
+      }
+
+      void ExecutorImpl::runNotification(std::function<void()> task) {
+        submit(notification_tasks_, std::move(task));
+      }
+
+      void ExecutorImpl::submit(Queue &queue, std::function<void()> task) {
+        ++pending_;
+        queue.push(std::move(task));
+      }
+
+      void ExecutorImpl::consume(Queue &queue) {
+        std::function<void()> task;
+        while (queue.pop(task), task) {
+          task();
+          // captured state is released before the task is counted finished
+          task = nullptr;
+          if (--pending_ == 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            idle_.notify_all();
+          }
+        }
+      }
+
+      ExecutorImpl::~ExecutorImpl() {
+        // tasks of every queue may submit tasks to the others, so threads are
+        // stopped only when no task is pending
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          idle_.wait(lock, [this] { return pending_ == 0; });
+        }
+        for (size_t i = 0; i < workers_.size(); ++i) {
+          concurrent_tasks_.push(nullptr);
+        }
+        sequential_tasks_.push(nullptr);
+        notification_tasks_.push(nullptr);
+        for (auto &worker : workers_) {
+          worker.join();
+        }
+        consensus_thread_.join();
+        notification_thread_.join();
+      }
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_EXECUTOR_IMPL_HPP
+#define IROHA_EXECUTOR_IMPL_HPP
+
+#include <tbb/concurrent_queue.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "consensus/yac/executor.hpp"
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+      /**
+       * Executor, which verifies messages on a pool of worker threads,
+       * applies them on a single consensus thread, and notifies subscribers
+       * on a single notification thread. All consume tasks from concurrent
+       * queues, so submitting threads, e.g. gRPC handlers, return without
+       * waiting for the task
+       */
+      class ExecutorImpl : public Executor {
+       public:
+        /**
+         * @param workers - number of threads for concurrent tasks
+         */
+        explicit ExecutorImpl(
+            size_t workers = std::max(1u, std::thread::hardware_concurrency()));
+        ExecutorImpl(const ExecutorImpl &) = delete;
+        ExecutorImpl &operator=(const ExecutorImpl &) = delete;
+
+        void runConcurrently(std::function<void()> task) override;
+        void runSequentially(std::function<void()> task) override;
+        void runNotification(std::function<void()> task) override;
+
+        /**
+         * Runs all submitted tasks, including ones submitted by other tasks
+         * during destruction, and stops the threads. Tasks must not be
+         * submitted from other threads during destruction
+         */
+        ~ExecutorImpl() override;
+
+       private:
+        using Queue = tbb::concurrent_bounded_queue<std::function<void()>>;
+
+        /**
+         * Count the task as pending and push it to the queue
+         */
+        void submit(Queue &queue, std::function<void()> task);
+
+        /**
+         * Invoke tasks of the queue until empty task is popped
+         */
+        void consume(Queue &queue);
+
+        Queue concurrent_tasks_;
+        Queue sequential_tasks_;
+        Queue notification_tasks_;
+        /// number of submitted tasks, which are not finished yet
+        std::atomic<size_t> pending_{0};
+        std::mutex mutex_;
+        /// notified when all submitted tasks are finished
+        std::condition_variable idle_;
+        std::vector<std::thread> workers_;
+        std::thread consensus_thread_;
+        std::thread notification_thread_;
+      };
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_EXECUTOR_IMPL_HPP
@@ -16,22 +16,22 @@
  */
 
 #include "consensus/yac/impl/timer_impl.hpp"
-#include <iostream>
 
 namespace iroha {
   namespace consensus {
     namespace yac {
+      TimerImpl::TimerImpl(std::shared_ptr<timer::TimerWheel> timer_wheel)
+          : timer_wheel_(std::move(timer_wheel)) {}
+
       void TimerImpl::invokeAfterDelay(uint64_t millis,
                                        std::function<void()> handler) {
         deny();
-        handler_ = std::move(handler);
-        timer = rxcpp::observable<>::timer(std::chrono::milliseconds(millis));
-        handle = timer.subscribe_on(rxcpp::observe_on_new_thread())
-                     .subscribe([this](auto) { handler_(); });
+        timer_id_ = timer_wheel_->schedule(std::chrono::milliseconds(millis),
+                                           std::move(handler));
       }
 
       void TimerImpl::deny() {
-        handle.unsubscribe();
+        timer_wheel_->cancel(timer_id_.exchange(0));
       }
 
       TimerImpl::~TimerImpl() {
@@ -18,15 +18,23 @@
 #ifndef IROHA_TIMER_IMPL_HPP
 #define IROHA_TIMER_IMPL_HPP
 
-#include <rxcpp/rx.hpp>
+#include <atomic>
+#include <memory>
+
 #include "consensus/yac/timer.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
+      /**
+       * Timer, which schedules its handler on a timer wheel, shared with
+       * other timers of the peer instead of a thread per delay
+       */
       class TimerImpl : public Timer {
        public:
-        TimerImpl() = default;
+        explicit TimerImpl(std::shared_ptr<timer::TimerWheel> timer_wheel =
+                               timer::TimerWheel::shared());
         TimerImpl(const TimerImpl &) = delete;
         TimerImpl &operator=(const TimerImpl &) = delete;
 
@@ -37,10 +45,8 @@ namespace iroha {
         ~TimerImpl() override;
 
        private:
-        std::function<void()> handler_;
-
-        rxcpp::observable<long> timer;
-        rxcpp::composite_subscription handle;
+        std::shared_ptr<timer::TimerWheel> timer_wheel_;
+        std::atomic<timer::TimerWheel::TimerId> timer_id_{0};
       };
     }  // namespace yac
   }    // namespace consensus
@@ -52,38 +52,80 @@ namespace iroha {
           YacVoteStorage vote_storage,
           std::shared_ptr<YacNetwork> network,
           std::shared_ptr<YacCryptoProvider> crypto,
-          std::shared_ptr<Timer> timer,
+          TimerFactory timer_factory,
           ClusterOrdering order,
-          uint64_t delay) {
-        return std::make_shared<Yac>(
-            vote_storage, network, crypto, timer, order, delay);
+          uint64_t delay,
+          std::unique_ptr<Executor> executor,
+          std::shared_ptr<PropagationStrategy> propagation) {
+        return std::make_shared<Yac>(vote_storage,
+                                     network,
+                                     crypto,
+                                     std::move(timer_factory),
+                                     order,
+                                     delay,
+                                     std::move(executor),
+                                     std::move(propagation));
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
                std::shared_ptr<YacNetwork> network,
                std::shared_ptr<YacCryptoProvider> crypto,
-               std::shared_ptr<Timer> timer,
+               TimerFactory timer_factory,
                ClusterOrdering order,
-               uint64_t delay)
+               uint64_t delay,
+               std::unique_ptr<Executor> executor,
+               std::shared_ptr<PropagationStrategy> propagation)
           : vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)),
+            timer_factory_(std::move(timer_factory)),
+            propagation_(std::move(propagation)),
             cluster_order_(order),
-            delay_(delay) {
+            delay_(delay),
+            executor_(std::move(executor)) {
         log_ = logger::log("YAC");
+        network_->setCluster(cluster_order_);
+      }
+
+      Yac::~Yac() {
+        stopped_ = true;
+        auto deny_rounds = [this] {
+          for (auto &round : rounds_) {
+            round.second.timer->deny();
+          }
+        };
+        // waits for running handlers of the timers on the consensus thread,
+        // which owns the rounds
+        executor_->runSequentially(deny_rounds);
+        executor_.reset();
+        // submitted tasks could have scheduled the timers again
+        deny_rounds();
       }
 
       // ------|Hash gate|------
 
       void Yac::vote(YacHash hash, ClusterOrdering order) {
-        log_->info("Order for voting: {}",
-                   logger::to_string(order.getPeers(),
-                                     [](auto val) { return val.address; }));
-
-        cluster_order_ = order;
-        auto vote = crypto_->getVote(hash);
-        votingStep(vote);
+        executor_->runSequentially([this, hash, order] {
+          log_->info("Order for voting: {}",
+                     logger::to_string(order.getPeers(),
+                                       [](auto val) { return val.address; }));
+
+          cluster_order_ = order;
+          network_->setCluster(cluster_order_);
+          // rounds, which delivered their vote to every peer, have no
+          // pending retry and could miss the outcome, so they are dropped
+          for (auto it = rounds_.begin(); it != rounds_.end();) {
+            it = it->second.order.hasNext() ? std::next(it) : rounds_.erase(it);
+          }
+          if (vote_storage_.isHashCommitted(hash.proposal_hash)) {
+            return;
+          }
+          // voting again for the proposal restarts its round
+          closeRound(hash.proposal_hash);
+          rounds_.emplace(hash.proposal_hash, Round{order, timer_factory_()});
+          auto vote = crypto_->getVote(hash);
+          votingStep(vote);
+        });
       }
 
       rxcpp::observable<CommitMessage> Yac::on_commit() {
@@ -93,39 +135,60 @@ namespace iroha {
       // ------|Network notifications|------
 
       void Yac::on_vote(VoteMessage vote) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(vote)) {
-          applyVote(findPeer(vote), vote);
-        } else {
-          log_->warn(cryptoError({vote}));
-        }
+        executor_->runConcurrently([this, vote] {
+          if (crypto_->verify(vote)) {
+            executor_->runSequentially(
+                [this, vote] { applyVote(findPeer(vote), vote); });
+          } else {
+            log_->warn(cryptoError({vote}));
+          }
+        });
       }
 
       void Yac::on_commit(CommitMessage commit) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(commit)) {
-          // Commit does not contain data about peer which sent the message
-          applyCommit(nonstd::nullopt, commit);
-        } else {
-          log_->warn(cryptoError(commit.votes));
-        }
+        // storage is read on the consensus thread, and only votes absent
+        // there are verified on workers
+        executor_->runSequentially([this, commit] {
+          auto unknown = unknownVotes(commit);
+          executor_->runConcurrently([this, commit, unknown] {
+            if (crypto_->verify(unknown)) {
+              // Commit does not contain data about peer which sent the
+              // message
+              executor_->runSequentially(
+                  [this, commit] { applyCommit(nonstd::nullopt, commit); });
+            } else {
+              log_->warn(cryptoError(unknown.votes));
+            }
+          });
+        });
       }
 
       void Yac::on_reject(RejectMessage reject) {
-        std::lock_guard<std::mutex> guard(mutex_);
-        if (crypto_->verify(reject)) {
-          // Reject does not contain data about peer which sent the message
-          applyReject(nonstd::nullopt, reject);
-        } else {
-          log_->warn(cryptoError(reject.votes));
-        }
+        executor_->runSequentially([this, reject] {
+          auto unknown = unknownVotes(reject);
+          executor_->runConcurrently([this, reject, unknown] {
+            if (crypto_->verify(unknown)) {
+              // Reject does not contain data about peer which sent the
+              // message
+              executor_->runSequentially(
+                  [this, reject] { applyReject(nonstd::nullopt, reject); });
+            } else {
+              log_->warn(cryptoError(unknown.votes));
+            }
+          });
+        });
       }
 
       // ------|Private interface|------
 
       void Yac::votingStep(VoteMessage vote) {
-        auto committed = vote_storage_.isHashCommitted(vote.hash.proposal_hash);
-        if (committed) {
+        const auto &proposal_hash = vote.hash.proposal_hash;
+        auto round = rounds_.find(proposal_hash);
+        if (round == rounds_.end()) {
+          return;
+        }
+        if (vote_storage_.isHashCommitted(proposal_hash)) {
+          closeRound(proposal_hash);
           return;
         }
 
@@ -133,16 +196,27 @@ namespace iroha {
                    vote.hash.proposal_hash,
                    vote.hash.block_hash);
 
-        network_->send_vote(cluster_order_.currentLeader(), vote);
-        cluster_order_.switchToNext();
-        if (cluster_order_.hasNext()) {
-          timer_->invokeAfterDelay(delay_,
-                                   [this, vote] { this->votingStep(vote); });
+        auto &order = round->second.order;
+        network_->send_vote(order.currentLeader(), vote);
+        order.switchToNext();
+        if (order.hasNext()) {
+          // the handler may be invoked in place and close the round
+          auto timer = round->second.timer;
+          timer->invokeAfterDelay(delay_, [this, vote] {
+            if (not stopped_) {
+              executor_->runSequentially([this, vote] { votingStep(vote); });
+            }
+          });
         }
       }
 
-      void Yac::closeRound() {
-        timer_->deny();
+      void Yac::closeRound(const ProposalHash &proposal_hash) {
+        auto round = rounds_.find(proposal_hash);
+        if (round == rounds_.end()) {
+          return;
+        }
+        round->second.timer->deny();
+        rounds_.erase(round);
       }
 
       nonstd::optional<model::Peer> Yac::findPeer(const VoteMessage &vote) {
@@ -154,6 +228,23 @@ namespace iroha {
         return it != peers.end() ? nonstd::make_optional(*it) : nonstd::nullopt;
       }
 
+      template <typename Message>
+      Message Yac::unknownVotes(const Message &message) {
+        Message result(std::vector<VoteMessage>{});
+        std::copy_if(message.votes.begin(),
+                     message.votes.end(),
+                     std::back_inserter(result.votes),
+                     [this](const auto &vote) {
+                       return not vote_storage_.isContains(vote);
+                     });
+        return result;
+      }
+
+      void Yac::emitCommit(const CommitMessage &commit) {
+        executor_->runNotification(
+            [this, commit] { notifier_.get_subscriber().on_next(commit); });
+      }
+
       // ------|Apply data|------
 
       const char *kRejectMsg = "reject case";
@@ -171,7 +262,8 @@ namespace iroha {
             vote_storage_.markAsProcessedState(proposal_hash);
             visit_in_place(answer,
                            [&](const CommitMessage &commit) {
-                             notifier_.get_subscriber().on_next(commit);
+                             this->emitCommit(commit);
+                             this->relayCommit(commit);
                            },
                            [&](const RejectMessage &reject) {
                              log_->warn(kRejectMsg);
@@ -179,7 +271,7 @@ namespace iroha {
                              // IR-497
                            });
           }
-          this->closeRound();
+          this->closeRound(proposal_hash);
         };
       }
 
@@ -197,15 +289,16 @@ namespace iroha {
             visit_in_place(answer,
                            [&](const RejectMessage &reject) {
                              log_->warn(kRejectMsg);
+                             this->relayReject(reject);
                              // TODO 14/08/17 Muratov: work on reject case
                              // IR-497
                            },
                            [&](const CommitMessage &commit) {
-                             notifier_.get_subscriber().on_next(commit);
+                             this->emitCommit(commit);
                              this->propagateCommit(commit);
                            });
           }
-          this->closeRound();
+          this->closeRound(proposal_hash);
         };
       }
 
@@ -236,7 +329,7 @@ namespace iroha {
                              // propagate for all
                              log_->info("Propagate commit {} to whole network",
                                         vote.hash.block_hash);
-                             notifier_.get_subscriber().on_next(commit);
+                             this->emitCommit(commit);
                              this->propagateCommit(commit);
                            },
                            [&](const RejectMessage &reject) {
@@ -259,13 +352,14 @@ namespace iroha {
                              });
             };
           }
+          this->closeRound(proposal_hash);
         };
       }
 
       // ------|Propagation|------
 
       void Yac::propagateCommit(CommitMessage msg) {
-        for (const auto &peer : cluster_order_.getPeers()) {
+        for (const auto &peer : propagation_->originTargets(cluster_order_)) {
           propagateCommitDirectly(peer, msg);
         }
       }
@@ -275,7 +369,7 @@ namespace iroha {
       }
 
       void Yac::propagateReject(RejectMessage msg) {
-        for (const auto &peer : cluster_order_.getPeers()) {
+        for (const auto &peer : propagation_->originTargets(cluster_order_)) {
           propagateRejectDirectly(peer, msg);
         }
       }
@@ -284,6 +378,18 @@ namespace iroha {
         network_->send_reject(std::move(to), std::move(msg));
       }
 
+      void Yac::relayCommit(const CommitMessage &msg) {
+        for (const auto &peer : propagation_->relayTargets(cluster_order_)) {
+          propagateCommitDirectly(peer, msg);
+        }
+      }
+
+      void Yac::relayReject(const RejectMessage &msg) {
+        for (const auto &peer : propagation_->relayTargets(cluster_order_)) {
+          propagateRejectDirectly(peer, msg);
+        }
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
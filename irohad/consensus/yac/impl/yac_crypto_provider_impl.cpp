@@ -16,37 +16,63 @@
  */
 
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
 #include "consensus/yac/transport/yac_pb_converters.hpp"
+#include "cryptography/ed25519_sha3_impl/batch_verifier.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
-      CryptoProviderImpl::CryptoProviderImpl(const keypair_t &keypair)
-          : keypair_(keypair) {}
+      namespace {
+        /**
+         * Key of vote in cache of verified votes, which consists of all
+         * signed data and signature. Proposal hash is prefixed with its
+         * length, the rest of fields except block hash have fixed size
+         */
+        std::string cacheKey(const VoteMessage &vote) {
+          return std::to_string(vote.hash.proposal_hash.size()) + ":"
+              + vote.hash.proposal_hash
+              + vote.hash.block_signature.pubkey.to_string()
+              + vote.hash.block_signature.signature.to_string()
+              + vote.signature.pubkey.to_string()
+              + vote.signature.signature.to_string() + vote.hash.block_hash;
+        }
+      }  // namespace
+
+      const size_t CryptoProviderImpl::kDefaultCacheCapacity;
+
+      CryptoProviderImpl::CryptoProviderImpl(const keypair_t &keypair,
+                                             size_t cache_capacity)
+          : keypair_(keypair), cache_capacity_(cache_capacity) {}
 
       bool CryptoProviderImpl::verify(CommitMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verifyVotes(msg.votes);
       }
 
       bool CryptoProviderImpl::verify(RejectMessage msg) {
-        return std::all_of(
-            std::begin(msg.votes),
-            std::end(msg.votes),
-            [this](const auto &vote) { return this->verify(vote); });
+        return verifyVotes(msg.votes);
       }
 
       bool CryptoProviderImpl::verify(VoteMessage msg) {
-        return iroha::verify(
+        auto key = cacheKey(msg);
+        if (isVerified(key)) {
+          return true;
+        }
+        auto valid = iroha::verify(
             iroha::sha3_256(
                 PbConverters::serializeVote(msg).hash().SerializeAsString())
                 .to_string(),
             msg.signature.pubkey,
             msg.signature.signature);
+        if (valid) {
+          markVerified(key);
+        }
+        return valid;
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
@@ -63,6 +89,71 @@ namespace iroha {
         return vote;
       }
 
+      CryptoProviderImpl::Metrics CryptoProviderImpl::metrics() const {
+        return {hits_.load(), misses_.load()};
+      }
+
+      // --------| private api |--------
+
+      bool CryptoProviderImpl::verifyVotes(
+          const std::vector<VoteMessage> &votes) {
+        std::vector<shared_model::crypto::BatchVerifier::Item> items;
+        std::vector<std::string> keys;
+        // votes of a commit usually share the same hash, so each distinct
+        // hash is serialized and hashed only once
+        std::unordered_map<std::string, hash256_t> hashes;
+        for (const auto &vote : votes) {
+          auto key = cacheKey(vote);
+          if (isVerified(key)) {
+            continue;
+          }
+          auto serialized =
+              PbConverters::serializeVote(vote).hash().SerializeAsString();
+          auto it = hashes.find(serialized);
+          if (it == hashes.end()) {
+            auto hash = iroha::sha3_256(serialized);
+            it = hashes.emplace(std::move(serialized), hash).first;
+          }
+          items.push_back(
+              {it->second, vote.signature.pubkey, vote.signature.signature});
+          keys.push_back(std::move(key));
+        }
+
+        auto valid = shared_model::crypto::BatchVerifier::verify(items);
+        for (size_t i = 0; i < valid.size(); ++i) {
+          if (valid[i]) {
+            markVerified(keys[i]);
+          }
+        }
+        return std::all_of(
+            valid.begin(), valid.end(), [](bool is_valid) { return is_valid; });
+      }
+
+      bool CryptoProviderImpl::isVerified(const std::string &key) {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        auto it = verified_.find(key);
+        if (it == verified_.end()) {
+          ++misses_;
+          return false;
+        }
+        ++hits_;
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return true;
+      }
+
+      void CryptoProviderImpl::markVerified(const std::string &key) {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        if (cache_capacity_ == 0 or verified_.count(key) != 0) {
+          return;
+        }
+        if (verified_.size() >= cache_capacity_) {
+          verified_.erase(lru_.back());
+          lru_.pop_back();
+        }
+        lru_.push_front(key);
+        verified_.emplace(key, lru_.begin());
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -20,12 +20,40 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types.hpp"
+
 namespace iroha {
   namespace consensus {
     namespace yac {
+      /**
+       * Crypto provider, which remembers recently verified votes.
+       * The same vote arrives directly and inside of commit and reject
+       * messages, so it is verified only once while it stays in cache
+       */
       class CryptoProviderImpl : public YacCryptoProvider {
        public:
-        explicit CryptoProviderImpl(const keypair_t &keypair);
+        /// default number of verified votes in cache
+        static const size_t kDefaultCacheCapacity = 10000;
+
+        struct Metrics {
+          size_t hits;
+          size_t misses;
+        };
+
+        /**
+         * @param keypair - keypair of peer for signing votes
+         * @param cache_capacity - maximal number of verified votes in cache
+         */
+        explicit CryptoProviderImpl(
+            const keypair_t &keypair,
+            size_t cache_capacity = kDefaultCacheCapacity);
 
         bool verify(CommitMessage msg) override;
 
@@ -35,8 +63,41 @@ namespace iroha {
 
         VoteMessage getVote(YacHash hash) override;
 
+        /**
+         * @return number of verified votes found and not found in cache
+         */
+        Metrics metrics() const;
+
        private:
+        /**
+         * Verify votes, which are not in cache, at once
+         * @param votes - votes to verify
+         * @return true if all signatures are valid
+         */
+        bool verifyVotes(const std::vector<VoteMessage> &votes);
+
+        /**
+         * @return true if vote is in cache, and mark it as recently used
+         */
+        bool isVerified(const std::string &key);
+
+        /**
+         * Put vote with valid signature to cache, evicting least recently
+         * used vote when cache is full
+         */
+        void markVerified(const std::string &key);
+
         keypair_t keypair_;
+
+        const size_t cache_capacity_;
+        /// keys of verified votes, most recently used first
+        std::list<std::string> lru_;
+        std::unordered_map<std::string, std::list<std::string>::iterator>
+            verified_;
+        std::mutex cache_mutex_;
+
+        std::atomic<size_t> hits_{0};
+        std::atomic<size_t> misses_{0};
       };
     }  // namespace yac
   }    // namespace consensus
@@ -16,6 +16,9 @@
  */
 
 #include "consensus/yac/impl/yac_gate_impl.hpp"
+
+#include <algorithm>
+
 #include "consensus/yac/cluster_order.hpp"
 #include "consensus/yac/messages.hpp"
 #include "consensus/yac/storage/yac_common.hpp"
@@ -28,6 +31,8 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      const size_t YacGateImpl::kMaxVotedBlocks;
+
       YacGateImpl::YacGateImpl(
           std::shared_ptr<HashGate> hash_gate,
           std::shared_ptr<YacPeerOrderer> orderer,
@@ -55,7 +60,13 @@ namespace iroha {
           log_->error("ordering doesn't provide peers => pass round");
           return;
         }
-        current_block_ = std::make_pair(hash, block);
+        {
+          std::lock_guard<std::mutex> lock(voted_blocks_mutex_);
+          voted_blocks_.emplace_back(hash, block);
+          if (voted_blocks_.size() > kMaxVotedBlocks) {
+            voted_blocks_.pop_front();
+          }
+        }
         hash_gate_->vote(hash, order.value());
       }
 
@@ -71,13 +82,14 @@ namespace iroha {
                   return;
                 }
                 // if node has voted for the committed block
-                if (hash == current_block_.first) {
+                auto voted_block = this->takeVotedBlock(hash.value());
+                if (voted_block) {
                   // append signatures of other nodes
-                  this->copySignatures(commit_message);
+                  this->copySignatures(commit_message, *voted_block);
                   log_->info("consensus: commit top block: height {}, hash {}",
-                             current_block_.second.height,
-                             current_block_.second.hash.to_hexstring());
-                  subscriber.on_next(current_block_.second);
+                             voted_block->height,
+                             voted_block->hash.to_hexstring());
+                  subscriber.on_next(*voted_block);
                   subscriber.on_completed();
                   return;
                 }
@@ -124,11 +136,27 @@ namespace iroha {
         });
       }
 
-      void YacGateImpl::copySignatures(const CommitMessage &commit) {
-        current_block_.second.sigs.clear();
+      void YacGateImpl::copySignatures(const CommitMessage &commit,
+                                       model::Block &block) {
+        block.sigs.clear();
         for (const auto &vote : commit.votes) {
-          current_block_.second.sigs.push_back(vote.hash.block_signature);
+          block.sigs.push_back(vote.hash.block_signature);
+        }
+      }
+
+      nonstd::optional<model::Block> YacGateImpl::takeVotedBlock(
+          const YacHash &hash) {
+        std::lock_guard<std::mutex> lock(voted_blocks_mutex_);
+        auto it = std::find_if(
+            voted_blocks_.begin(), voted_blocks_.end(), [&hash](auto &voted) {
+              return voted.first == hash;
+            });
+        if (it == voted_blocks_.end()) {
+          return nonstd::nullopt;
         }
+        auto block = std::move(it->second);
+        voted_blocks_.erase(voted_blocks_.begin(), std::next(it));
+        return block;
       }
     }  // namespace yac
   }    // namespace consensus
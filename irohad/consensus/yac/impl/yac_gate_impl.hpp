@@ -18,7 +18,10 @@
 #ifndef IROHA_YAC_GATE_IMPL_HPP
 #define IROHA_YAC_GATE_IMPL_HPP
 
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <nonstd/optional.hpp>
 #include <rxcpp/rx-observable.hpp>
 #include "consensus/yac/yac_gate.hpp"
 #include "consensus/yac/yac_hash_provider.hpp"
@@ -43,6 +46,9 @@ namespace iroha {
 
       class YacGateImpl : public YacGate {
        public:
+        /// max number of voted, but not committed blocks
+        static const size_t kMaxVotedBlocks = 2;
+
         YacGateImpl(std::shared_ptr<HashGate> hash_gate,
                     std::shared_ptr<YacPeerOrderer> orderer,
                     std::shared_ptr<YacHashProvider> hash_provider,
@@ -54,10 +60,19 @@ namespace iroha {
 
        private:
         /**
-         * Update current block with signatures from commit message
+         * Update block with signatures from commit message
          * @param commit - commit message to get signatures from
+         * @param block - block to update
+         */
+        void copySignatures(const CommitMessage &commit, model::Block &block);
+
+        /**
+         * Take voted block with given hash, and forget it and blocks voted
+         * before it
+         * @param hash - committed hash
+         * @return voted block, if the peer has voted for the hash
          */
-        void copySignatures(const CommitMessage &commit);
+        nonstd::optional<model::Block> takeVotedBlock(const YacHash &hash);
 
         std::shared_ptr<HashGate> hash_gate_;
         std::shared_ptr<YacPeerOrderer> orderer_;
@@ -69,7 +84,13 @@ namespace iroha {
 
         logger::Logger log_;
 
-        std::pair<YacHash, model::Block> current_block_;
+        /**
+         * Blocks which the peer has voted for, and which are not committed
+         * yet, in voting order. More than one block is voted for in pipelined
+         * consensus
+         */
+        std::deque<std::pair<YacHash, model::Block>> voted_blocks_;
+        std::mutex voted_blocks_mutex_;
       };
 
     }  // namespace yac
@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "consensus/yac/yac_propagation_strategy.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      std::vector<model::Peer> BroadcastPropagation::originTargets(
+          const ClusterOrdering &order) const {
+        return order.getPeers();
+      }
+
+      std::vector<model::Peer> BroadcastPropagation::relayTargets(
+          const ClusterOrdering &order) const {
+        return {};
+      }
+
+      GossipPropagation::GossipPropagation(pubkey_t self, size_t fanout)
+          : self_(std::move(self)), fanout_(fanout) {}
+
+      std::vector<model::Peer> GossipPropagation::originTargets(
+          const ClusterOrdering &order) const {
+        auto peers = order.getPeers();
+        std::sort(peers.begin(), peers.end(), [](const auto &a, const auto &b) {
+          return a.pubkey < b.pubkey;
+        });
+        // peer outside of cluster takes place of the next one
+        size_t self = std::lower_bound(peers.begin(),
+                                       peers.end(),
+                                       self_,
+                                       [](const auto &peer, const auto &key) {
+                                         return peer.pubkey < key;
+                                       })
+            - peers.begin();
+
+        std::vector<model::Peer> targets;
+        for (size_t distance = 1;
+             distance < peers.size() and targets.size() < fanout_;
+             distance *= 2) {
+          targets.push_back(peers[(self + distance) % peers.size()]);
+        }
+        return targets;
+      }
+
+      std::vector<model::Peer> GossipPropagation::relayTargets(
+          const ClusterOrdering &order) const {
+        return originTargets(order);
+      }
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
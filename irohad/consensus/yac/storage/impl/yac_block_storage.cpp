@@ -36,22 +36,14 @@ namespace iroha {
       }
 
       nonstd::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
-        if (validScheme(msg) and uniqueVote(msg)) {
-          votes_.push_back(msg);
-
-          log_->info("Vote ({}, {}) inserted",
-                     msg.hash.proposal_hash,
-                     msg.hash.block_hash);
-          log_->info(
-              "Votes in storage [{}/{}]", votes_.size(), peers_in_round_);
-        }
+        insertVote(msg);
         return getState();
       }
 
       nonstd::optional<Answer> YacBlockStorage::insert(
-          std::vector<VoteMessage> votes) {
-        std::for_each(votes.begin(), votes.end(), [this](auto vote) {
-          this->insert(vote);
+          const std::vector<VoteMessage> &votes) {
+        std::for_each(votes.begin(), votes.end(), [this](const auto &vote) {
+          this->insertVote(vote);
         });
         return getState();
       }
@@ -73,23 +65,36 @@ namespace iroha {
       }
 
       bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-        return std::count(votes_.begin(), votes_.end(), msg) != 0;
+        auto voter = voters_.find(msg.signature.pubkey);
+        return voter != voters_.end() and votes_[voter->second] == msg
+            and votes_[voter->second].hash.block_signature
+            == msg.hash.block_signature;
       }
 
-      YacHash YacBlockStorage::getStorageHash() {
+      const YacHash &YacBlockStorage::getStorageHash() const {
         return hash_;
       }
 
       // --------| private api |--------
 
-      bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+      void YacBlockStorage::insertVote(const VoteMessage &msg) {
+        if (validScheme(msg) and uniqueVote(msg)) {
+          voters_.emplace(msg.signature.pubkey, votes_.size());
+          votes_.push_back(msg);
+
+          log_->info("Vote ({}, {}) inserted",
+                     msg.hash.proposal_hash,
+                     msg.hash.block_hash);
+          log_->info(
+              "Votes in storage [{}/{}]", votes_.size(), peers_in_round_);
+        }
+      }
+
+      bool YacBlockStorage::uniqueVote(const VoteMessage &msg) const {
+        return voters_.count(msg.signature.pubkey) == 0;
       }
 
-      bool YacBlockStorage::validScheme(VoteMessage &vote) {
+      bool YacBlockStorage::validScheme(const VoteMessage &vote) const {
         return getStorageHash() == vote.hash;
       }
 
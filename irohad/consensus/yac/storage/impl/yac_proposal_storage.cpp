@@ -30,21 +30,15 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacProposalStorage::findStore(ProposalHash proposal_hash,
-                                         BlockHash block_hash) {
+      auto YacProposalStorage::findStore(const ProposalHash &proposal_hash,
+                                         const BlockHash &block_hash) {
         // find exist
-        auto iter =
-            std::find_if(block_storages_.begin(),
-                         block_storages_.end(),
-                         [&proposal_hash, &block_hash](auto block_storage) {
-                           auto yac_hash = block_storage.getStorageHash();
-                           return yac_hash.proposal_hash == proposal_hash
-                               and yac_hash.block_hash == block_hash;
-                         });
-        if (iter != block_storages_.end()) {
-          return iter;
+        auto index = block_index_.find(block_hash);
+        if (index != block_index_.end()) {
+          return block_storages_.begin() + index->second;
         }
         // insert and return new
+        block_index_.emplace(block_hash, block_storages_.size());
         return block_storages_.emplace(block_storages_.end(),
                                        YacHash(proposal_hash, block_hash),
                                        peers_in_round_);
@@ -61,6 +55,36 @@ namespace iroha {
       }
 
       nonstd::optional<Answer> YacProposalStorage::insert(VoteMessage msg) {
+        insertVote(msg);
+        return getState();
+      }
+
+      nonstd::optional<Answer> YacProposalStorage::insert(
+          const std::vector<VoteMessage> &messages) {
+        std::for_each(
+            messages.begin(), messages.end(), [this](const auto &vote) {
+              this->insertVote(vote);
+            });
+        return getState();
+      }
+
+      ProposalHash YacProposalStorage::getProposalHash() {
+        return hash_;
+      }
+
+      nonstd::optional<Answer> YacProposalStorage::getState() const {
+        return current_state_;
+      }
+
+      bool YacProposalStorage::isContains(const VoteMessage &msg) const {
+        auto index = block_index_.find(msg.hash.block_hash);
+        return index != block_index_.end()
+            and block_storages_[index->second].isContains(msg);
+      }
+
+      // --------| private api |--------
+
+      void YacProposalStorage::insertVote(const VoteMessage &msg) {
         if (shouldInsert(msg)) {
           // insert to block store
 
@@ -85,26 +109,8 @@ namespace iroha {
             }
           }
         }
-        return getState();
-      }
-
-      nonstd::optional<Answer> YacProposalStorage::insert(
-          std::vector<VoteMessage> messages) {
-        std::for_each(messages.begin(), messages.end(), [this](auto vote) {
-          this->insert(std::move(vote));
-        });
-        return getState();
-      }
-      ProposalHash YacProposalStorage::getProposalHash() {
-        return hash_;
-      }
-
-      nonstd::optional<Answer> YacProposalStorage::getState() const {
-        return current_state_;
       }
 
-      // --------| private api |--------
-
       bool YacProposalStorage::shouldInsert(const VoteMessage &msg) {
         return checkProposalHash(msg.hash.proposal_hash)
             and checkPeerUniqueness(msg);
@@ -115,14 +121,7 @@ namespace iroha {
       }
 
       bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(),
-                           block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageHash() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
+        return not isContains(msg);
       }
 
       nonstd::optional<Answer> YacProposalStorage::findRejectProof() {
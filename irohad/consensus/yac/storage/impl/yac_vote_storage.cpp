@@ -17,7 +17,7 @@
 
 #include "consensus/yac/storage/yac_vote_storage.hpp"
 
-#include <algorithm>
+#include <tuple>
 #include <utility>
 
 #include "consensus/yac/storage/yac_proposal_storage.hpp"
@@ -28,12 +28,8 @@ namespace iroha {
 
       // --------| private api |--------
 
-      auto YacVoteStorage::getProposalStorage(ProposalHash hash) {
-        return std::find_if(proposal_storages_.begin(),
-                            proposal_storages_.end(),
-                            [&hash](auto storage) {
-                              return storage.getProposalHash() == hash;
-                            });
+      auto YacVoteStorage::getProposalStorage(const ProposalHash &hash) {
+        return proposal_storages_.find(hash);
       }
 
       auto YacVoteStorage::findProposalStorage(const VoteMessage &msg,
@@ -42,15 +38,19 @@ namespace iroha {
         if (val != proposal_storages_.end()) {
           return val;
         }
-        return proposal_storages_.emplace(
-            proposal_storages_.end(), msg.hash.proposal_hash, peers_in_round);
+        return proposal_storages_
+            .emplace(std::piecewise_construct,
+                     std::forward_as_tuple(msg.hash.proposal_hash),
+                     std::forward_as_tuple(msg.hash.proposal_hash,
+                                           peers_in_round))
+            .first;
       }
 
       // --------| public api |--------
 
       nonstd::optional<Answer> YacVoteStorage::store(VoteMessage vote,
                                                      uint64_t peers_in_round) {
-        return findProposalStorage(vote, peers_in_round)->insert(vote);
+        return findProposalStorage(vote, peers_in_round)->second.insert(vote);
       }
 
       nonstd::optional<Answer> YacVoteStorage::store(CommitMessage commit,
@@ -64,11 +64,17 @@ namespace iroha {
       }
 
       bool YacVoteStorage::isHashCommitted(ProposalHash hash) {
-        auto iter = getProposalStorage(std::move(hash));
+        auto iter = getProposalStorage(hash);
         if (iter == proposal_storages_.end()) {
           return false;
         }
-        return iter->getState().has_value();
+        return iter->second.getState().has_value();
+      }
+
+      bool YacVoteStorage::isContains(const VoteMessage &msg) {
+        auto iter = getProposalStorage(msg.hash.proposal_hash);
+        return iter != proposal_storages_.end()
+            and iter->second.isContains(msg);
       }
 
       bool YacVoteStorage::getProcessingState(const ProposalHash &hash) {
@@ -88,7 +94,7 @@ namespace iroha {
         }
 
         auto storage = findProposalStorage(votes.at(0), peers_in_round);
-        return storage->insert(votes);
+        return storage->second.insert(votes);
       }
 
     }  // namespace yac
@@ -18,7 +18,9 @@
 #ifndef IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
+#include <boost/functional/hash.hpp>
 #include <nonstd/optional.hpp>
+#include <unordered_map>
 #include <vector>
 
 #include "consensus/yac/messages.hpp"
@@ -37,11 +39,25 @@ namespace iroha {
        private:
         // --------| fields |--------
 
+        /**
+         * Hash function for voter public keys
+         */
+        struct PubkeyHasher {
+          std::size_t operator()(const pubkey_t &pubkey) const {
+            return boost::hash_range(pubkey.begin(), pubkey.end());
+          }
+        };
+
         /**
          * All votes stored in block store
          */
         std::vector<VoteMessage> votes_;
 
+        /**
+         * Position of vote in votes_ by public key of voted peer
+         */
+        std::unordered_map<pubkey_t, size_t, PubkeyHasher> voters_;
+
        public:
         YacBlockStorage(YacHash hash, uint64_t peers_in_round);
 
@@ -59,7 +75,7 @@ namespace iroha {
          * @return state of storage after insertion last vote,
          * nullopt when storage doesn't has supermajority
          */
-        nonstd::optional<Answer> insert(std::vector<VoteMessage> votes);
+        nonstd::optional<Answer> insert(const std::vector<VoteMessage> &votes);
 
         /**
          * @return votes attached to storage
@@ -79,31 +95,37 @@ namespace iroha {
         /**
          * Verify that passed vote contains in storage
          * @param msg  - vote for finding
-         * @return true, if contains
+         * @return true, if contains the same vote, including block signature
          */
         bool isContains(const VoteMessage &msg) const;
 
         /**
          * Provide hash attached to this storage
          */
-        YacHash getStorageHash();
+        const YacHash &getStorageHash() const;
 
        private:
         // --------| private api |--------
 
+        /**
+         * Insert vote to storage if it is valid and unique
+         * @param msg - vote for insertion
+         */
+        void insertVote(const VoteMessage &msg);
+
         /**
          * Verify uniqueness of vote in storage
          * @param msg - vote for verification
-         * @return true if vote doesn't appear in storage
+         * @return true if peer of vote hasn't voted in storage yet
          */
-        bool uniqueVote(VoteMessage &vote);
+        bool uniqueVote(const VoteMessage &msg) const;
 
         /**
          * Verify that vote has same proposal and
          * blocks hashes with storage
          * @return true, if validation passed
          */
-        bool validScheme(VoteMessage &vote);
+        bool validScheme(const VoteMessage &vote) const;
 
         // --------| fields |--------
 
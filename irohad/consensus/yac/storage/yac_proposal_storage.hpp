@@ -19,6 +19,7 @@
 #define IROHA_YAC_PROPOSAL_STORAGE_HPP
 
 #include <nonstd/optional.hpp>
+#include <unordered_map>
 #include <vector>
 
 #include "consensus/yac/storage/storage_result.hpp"
@@ -41,13 +42,14 @@ namespace iroha {
         // --------| private api |--------
 
         /**
-         * Find block index with provided parameters,
+         * Find block storage with provided parameters,
          * if those store absent - create new
          * @param proposal_hash - hash of proposal
          * @param block_hash - hash of block
          * @return iterator to storage
          */
-        auto findStore(ProposalHash proposal_hash, BlockHash block_hash);
+        auto findStore(const ProposalHash &proposal_hash,
+                       const BlockHash &block_hash);
 
        public:
         // --------| public api |--------
@@ -69,7 +71,8 @@ namespace iroha {
          * @return result, that contains actual state of storage,
          * after insertion of all votes.
          */
-        nonstd::optional<Answer> insert(std::vector<VoteMessage> messages);
+        nonstd::optional<Answer> insert(
+            const std::vector<VoteMessage> &messages);
 
         /**
          * Provides hash assigned for storage
@@ -81,9 +84,23 @@ namespace iroha {
          */
         nonstd::optional<Answer> getState() const;
 
+        /**
+         * Verify that passed vote contains in storage
+         * @param msg - vote for finding
+         * @return true, if contains
+         */
+        bool isContains(const VoteMessage &msg) const;
+
        private:
         // --------| private api |--------
 
+        /**
+         * Insert vote to block storage, if it is possible,
+         * and update current state
+         * @param msg - vote for insertion
+         */
+        void insertVote(const VoteMessage &msg);
+
         /**
          * Possible to insert vote
          * @param msg - vote for insertion
@@ -124,6 +141,12 @@ namespace iroha {
          */
         std::vector<YacBlockStorage> block_storages_;
 
+        /**
+         * Position of block storage in block_storages_ by block hash.
+         * Proposal hash is the same for all storages
+         */
+        std::unordered_map<BlockHash, size_t> block_index_;
+
         /**
          * Hash of proposal
          */
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <nonstd/optional.hpp>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -42,9 +43,9 @@ namespace iroha {
         /**
          * Retrieve iterator for storage with parameters hash
          * @param hash - object for finding
-         * @return iterator to proposal storage
+         * @return iterator to pair of hash and proposal storage
          */
-        auto getProposalStorage(ProposalHash hash);
+        auto getProposalStorage(const ProposalHash &hash);
 
         /**
          * Find existed proposal storage or create new if required
@@ -52,7 +53,7 @@ namespace iroha {
          * @param peers_in_round - number of peer required
          * for verify supermajority;
          * This parameter used on creation of proposal storage
-         * @return - iter for required proposal storage
+         * @return - iter for pair of hash and required proposal storage
          */
         auto findProposalStorage(const VoteMessage &msg,
                                  uint64_t peers_in_round);
@@ -96,6 +97,13 @@ namespace iroha {
          */
         bool isHashCommitted(ProposalHash hash);
 
+        /**
+         * Verify that exactly the same vote is already stored
+         * @param msg - vote for finding
+         * @return true, if vote is stored
+         */
+        bool isContains(const VoteMessage &msg);
+
         /**
          * Method provide state of processing for concrete hash
          * @param hash - target tag
@@ -124,9 +132,10 @@ namespace iroha {
         // --------| fields |--------
 
         /**
-         * Active proposal storages
+         * Active proposal storages by proposal hash
          */
-        std::vector<YacProposalStorage> proposal_storages_;
+        std::unordered_map<ProposalHash, YacProposalStorage>
+            proposal_storages_;
 
         /**
          * Processing set provide user flags about processing some hashes.
@@ -19,6 +19,7 @@
 #define IROHA_YAC_TIMER_HPP
 
 #include <functional>
+#include <memory>
 
 namespace iroha {
   namespace consensus {
@@ -44,6 +45,11 @@ namespace iroha {
 
         virtual ~Timer() = default;
       };
+
+      /**
+       * Creates independent timer for each voting round
+       */
+      using TimerFactory = std::function<std::shared_ptr<Timer>()>;
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -18,8 +18,10 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
 #include <grpc++/grpc++.h>
+#include <algorithm>
 #include <memory>
 
+#include "consensus/yac/cluster_order.hpp"
 #include "consensus/yac/messages.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "logger/logger.hpp"
@@ -29,7 +31,8 @@ namespace iroha {
     namespace yac {
       // ----------| Public API |----------
 
-      NetworkImpl::NetworkImpl() {
+      NetworkImpl::NetworkImpl()
+          : cluster_peers_(std::make_shared<std::vector<model::Peer>>()) {
         log_ = logger::log("YacNetwork");
       }
 
@@ -38,23 +41,31 @@ namespace iroha {
         handler_ = handler;
       }
 
-      void NetworkImpl::send_vote(model::Peer to, VoteMessage vote) {
-        createPeerConnection(to);
+      void NetworkImpl::setCluster(const ClusterOrdering &order) {
+        auto peers = order.getPeers();
+        std::sort(peers.begin(), peers.end(), [](const auto &a, const auto &b) {
+          return a.pubkey < b.pubkey;
+        });
+        std::lock_guard<std::mutex> lock(cluster_mutex_);
+        if (peers != *cluster_peers_) {
+          cluster_peers_ =
+              std::make_shared<const std::vector<model::Peer>>(std::move(peers));
+        }
+      }
 
+      void NetworkImpl::send_vote(model::Peer to, VoteMessage vote) {
         auto request = PbConverters::serializeVote(vote);
 
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to)->AsyncSendVote(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        auto stub = channels_->stub<proto::Yac>(to.address);
+        asyncCall(to.address, [&](auto context, auto cq) {
+          return stub->AsyncSendVote(context, request, cq);
+        });
 
         log_->info("Send vote {} to {}", vote.hash.block_hash, to.address);
       }
 
       void NetworkImpl::send_commit(model::Peer to, CommitMessage commit) {
-        createPeerConnection(to);
+        auto stub = channels_->stub<proto::Yac>(to.address);
 
         proto::Commit request;
         for (const auto &vote : commit.votes) {
@@ -62,12 +73,44 @@ namespace iroha {
           *pb_vote = PbConverters::serializeVote(vote);
         }
 
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to)->AsyncSendCommit(&call->context, request, &cq_);
+        auto certificate =
+            PbConverters::serializeCertificate(commit, *clusterPeers());
+        if (certificate) {
+          // receiver with another cluster can not decode the certificate,
+          // full commit is sent then
+          auto on_finish = [client = network::AsyncGrpcClient<
+                                google::protobuf::Empty>(channels_, poller_),
+                            address = to.address,
+                            request = std::move(request),
+                            log = log_](const grpc::Status &status) mutable {
+            if (status.error_code() != grpc::StatusCode::FAILED_PRECONDITION) {
+              return;
+            }
+            auto stub = client.channels_->stub<proto::Yac>(address);
+            client.asyncCall(address, [&](auto context, auto cq) {
+              return stub->AsyncSendCommit(context, request, cq);
+            });
+            log->info("Send votes bundle[size={}] commit to {} with another "
+                      "cluster",
+                      request.votes_size(),
+                      address);
+          };
+          asyncCall(to.address,
+                    [&](auto context, auto cq) {
+                      return stub->AsyncSendCommitCertificate(
+                          context, *certificate, cq);
+                    },
+                    std::move(on_finish));
+
+          log_->info("Send commit certificate[size={}] to {}",
+                     commit.votes.size(),
+                     to.address);
+          return;
+        }
 
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        asyncCall(to.address, [&](auto context, auto cq) {
+          return stub->AsyncSendCommit(context, request, cq);
+        });
 
         log_->info("Send votes bundle[size={}] commit to {}",
                    commit.votes.size(),
@@ -75,20 +118,16 @@ namespace iroha {
       }
 
       void NetworkImpl::send_reject(model::Peer to, RejectMessage reject) {
-        createPeerConnection(to);
-
         proto::Reject request;
         for (const auto &vote : reject.votes) {
           auto pb_vote = request.add_votes();
           *pb_vote = PbConverters::serializeVote(vote);
         }
 
-        auto call = new AsyncClientCall;
-
-        call->response_reader =
-            peers_.at(to)->AsyncSendReject(&call->context, request, &cq_);
-
-        call->response_reader->Finish(&call->reply, &call->status, call);
+        auto stub = channels_->stub<proto::Yac>(to.address);
+        asyncCall(to.address, [&](auto context, auto cq) {
+          return stub->AsyncSendReject(context, request, cq);
+        });
 
         log_->info("Send votes bundle[size={}] reject to {}",
                    reject.votes.size(),
@@ -144,11 +183,39 @@ namespace iroha {
         return grpc::Status::OK;
       }
 
-      void NetworkImpl::createPeerConnection(const model::Peer &peer) {
-        if (peers_.count(peer) == 0) {
-          peers_[peer] = proto::Yac::NewStub(grpc::CreateChannel(
-              peer.address, grpc::InsecureChannelCredentials()));
+      grpc::Status NetworkImpl::SendCommitCertificate(
+          ::grpc::ServerContext *context,
+          const ::iroha::consensus::yac::proto::CommitCertificate *request,
+          ::google::protobuf::Empty *response) {
+        auto peers = clusterPeers();
+        if (not PbConverters::isSameCluster(*request, *peers)) {
+          log_->warn("Receive commit certificate of another cluster from {}",
+                     context->peer());
+          return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                              "Commit certificate of another cluster");
+        }
+        auto commit = PbConverters::deserializeCertificate(*request, *peers);
+        if (not commit) {
+          log_->warn("Receive malformed commit certificate from {}",
+                     context->peer());
+          return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                              "Malformed commit certificate");
         }
+
+        log_->info("Receive commit certificate[size={}] from {}",
+                   commit->votes.size(),
+                   context->peer());
+
+        handler_.lock()->on_commit(*commit);
+        return grpc::Status::OK;
+      }
+
+      // ----------| Private API |----------
+
+      std::shared_ptr<const std::vector<model::Peer>>
+      NetworkImpl::clusterPeers() {
+        std::lock_guard<std::mutex> lock(cluster_mutex_);
+        return cluster_peers_;
       }
 
     }  // namespace yac
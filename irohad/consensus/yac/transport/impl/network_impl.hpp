@@ -21,7 +21,8 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 
 #include <memory>
-#include <unordered_map>
+#include <mutex>
+#include <vector>
 
 #include "logger/logger.hpp"
 #include "model/peer.hpp"  // for model::Peer
@@ -51,6 +52,7 @@ namespace iroha {
         NetworkImpl();
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
+        void setCluster(const ClusterOrdering &order) override;
         void send_commit(model::Peer to, CommitMessage commit) override;
         void send_reject(model::Peer to, RejectMessage reject) override;
         void send_vote(model::Peer to, VoteMessage vote) override;
@@ -85,19 +87,28 @@ namespace iroha {
             const ::iroha::consensus::yac::proto::Reject *request,
             ::google::protobuf::Empty *response) override;
 
+        /**
+         * Receive commit certificate from another peer;
+         * Naming is confusing, because this is rpc call that
+         * perform on another machine;
+         */
+        grpc::Status SendCommitCertificate(
+            ::grpc::ServerContext *context,
+            const ::iroha::consensus::yac::proto::CommitCertificate *request,
+            ::google::protobuf::Empty *response) override;
+
        private:
         /**
-         * Create GRPC connection for given peer if it does not exist in
-         * peers map
-         * @param peer to instantiate connection with
+         * @return peers of cluster, ordered by public key
          */
-        void createPeerConnection(const model::Peer &peer);
+        std::shared_ptr<const std::vector<model::Peer>> clusterPeers();
 
         /**
-         * Mapping of peer objects to connections
+         * Peers of cluster, ordered by public key.
+         * Commits are sent as certificates over those peers
          */
-        std::unordered_map<model::Peer, std::unique_ptr<proto::Yac::Stub>>
-            peers_;
+        std::shared_ptr<const std::vector<model::Peer>> cluster_peers_;
+        std::mutex cluster_mutex_;
 
         /**
          * Subscriber of network messages
@@ -29,6 +29,7 @@ namespace iroha {
   namespace consensus {
     namespace yac {
 
+      class ClusterOrdering;
       struct CommitMessage;
       struct RejectMessage;
       struct VoteMessage;
@@ -61,6 +62,13 @@ namespace iroha {
         virtual void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) = 0;
 
+        /**
+         * Set peers of consensus cluster, which transport may use for
+         * compact encoding of messages
+         * @param order - ordering of current round
+         */
+        virtual void setCluster(const ClusterOrdering &order) = 0;
+
         /**
          * Directly share commit message
          * @param to - peer recipient
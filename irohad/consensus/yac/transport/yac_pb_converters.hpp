@@ -18,8 +18,13 @@
 #ifndef IROHA_YAC_PB_CONVERTERS_HPP
 #define IROHA_YAC_PB_CONVERTERS_HPP
 
+#include <algorithm>
+#include <vector>
+
 #include "common/byteutils.hpp"
 #include "consensus/yac/messages.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "model/peer.hpp"
 #include "yac.pb.h"
 
 namespace iroha {
@@ -65,6 +70,149 @@ namespace iroha {
 
           return vote;
         }
+
+        /**
+         * Serialize commit to certificate, where voters are marked
+         * in bitmap over peers of cluster
+         * @param commit - commit for serialization
+         * @param peers - peers of cluster, ordered by public key
+         * @return certificate, or nullopt if votes have different hashes,
+         * some voter is not in cluster, votes twice or signs block with
+         * another key
+         */
+        static nonstd::optional<proto::CommitCertificate> serializeCertificate(
+            const CommitMessage &commit,
+            const std::vector<model::Peer> &peers) {
+          if (commit.votes.empty()) {
+            return nonstd::nullopt;
+          }
+          const auto &hash = commit.votes.front().hash;
+          // position of voter in cluster and vote
+          std::vector<std::pair<size_t, const VoteMessage *>> signers;
+          for (const auto &vote : commit.votes) {
+            if (vote.hash != hash
+                or vote.hash.block_signature.pubkey != vote.signature.pubkey) {
+              return nonstd::nullopt;
+            }
+            auto peer = findPeer(peers, vote.signature.pubkey);
+            if (peer == peers.size()) {
+              return nonstd::nullopt;
+            }
+            signers.emplace_back(peer, &vote);
+          }
+          std::sort(signers.begin(), signers.end());
+
+          proto::CommitCertificate certificate;
+          certificate.set_proposal(hash.proposal_hash);
+          certificate.set_block(hash.block_hash);
+          std::string bitmap((peers.size() + 7) / 8, 0);
+          for (auto it = signers.begin(); it != signers.end(); ++it) {
+            if (it != signers.begin() and std::prev(it)->first == it->first) {
+              return nonstd::nullopt;
+            }
+            bitmap[it->first / 8] |= 1 << (it->first % 8);
+            certificate.add_block_signatures(
+                it->second->hash.block_signature.signature.to_string());
+            certificate.add_signatures(
+                it->second->signature.signature.to_string());
+          }
+          certificate.set_signers(bitmap);
+          certificate.set_cluster(clusterDigest(peers));
+          certificate.set_cluster_size(peers.size());
+          return certificate;
+        }
+
+        /**
+         * @param certificate - received certificate
+         * @param peers - peers of cluster, ordered by public key
+         * @return true if certificate was created over the same cluster
+         */
+        static bool isSameCluster(const proto::CommitCertificate &certificate,
+                                  const std::vector<model::Peer> &peers) {
+          return certificate.cluster_size() == peers.size()
+              and certificate.cluster() == clusterDigest(peers);
+        }
+
+        /**
+         * Restore votes of commit from certificate
+         * @param certificate - certificate for deserialization
+         * @param peers - peers of cluster, ordered by public key
+         * @return commit, or nullopt if certificate is malformed or created
+         * over another cluster
+         */
+        static nonstd::optional<CommitMessage> deserializeCertificate(
+            const proto::CommitCertificate &certificate,
+            const std::vector<model::Peer> &peers) {
+          const auto &bitmap = certificate.signers();
+          if (not isSameCluster(certificate, peers)
+              or bitmap.size() != (peers.size() + 7) / 8) {
+            return nonstd::nullopt;
+          }
+          CommitMessage commit(std::vector<VoteMessage>{});
+          for (size_t i = 0; i < peers.size(); ++i) {
+            if (not(bitmap[i / 8] & (1 << (i % 8)))) {
+              continue;
+            }
+            auto index = commit.votes.size();
+            if (index >= static_cast<size_t>(certificate.signatures_size())
+                or index >= static_cast<size_t>(
+                                certificate.block_signatures_size())) {
+              return nonstd::nullopt;
+            }
+            auto block_signature = stringToBlob<iroha::sig_t::size()>(
+                certificate.block_signatures(index));
+            auto signature = stringToBlob<iroha::sig_t::size()>(
+                certificate.signatures(index));
+            if (not block_signature or not signature) {
+              return nonstd::nullopt;
+            }
+            VoteMessage vote;
+            vote.hash.proposal_hash = certificate.proposal();
+            vote.hash.block_hash = certificate.block();
+            vote.hash.block_signature.signature = *block_signature;
+            vote.hash.block_signature.pubkey = peers[i].pubkey;
+            vote.signature.signature = *signature;
+            vote.signature.pubkey = peers[i].pubkey;
+            commit.votes.push_back(std::move(vote));
+          }
+          if (commit.votes.size()
+                  != static_cast<size_t>(certificate.signatures_size())
+              or commit.votes.size() != static_cast<size_t>(
+                                            certificate.block_signatures_size())
+              or commit.votes.empty()) {
+            return nonstd::nullopt;
+          }
+          return commit;
+        }
+
+       private:
+        /**
+         * @return hash of public keys of peers ordered by public key
+         */
+        static std::string clusterDigest(const std::vector<model::Peer> &peers) {
+          std::string keys;
+          for (const auto &peer : peers) {
+            keys += peer.pubkey.to_string();
+          }
+          return sha3_256(keys).to_string();
+        }
+
+        /**
+         * @return position of peer with given key in peers ordered by public
+         * key, or number of peers if it is absent
+         */
+        static size_t findPeer(const std::vector<model::Peer> &peers,
+                               const iroha::pubkey_t &pubkey) {
+          auto it = std::lower_bound(
+              peers.begin(),
+              peers.end(),
+              pubkey,
+              [](const auto &peer, const auto &key) { return peer.pubkey < key; });
+          if (it == peers.end() or it->pubkey != pubkey) {
+            return peers.size();
+          }
+          return it - peers.begin();
+        }
       };
     }  // namespace yac
   }    // namespace consensus
@@ -18,16 +18,20 @@
 #ifndef IROHA_YAC_HPP
 #define IROHA_YAC_HPP
 
+#include <atomic>
 #include <memory>
-#include <mutex>
+#include <unordered_map>
 #include <nonstd/optional.hpp>
 #include <rxcpp/rx-observable.hpp>
 
 #include "consensus/yac/cluster_order.hpp"  //  for ClusterOrdering
+#include "consensus/yac/impl/executor_impl.hpp"  // for ExecutorImpl
 #include "consensus/yac/messages.hpp"       // because messages passed by value
 #include "consensus/yac/storage/yac_vote_storage.hpp"  // for VoteStorage
+#include "consensus/yac/timer.hpp"  // for TimerFactory
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetworkNotifications
 #include "consensus/yac/yac_gate.hpp"                         // for HashGate
+#include "consensus/yac/yac_propagation_strategy.hpp"  // for BroadcastPropagation
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -40,28 +44,44 @@ namespace iroha {
     namespace yac {
 
       class YacCryptoProvider;
-      class Timer;
 
       class Yac : public HashGate, public YacNetworkNotifications {
        public:
         /**
          * Method for creating Yac consensus object
+         * @param timer_factory - creates retry timer for each voted proposal
          * @param delay for timer in milliseconds
+         * @param executor - threads, on which incoming messages are verified
+         * and applied to consensus state
          */
         static std::shared_ptr<Yac> create(
             YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
             std::shared_ptr<YacCryptoProvider> crypto,
-            std::shared_ptr<Timer> timer,
+            TimerFactory timer_factory,
             ClusterOrdering order,
-            uint64_t delay);
+            uint64_t delay,
+            std::unique_ptr<Executor> executor =
+                std::make_unique<ExecutorImpl>(),
+            std::shared_ptr<PropagationStrategy> propagation =
+                std::make_shared<BroadcastPropagation>());
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
             std::shared_ptr<YacCryptoProvider> crypto,
-            std::shared_ptr<Timer> timer,
+            TimerFactory timer_factory,
             ClusterOrdering order,
-            uint64_t delay);
+            uint64_t delay,
+            std::unique_ptr<Executor> executor =
+                std::make_unique<ExecutorImpl>(),
+            std::shared_ptr<PropagationStrategy> propagation =
+                std::make_shared<BroadcastPropagation>());
+
+        /**
+         * Stops the voting timers and finishes submitted tasks, so neither
+         * refers to destroyed fields
+         */
+        ~Yac() override;
 
         // ------|Hash gate|------
 
@@ -87,9 +107,10 @@ namespace iroha {
         void votingStep(VoteMessage vote);
 
         /**
-         * Erase temporary data of current round
+         * Erase temporary data of the round
+         * @param proposal_hash - proposal of the finished round
          */
-        void closeRound();
+        void closeRound(const ProposalHash &proposal_hash);
 
         /**
          * Find corresponding peer in the ledger from vote message
@@ -98,6 +119,21 @@ namespace iroha {
          */
         nonstd::optional<model::Peer> findPeer(const VoteMessage &vote);
 
+        /**
+         * Select votes of message, which are not stored yet.
+         * Stored votes are already verified, so only the rest of message
+         * requires crypto verification
+         * @param message - commit or reject message
+         * @return message with votes absent in storage
+         */
+        template <typename Message>
+        Message unknownVotes(const Message &message);
+
+        /**
+         * Deliver commit to subscribers apart from the consensus thread
+         */
+        void emitCommit(const CommitMessage &commit);
+
         // ------|Apply data|------
 
         /**
@@ -118,22 +154,48 @@ namespace iroha {
         void propagateReject(RejectMessage msg);
         void propagateRejectDirectly(model::Peer to, RejectMessage msg);
 
+        /**
+         * Forward message received from network, which is processed
+         * for the first time
+         */
+        void relayCommit(const CommitMessage &msg);
+        void relayReject(const RejectMessage &msg);
+
         // ------|Fields|------
         YacVoteStorage vote_storage_;
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
-        std::shared_ptr<Timer> timer_;
+        TimerFactory timer_factory_;
+        std::shared_ptr<PropagationStrategy> propagation_;
         rxcpp::subjects::subject<CommitMessage> notifier_;
-        std::mutex mutex_;
 
         // ------|One round|------
+        /**
+         * Data of vote propagation for a proposal. Rounds are pipelined, so
+         * each one retries on its own timer and is closed independently
+         */
+        struct Round {
+          ClusterOrdering order;
+          std::shared_ptr<Timer> timer;
+        };
+
+        /// order of the latest vote, used for storage and propagation
         ClusterOrdering cluster_order_;
+        /// rounds in progress, accessed only on the consensus thread
+        std::unordered_map<ProposalHash, Round> rounds_;
 
         // ------|Constants|------
         const uint64_t delay_;
 
         // ------|Logger|------
         logger::Logger log_;
+
+        // ------|Threads|------
+        /// set on destruction, so expired voting timer submits no task
+        std::atomic<bool> stopped_{false};
+        /// declared last, so running tasks are finished before other fields
+        /// are destroyed
+        std::unique_ptr<Executor> executor_;
       };
     }  // namespace yac
   }    // namespace consensus
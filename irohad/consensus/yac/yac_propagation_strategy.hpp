@@ -0,0 +1,97 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_YAC_PROPAGATION_STRATEGY_HPP
+#define IROHA_YAC_PROPAGATION_STRATEGY_HPP
+
+#include <vector>
+
+#include "consensus/yac/cluster_order.hpp"  // for ClusterOrdering
+#include "model/peer.hpp"                   // for model::Peer
+
+namespace iroha {
+  namespace consensus {
+    namespace yac {
+
+      /**
+       * Strategy of dissemination of commit and reject messages over cluster
+       */
+      class PropagationStrategy {
+       public:
+        /**
+         * Peers, to which the peer sends message it has collected itself
+         * @param order - ordering of current round
+         * @return recipients of message
+         */
+        virtual std::vector<model::Peer> originTargets(
+            const ClusterOrdering &order) const = 0;
+
+        /**
+         * Peers, to which the peer forwards message received from network
+         * for the first time
+         * @param order - ordering of current round
+         * @return recipients of message
+         */
+        virtual std::vector<model::Peer> relayTargets(
+            const ClusterOrdering &order) const = 0;
+
+        virtual ~PropagationStrategy() = default;
+      };
+
+      /**
+       * Peer which collected message sends it to every peer of cluster,
+       * received messages are not forwarded
+       */
+      class BroadcastPropagation : public PropagationStrategy {
+       public:
+        std::vector<model::Peer> originTargets(
+            const ClusterOrdering &order) const override;
+
+        std::vector<model::Peer> relayTargets(
+            const ClusterOrdering &order) const override;
+      };
+
+      /**
+       * Every peer sends message once to peers at distances 1, 2, 4, ...
+       * from itself in cluster, ordered by public key. Ordering by key is the
+       * same for all peers of cluster, regardless of round. Message reaches
+       * whole cluster in log2(N) hops when fanout is at least log2(N)
+       */
+      class GossipPropagation : public PropagationStrategy {
+       public:
+        /**
+         * @param self - public key of the peer
+         * @param fanout - maximal number of recipients of the peer
+         */
+        GossipPropagation(pubkey_t self, size_t fanout);
+
+        std::vector<model::Peer> originTargets(
+            const ClusterOrdering &order) const override;
+
+        std::vector<model::Peer> relayTargets(
+            const ClusterOrdering &order) const override;
+
+       private:
+        pubkey_t self_;
+        size_t fanout_;
+      };
+
+    }  // namespace yac
+  }    // namespace consensus
+}  // namespace iroha
+
+#endif  // IROHA_YAC_PROPAGATION_STRATEGY_HPP
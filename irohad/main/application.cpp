@@ -18,6 +18,8 @@
 #include "main/application.hpp"
 #include "ametsuchi/impl/postgres_ordering_service_persistent_state.hpp"
 
+#include <thread>
+
 using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::simulator;
@@ -42,7 +44,9 @@ Irohad::Irohad(const std::string &block_store_dir,
                std::chrono::milliseconds proposal_delay,
                std::chrono::milliseconds vote_delay,
                std::chrono::milliseconds load_delay,
-               const keypair_t &keypair)
+               const keypair_t &keypair,
+               bool pipelined_consensus,
+               size_t commit_gossip_fanout)
     : block_store_dir_(block_store_dir),
       pg_conn_(pg_conn),
       torii_port_(torii_port),
@@ -51,6 +55,9 @@ Irohad::Irohad(const std::string &block_store_dir,
       proposal_delay_(proposal_delay),
       vote_delay_(vote_delay),
       load_delay_(load_delay),
+      pipelined_consensus_(pipelined_consensus),
+      commit_gossip_fanout_(commit_gossip_fanout),
+      validation_workers_(std::max(1u, std::thread::hardware_concurrency())),
       keypair(keypair) {
   log_ = logger::log("IROHAD");
   log_->info("created");
@@ -59,6 +66,12 @@ Irohad::Irohad(const std::string &block_store_dir,
   initStorage();
 }
 
+Irohad::~Irohad() {
+  if (internal_server) {
+    internal_server->Shutdown();
+  }
+}
+
 /**
  * Initializing iroha daemon
  */
@@ -89,7 +102,12 @@ void Irohad::dropStorage() {
  * Initializing iroha daemon storage
  */
 void Irohad::initStorage() {
-  auto storageResult = StorageImpl::create(block_store_dir_, pg_conn_);
+  // each validation worker holds its own temporary wsv, one more connection
+  // is left for mutable storage
+  auto storageResult = StorageImpl::create(
+      block_store_dir_,
+      pg_conn_,
+      std::max(PostgresConnectionPool::kDefaultSize, validation_workers_ + 1));
   storageResult.match(
       [&](expected::Value<std::shared_ptr<ametsuchi::StorageImpl>> &_storage) {
         storage = _storage.value;
@@ -136,10 +154,12 @@ void Irohad::initCryptoProvider() {
  * Initializing validators
  */
 void Irohad::initValidators() {
-  stateful_validator = std::make_shared<StatefulValidatorImpl>();
+  stateful_validator =
+      std::make_shared<StatefulValidatorImpl>(validation_workers_);
   chain_validator = std::make_shared<ChainValidatorImpl>();
 
-  log_->info("[Init] => validators");
+  log_->info("[Init] => validators, stateful validation workers - [{}]",
+             validation_workers_);
 }
 
 /**
@@ -160,9 +180,11 @@ void Irohad::initSimulator() {
                                           stateful_validator,
                                           storage,
                                           storage->getBlockQuery(),
-                                          crypto_verifier);
+                                          crypto_verifier,
+                                          pipelined_consensus_);
 
-  log_->info("[Init] => init simulator");
+  log_->info("[Init] => init simulator, pipelined - [{}]",
+             logger::logBool(pipelined_consensus_));
 }
 
 /**
@@ -179,10 +201,16 @@ void Irohad::initBlockLoader() {
  * Initializing consensus gate
  */
 void Irohad::initConsensusGate() {
-  consensus_gate = yac_init.initConsensusGate(
-      wsv, simulator, block_loader, keypair, vote_delay_, load_delay_);
-
-  log_->info("[Init] => consensus gate");
+  consensus_gate = yac_init.initConsensusGate(wsv,
+                                              simulator,
+                                              block_loader,
+                                              keypair,
+                                              vote_delay_,
+                                              load_delay_,
+                                              commit_gossip_fanout_);
+
+  log_->info("[Init] => consensus gate, commit gossip fanout - [{}]",
+             commit_gossip_fanout_);
 }
 
 /**
@@ -255,9 +283,10 @@ void Irohad::run() {
   builder.RegisterService(ordering_init.ordering_gate_transport.get());
   builder.RegisterService(ordering_init.ordering_service_transport.get());
   builder.RegisterService(yac_init.consensus_network.get());
-  builder.RegisterService(loader_init.service.get());
+  loader_init.service->registerIn(builder);
   // Run internal server
   internal_server = builder.BuildAndStart();
+  loader_init.service->start();
   // Run torii server
   torii_server->append(std::move(command_service))
       .append(std::move(query_service))
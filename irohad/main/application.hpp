@@ -64,6 +64,11 @@ class Irohad {
    * @param load_delay - waiting time before loading committed block from next
    * peer
    * @param keypair - public and private keys for crypto provider
+   * @param pipelined_consensus - whether to validate next proposal while
+   * previous block is being committed
+   * @param commit_gossip_fanout - number of peers, to which consensus commit
+   * is gossiped by each peer; 0 means that commit is broadcasted by the peer
+   * which collected it
    */
   Irohad(const std::string &block_store_dir,
          const std::string &pg_conn,
@@ -73,7 +78,9 @@ class Irohad {
          std::chrono::milliseconds proposal_delay,
          std::chrono::milliseconds vote_delay,
          std::chrono::milliseconds load_delay,
-         const iroha::keypair_t &keypair);
+         const iroha::keypair_t &keypair,
+         bool pipelined_consensus = false,
+         size_t commit_gossip_fanout = 0);
 
   /**
    * Initialization of whole objects in system
@@ -95,7 +102,10 @@ class Irohad {
    */
   virtual void run();
 
-  virtual ~Irohad() = default;
+  /**
+   * Shuts internal server down before services, which handle its calls
+   */
+  virtual ~Irohad();
 
  protected:
   // -----------------------| component initialization |------------------------
@@ -133,6 +143,11 @@ class Irohad {
   std::chrono::milliseconds proposal_delay_;
   std::chrono::milliseconds vote_delay_;
   std::chrono::milliseconds load_delay_;
+  bool pipelined_consensus_;
+  size_t commit_gossip_fanout_;
+
+  // threads validating independent transactions of proposal
+  size_t validation_workers_;
 
   // ------------------------| internal dependencies |-------------------------
 
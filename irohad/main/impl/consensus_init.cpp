@@ -16,6 +16,7 @@
  */
 
 #include "main/impl/consensus_init.hpp"
+#include "consensus/yac/impl/executor_impl.hpp"
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 #include "consensus/yac/impl/timer_impl.hpp"
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
@@ -44,8 +45,10 @@ namespace iroha {
         return crypto;
       }
 
-      auto YacInit::createTimer() {
-        return std::make_shared<TimerImpl>();
+      auto YacInit::createTimerFactory() {
+        return []() -> std::shared_ptr<Timer> {
+          return std::make_shared<TimerImpl>();
+        };
       }
 
       auto YacInit::createHashProvider() {
@@ -55,13 +58,22 @@ namespace iroha {
       std::shared_ptr<consensus::yac::Yac> YacInit::createYac(
           ClusterOrdering initial_order,
           const keypair_t &keypair,
-          std::chrono::milliseconds delay_milliseconds) {
+          std::chrono::milliseconds delay_milliseconds,
+          size_t commit_gossip_fanout) {
+        std::shared_ptr<PropagationStrategy> propagation =
+            std::make_shared<BroadcastPropagation>();
+        if (commit_gossip_fanout > 0) {
+          propagation = std::make_shared<GossipPropagation>(
+              keypair.pubkey, commit_gossip_fanout);
+        }
         return Yac::create(YacVoteStorage(),
                            createNetwork(),
                            createCryptoProvider(keypair),
-                           createTimer(),
+                           createTimerFactory(),
                            initial_order,
-                           delay_milliseconds.count());
+                           delay_milliseconds.count(),
+                           std::make_unique<ExecutorImpl>(),
+                           propagation);
       }
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
@@ -70,12 +82,14 @@ namespace iroha {
           std::shared_ptr<network::BlockLoader> block_loader,
           const keypair_t &keypair,
           std::chrono::milliseconds vote_delay_milliseconds,
-          std::chrono::milliseconds load_delay_milliseconds) {
+          std::chrono::milliseconds load_delay_milliseconds,
+          size_t commit_gossip_fanout) {
         auto peer_orderer = createPeerOrderer(wsv);
 
         auto yac = createYac(peer_orderer->getInitialOrdering().value(),
                              keypair,
-                             vote_delay_milliseconds);
+                             vote_delay_milliseconds,
+                             commit_gossip_fanout);
         consensus_network->subscribe(yac);
 
         auto hash_provider = createHashProvider();
@@ -47,14 +47,15 @@ namespace iroha {
 
         auto createCryptoProvider(const keypair_t &keypair);
 
-        auto createTimer();
+        auto createTimerFactory();
 
         auto createHashProvider();
 
         std::shared_ptr<consensus::yac::Yac> createYac(
             ClusterOrdering initial_order,
             const keypair_t &keypair,
-            std::chrono::milliseconds delay_milliseconds);
+            std::chrono::milliseconds delay_milliseconds,
+            size_t commit_gossip_fanout);
 
        public:
         std::shared_ptr<YacGate> initConsensusGate(
@@ -63,7 +64,8 @@ namespace iroha {
             std::shared_ptr<network::BlockLoader> block_loader,
             const keypair_t &keypair,
             std::chrono::milliseconds vote_delay_milliseconds,
-            std::chrono::milliseconds load_delay_milliseconds);
+            std::chrono::milliseconds load_delay_milliseconds,
+            size_t commit_gossip_fanout = 0);
 
         std::shared_ptr<NetworkImpl> consensus_network;
       };
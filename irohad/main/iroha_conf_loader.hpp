@@ -34,6 +34,8 @@ namespace config_members {
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
   const char *LoadDelay = "load_delay";
+  const char *PipelinedConsensus = "pipelined_consensus";
+  const char *CommitGossipFanout = "commit_gossip_fanout";
 }  // namespace config_members
 
 /**
@@ -49,6 +51,7 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
   rapidjson::IStreamWrapper isw(ifs_iroha);
   const std::string kStrType = "string";
   const std::string kUintType = "uint";
+  const std::string kBoolType = "bool";
   doc.ParseStream(isw);
   ac::assert_fatal(not doc.HasParseError(), "JSON parse error: " + conf_path);
 
@@ -90,6 +93,16 @@ inline rapidjson::Document parse_iroha_config(const std::string &conf_path) {
                    ac::no_member_error(mbr::LoadDelay));
   ac::assert_fatal(doc[mbr::LoadDelay].IsUint(),
                    ac::type_error(mbr::LoadDelay, kUintType));
+
+  // optional, pipelined consensus is disabled by default
+  ac::assert_fatal(not doc.HasMember(mbr::PipelinedConsensus)
+                       or doc[mbr::PipelinedConsensus].IsBool(),
+                   ac::type_error(mbr::PipelinedConsensus, kBoolType));
+
+  // optional, commits are broadcasted without gossip by default
+  ac::assert_fatal(not doc.HasMember(mbr::CommitGossipFanout)
+                       or doc[mbr::CommitGossipFanout].IsUint(),
+                   ac::type_error(mbr::CommitGossipFanout, kUintType));
   return doc;
 }
 
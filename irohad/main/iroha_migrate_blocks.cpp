@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gflags/gflags.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "common/types.hpp"
+#include "logger/logger.hpp"
+#include "model/converters/json_block_factory.hpp"
+#include "model/converters/json_common.hpp"
+#include "model/converters/pb_block_factory.hpp"
+#include "model/converters/pb_common.hpp"
+
+/**
+ * Offline tool which converts block store written in the legacy format, where
+ * every block is a JSON document in its own file, into the segmented
+ * binary protobuf format used by irohad.
+ * Source block store is left untouched, so the node directory can be switched
+ * to the destination one only after successful migration.
+ */
+
+/**
+ * Read block file of the legacy block store
+ * @param dir - folder of legacy block store
+ * @param id - height of block
+ * @return file content or nullopt if block does not exist
+ */
+nonstd::optional<std::string> read_legacy_block(
+    const std::string &dir, iroha::ametsuchi::FlatFile::Identifier id) {
+  boost::filesystem::ifstream file(
+      boost::filesystem::path{dir} / iroha::ametsuchi::FlatFile::id_to_name(id),
+      std::ifstream::binary);
+  if (not file.is_open()) {
+    return nonstd::nullopt;
+  }
+  return std::string((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+}
+
+/**
+ * Gflag validator.
+ * Validator for the block store paths input arguments.
+ * Path is considered to be valid if it is not empty.
+ * @param flag_name - flag name. Must be 'from' or 'to' in this case
+ * @param path      - path to the block store directory
+ * @return true if argument is valid
+ */
+bool validate_path(const char *flag_name, std::string const &path) {
+  return not path.empty();
+}
+
+/**
+ * Creating input argument for the legacy block store location.
+ */
+DEFINE_string(from, "", "Specify block store with blocks in JSON format");
+DEFINE_validator(from, &validate_path);
+
+/**
+ * Creating input argument for the migrated block store location.
+ */
+DEFINE_string(to, "", "Specify empty folder for blocks in protobuf format");
+DEFINE_validator(to, &validate_path);
+
+int main(int argc, char *argv[]) {
+  auto log = logger::log("MIGRATE");
+
+  gflags::ParseCommandLineFlags(&argc, &argv, true);
+  gflags::ShutDownCommandLineFlags();
+
+  auto destination = iroha::ametsuchi::FlatFile::create(FLAGS_to);
+  if (not destination) {
+    log->error("Failed to open block store {}", FLAGS_to);
+    return EXIT_FAILURE;
+  }
+  if ((*destination)->last_id() != 0) {
+    log->error("Destination block store {} is not empty", FLAGS_to);
+    return EXIT_FAILURE;
+  }
+
+  iroha::model::converters::JsonBlockFactory json_factory;
+  iroha::model::converters::PbBlockFactory pb_factory;
+
+  iroha::ametsuchi::FlatFile::Identifier last_id = 0;
+  while (auto file = read_legacy_block(FLAGS_from, last_id + 1)) {
+    const auto id = last_id + 1;
+    auto block = iroha::model::converters::stringToJson(*file) |
+        [&json_factory](const auto &document) {
+          return json_factory.deserialize(document);
+        };
+    if (not block) {
+      log->error("Cannot read JSON block {}", id);
+      return EXIT_FAILURE;
+    }
+
+    auto pb_block = pb_factory.serialize(*block);
+    // hash is recomputed from protobuf on read, so it must survive migration
+    if (iroha::hash(pb_block) != block->hash) {
+      log->error("Hash of block {} differs after conversion", id);
+      return EXIT_FAILURE;
+    }
+
+    if (not(*destination)
+                ->add(id, iroha::stringToBytes(pb_block.SerializeAsString()))) {
+      log->error("Cannot write block {}", id);
+      return EXIT_FAILURE;
+    }
+    last_id = id;
+  }
+
+  if (not(*destination)->sync()) {
+    log->error("Cannot flush block store {}", FLAGS_to);
+    return EXIT_FAILURE;
+  }
+  log->info("Migrated {} blocks to {}", last_id, FLAGS_to);
+  return EXIT_SUCCESS;
+}
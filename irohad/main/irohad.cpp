@@ -117,7 +117,12 @@ int main(int argc, char *argv[]) {
                 std::chrono::milliseconds(config[mbr::ProposalDelay].GetUint()),
                 std::chrono::milliseconds(config[mbr::VoteDelay].GetUint()),
                 std::chrono::milliseconds(config[mbr::LoadDelay].GetUint()),
-                keypair);
+                keypair,
+                config.HasMember(mbr::PipelinedConsensus)
+                    and config[mbr::PipelinedConsensus].GetBool(),
+                config.HasMember(mbr::CommitGossipFanout)
+                    ? config[mbr::CommitGossipFanout].GetUint()
+                    : 0);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
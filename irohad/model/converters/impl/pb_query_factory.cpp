@@ -92,6 +92,9 @@ namespace iroha {
               auto query = GetAccountAssetTransactions();
               query.account_id = pb_cast.account_id();
               query.asset_id = pb_cast.asset_id();
+              if (pb_cast.has_pager()) {
+                query.pager = deserializePager(pb_cast.pager());
+              }
               val = std::make_shared<model::GetAccountAssetTransactions>(query);
               break;
             }
@@ -108,6 +111,9 @@ namespace iroha {
               const auto &pb_cast = pl.get_account_transactions();
               auto query = GetAccountTransactions();
               query.account_id = pb_cast.account_id();
+              if (pb_cast.has_pager()) {
+                query.pager = deserializePager(pb_cast.pager());
+              }
               val = std::make_shared<model::GetAccountTransactions>(query);
               break;
             }
@@ -226,6 +232,9 @@ namespace iroha {
         auto pb_query_mut =
             pb_query.mutable_payload()->mutable_get_account_transactions();
         pb_query_mut->set_account_id(tmp->account_id);
+        if (tmp->pager.present) {
+          pb_query_mut->mutable_pager()->CopyFrom(serializePager(tmp->pager));
+        }
         return pb_query;
       }
 
@@ -241,6 +250,9 @@ namespace iroha {
                                 ->mutable_get_account_asset_transactions();
         pb_query_mut->set_account_id(account_id);
         pb_query_mut->set_asset_id(asset_id);
+        if (tmp->pager.present) {
+          pb_query_mut->mutable_pager()->CopyFrom(serializePager(tmp->pager));
+        }
         return pb_query;
       }
 
@@ -304,6 +316,25 @@ namespace iroha {
         return pb_query;
       }
 
+      model::Pager PbQueryFactory::deserializePager(
+          const protocol::Pager &pb_pager) const {
+        model::Pager pager;
+        pager.cursor.height = pb_pager.cursor().height();
+        pager.cursor.index = pb_pager.cursor().index();
+        pager.page_size = pb_pager.page_size();
+        pager.present = true;
+        return pager;
+      }
+
+      protocol::Pager PbQueryFactory::serializePager(
+          const model::Pager &pager) const {
+        protocol::Pager pb_pager;
+        pb_pager.mutable_cursor()->set_height(pager.cursor.height);
+        pb_pager.mutable_cursor()->set_index(pager.cursor.index);
+        pb_pager.set_page_size(pager.page_size);
+        return pb_pager;
+      }
+
     }  // namespace converters
   }    // namespace model
 }  // namespace iroha
@@ -313,16 +313,23 @@ namespace iroha {
         PbTransactionFactory pb_transaction_factory;
 
         // converting observable to the vector using reduce
-        return transactionsResponse.transactions
-            .reduce(protocol::TransactionsResponse(),
-                    [&pb_transaction_factory](auto &&response, auto tx) {
-                      response.add_transactions()->CopyFrom(
-                          pb_transaction_factory.serialize(tx));
-                      return response;
-                    },
-                    [](auto &&response) { return response; })
-            .as_blocking()  // we need to wait when on_complete happens
-            .first();
+        auto pb_response =
+            transactionsResponse.transactions
+                .reduce(protocol::TransactionsResponse(),
+                        [&pb_transaction_factory](auto &&response, auto tx) {
+                          response.add_transactions()->CopyFrom(
+                              pb_transaction_factory.serialize(tx));
+                          return response;
+                        },
+                        [](auto &&response) { return response; })
+                .as_blocking()  // we need to wait when on_complete happens
+                .first();
+        if (transactionsResponse.next_cursor) {
+          auto pb_cursor = pb_response.mutable_next_cursor();
+          pb_cursor->set_height(transactionsResponse.next_cursor->height);
+          pb_cursor->set_index(transactionsResponse.next_cursor->index);
+        }
+        return pb_response;
       }
 
       protocol::ErrorResponse PbQueryResponseFactory::serializeErrorResponse(
@@ -21,6 +21,7 @@
 #include <unordered_map>
 #include "logger/logger.hpp"
 #include "model/common.hpp"
+#include "model/queries/get_transactions.hpp"
 #include "model/query.hpp"
 #include "queries.pb.h"
 
@@ -49,6 +50,20 @@ namespace iroha {
         nonstd::optional<protocol::Query> serialize(
             std::shared_ptr<const model::Query> query) const;
 
+        /**
+         * Convert proto pager of account history to model pager
+         * @param pb_pager - reference to proto pager
+         * @return model Pager
+         */
+        model::Pager deserializePager(const protocol::Pager &pb_pager) const;
+
+        /**
+         * Convert model pager of account history to proto pager
+         * @param pager - model pager to serialize
+         * @return proto Pager
+         */
+        protocol::Pager serializePager(const model::Pager &pager) const;
+
         PbQueryFactory();
 
        private:
@@ -261,24 +261,45 @@ iroha::model::QueryProcessingFactory::executeGetAccountDetail(
   return std::make_shared<iroha::model::AccountDetailResponse>(response);
 }
 
+/**
+ * Collect a page of account history to response. Cursor of the next page is
+ * set only when the page is full, so there may be more transactions
+ * @param page - transactions of the page with their positions
+ * @param pager - requested page
+ * @return response with transactions of the page
+ */
+TransactionsResponse makeTransactionsPage(
+    rxcpp::observable<TransactionWithCursor> page, const Pager &pager) {
+  TransactionsResponse response;
+  std::vector<Transaction> transactions;
+  page.subscribe([&response, &transactions](const auto &tx) {
+    response.next_cursor = tx.first;
+    transactions.push_back(tx.second);
+  });
+  if (pager.page_size == 0 or transactions.size() < pager.page_size) {
+    response.next_cursor = nonstd::nullopt;
+  }
+  response.transactions = rxcpp::observable<>::iterate(transactions);
+  return response;
+}
+
 std::shared_ptr<iroha::model::QueryResponse>
 iroha::model::QueryProcessingFactory::executeGetAccountAssetTransactions(
     const model::GetAccountAssetTransactions &query) {
-  auto acc_asset_tx = _blockQuery->getAccountAssetTransactions(query.account_id,
-                                                               query.asset_id);
-  TransactionsResponse response;
+  auto acc_asset_tx = _blockQuery->getAccountAssetTransactions(
+      query.account_id, query.asset_id, query.pager);
+  auto response = makeTransactionsPage(acc_asset_tx, query.pager);
   response.query_hash = iroha::hash(query);
-  response.transactions = acc_asset_tx;
   return std::make_shared<TransactionsResponse>(response);
 }
 
 std::shared_ptr<QueryResponse>
 QueryProcessingFactory::executeGetAccountTransactions(
     const model::GetAccountTransactions &query) {
-  auto acc_tx = _blockQuery->getAccountTransactions(query.account_id);
-  TransactionsResponse response;
+  auto acc_tx =
+      _blockQuery->getAccountTransactions(query.account_id, query.pager);
+  auto response = makeTransactionsPage(acc_tx, query.pager);
   response.query_hash = iroha::hash(query);
-  response.transactions = acc_tx;
   return std::make_shared<TransactionsResponse>(response);
 }
 
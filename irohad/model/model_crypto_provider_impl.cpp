@@ -16,7 +16,7 @@
  */
 
 #include "model/model_crypto_provider_impl.hpp"
-#include <algorithm>
+#include "cryptography/ed25519_sha3_impl/batch_verifier.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "model/queries/get_account.hpp"
 #include "model/queries/get_account_assets.hpp"
@@ -28,17 +28,29 @@
 
 namespace iroha {
   namespace model {
+    namespace {
+      /**
+       * Verify all signatures of an object with given hash at once
+       * @param hash - hash of signed object, computed once for all signatures
+       * @param signatures - signatures of the object
+       * @return true if all signatures are valid
+       */
+      bool verifySignatures(const hash256_t &hash,
+                            const std::vector<Signature> &signatures) {
+        std::vector<shared_model::crypto::BatchVerifier::Item> items;
+        items.reserve(signatures.size());
+        for (const auto &sig : signatures) {
+          items.push_back({hash, sig.pubkey, sig.signature});
+        }
+        return shared_model::crypto::BatchVerifier::verifyAll(items);
+      }
+    }  // namespace
+
     ModelCryptoProviderImpl::ModelCryptoProviderImpl(const keypair_t &keypair)
         : keypair_(keypair) {}
 
     bool ModelCryptoProviderImpl::verify(const Transaction &tx) const {
-      return std::all_of(tx.signatures.begin(),
-                         tx.signatures.end(),
-                         [tx](const Signature &sig) {
-                           return iroha::verify(iroha::hash(tx).to_string(),
-                                                sig.pubkey,
-                                                sig.signature);
-                         });
+      return verifySignatures(iroha::hash(tx), tx.signatures);
     }
 
     bool ModelCryptoProviderImpl::verify(const Query &query) const {
@@ -48,11 +60,7 @@ namespace iroha {
     }
 
     bool ModelCryptoProviderImpl::verify(const Block &block) const {
-      return std::all_of(
-          block.sigs.begin(), block.sigs.end(), [block](const Signature &sig) {
-            return iroha::verify(
-                iroha::hash(block).to_string(), sig.pubkey, sig.signature);
-          });
+      return verifySignatures(iroha::hash(block), block.sigs);
     }
 
     void ModelCryptoProviderImpl::sign(Block &block) const {
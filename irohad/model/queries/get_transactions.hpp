@@ -24,6 +24,42 @@
 namespace iroha {
   namespace model {
 
+    /**
+     * Position of a transaction in the ledger
+     */
+    struct TxCursor {
+      /**
+       * Height of the block with the transaction
+       */
+      uint64_t height{};
+
+      /**
+       * Index of the transaction in the block
+       */
+      uint32_t index{};
+    };
+
+    /**
+     * Page of account history, which starts right after the cursor
+     */
+    struct Pager {
+      /**
+       * Position of the last transaction of the previous page
+       */
+      TxCursor cursor{};
+
+      /**
+       * Maximum number of transactions in the page, 0 for no limit
+       */
+      uint32_t page_size{};
+
+      /**
+       * Whether the pager was sent by the client. Absent pager is not
+       * serialized, so hash of the query matches the one of the client
+       */
+      bool present{};
+    };
+
     /**
      * Query for getting transactions of given asset of an account
      */
@@ -37,6 +73,11 @@ namespace iroha {
        * Asset identifier
        */
       std::string asset_id{};
+
+      /**
+       * Requested page of transactions
+       */
+      Pager pager{};
     };
 
     /**
@@ -47,6 +88,11 @@ namespace iroha {
        * Account identifier
        */
       std::string account_id{};
+
+      /**
+       * Requested page of transactions
+       */
+      Pager pager{};
     };
 
     /**
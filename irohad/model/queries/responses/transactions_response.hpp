@@ -18,7 +18,9 @@
 #ifndef IROHA_TRANSACTIONS_RESPONSE_HPP
 #define IROHA_TRANSACTIONS_RESPONSE_HPP
 
+#include <nonstd/optional.hpp>
 #include <rxcpp/rx-observable.hpp>
+#include "model/queries/get_transactions.hpp"
 #include "model/transaction.hpp"
 
 namespace iroha {
@@ -32,6 +34,11 @@ namespace iroha {
        * Observable contains transactions
        */
       rxcpp::observable<Transaction> transactions{};
+
+      /**
+       * Position of the last transaction, if there are more pages
+       */
+      nonstd::optional<TxCursor> next_cursor{};
     };
   }  // namespace model
 }  // namespace iroha
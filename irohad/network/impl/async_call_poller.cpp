@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/impl/async_call_poller.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace network {
+
+    std::shared_ptr<AsyncCallPoller> AsyncCallPoller::shared() {
+      static auto instance = std::make_shared<AsyncCallPoller>();
+      return instance;
+    }
+
+    AsyncCallPoller::AsyncCallPoller()
+        : log_(logger::log("AsyncCallPoller")),
+          thread_(&AsyncCallPoller::run, this) {}
+
+    grpc::CompletionQueue &AsyncCallPoller::queue() {
+      return cq_;
+    }
+
+    std::unordered_map<std::string, AsyncCallPoller::PeerMetrics>
+    AsyncCallPoller::metrics() const {
+      std::lock_guard<std::mutex> lock(metrics_mutex_);
+      return metrics_;
+    }
+
+    void AsyncCallPoller::run() {
+      void *got_tag;
+      auto ok = false;
+      while (cq_.Next(&got_tag, &ok)) {
+        std::unique_ptr<Call> call(static_cast<Call *>(got_tag));
+        auto latency = Clock::now() - call->started;
+        auto failed = not ok or not call->status.ok();
+        if (failed) {
+          log_->warn("Call to {} failed: {}",
+                     call->peer,
+                     call->status.error_message());
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(metrics_mutex_);
+          auto &peer = metrics_[call->peer];
+          ++peer.sent;
+          peer.failed += failed;
+          peer.total_latency += latency;
+          peer.max_latency = std::max<std::chrono::nanoseconds>(
+              peer.max_latency, latency);
+        }
+        if (call->on_finish) {
+          call->on_finish(ok ? call->status
+                             : grpc::Status(grpc::StatusCode::CANCELLED,
+                                            "Call is not finished"));
+        }
+      }
+    }
+
+    AsyncCallPoller::~AsyncCallPoller() {
+      cq_.Shutdown();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+  }  // namespace network
+}  // namespace iroha
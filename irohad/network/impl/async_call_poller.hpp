@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_ASYNC_CALL_POLLER_HPP
+#define IROHA_ASYNC_CALL_POLLER_HPP
+
+#include <grpc++/grpc++.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Completion queue of asynchronous gRPC calls, shared by clients of the
+     * peer. Its thread frees finished calls and records latency and failures
+     * of calls per peer
+     */
+    class AsyncCallPoller {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /**
+       * State of asynchronous call, deleted by poller when call is finished
+       */
+      struct Call {
+        virtual ~Call() = default;
+
+        /// address of called peer
+        std::string peer;
+        Clock::time_point started = Clock::now();
+
+        grpc::ClientContext context;
+        grpc::Status status;
+
+        /// invoked by poller thread with status of finished call, if set
+        std::function<void(const grpc::Status &)> on_finish;
+      };
+
+      /**
+       * Statistics of finished calls to a peer
+       */
+      struct PeerMetrics {
+        size_t sent = 0;
+        size_t failed = 0;
+        std::chrono::nanoseconds total_latency{0};
+        std::chrono::nanoseconds max_latency{0};
+      };
+
+      /**
+       * @return poller shared by transports of the peer
+       */
+      static std::shared_ptr<AsyncCallPoller> shared();
+
+      AsyncCallPoller();
+
+      /**
+       * @return queue, which calls are started on. Finish of the call must be
+       * tagged with pointer to Call
+       */
+      grpc::CompletionQueue &queue();
+
+      /**
+       * @return statistics of finished calls by peer address
+       */
+      std::unordered_map<std::string, PeerMetrics> metrics() const;
+
+      ~AsyncCallPoller();
+
+     private:
+      /**
+       * Listen to finished calls until queue is shut down
+       */
+      void run();
+
+      grpc::CompletionQueue cq_;
+
+      mutable std::mutex metrics_mutex_;
+      std::unordered_map<std::string, PeerMetrics> metrics_;
+
+      logger::Logger log_;
+      std::thread thread_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_CALL_POLLER_HPP
@@ -20,56 +20,64 @@
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
-#include <thread>
+
+#include "network/impl/async_call_poller.hpp"
+#include "network/impl/grpc_channel_cache.hpp"
 
 namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client which does no processing of server responses,
+     * except for optional status callback. Calls are made on cached channels
+     * and finished by the shared poller
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      AsyncGrpcClient() : thread_(&AsyncGrpcClient::asyncCompleteRpc, this) {}
+      explicit AsyncGrpcClient(
+          std::shared_ptr<GrpcChannelCache> channels =
+              GrpcChannelCache::shared(),
+          std::shared_ptr<AsyncCallPoller> poller = AsyncCallPoller::shared())
+          : channels_(std::move(channels)), poller_(std::move(poller)) {}
 
       /**
-       * Listen to gRPC server responses
+       * State and data information of gRPC call
        */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-
-          delete call;
-        }
-      }
-
-      ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
-        }
-      }
+      struct AsyncClientCall : public AsyncCallPoller::Call {
+        Response reply;
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>
+            response_reader;
+      };
 
       /**
-       * State and data information of gRPC call
+       * Start asynchronous call, which is freed by poller on finish
+       * @param peer - address of called peer
+       * @param rpc - starts the call with given context and completion queue,
+       * and returns response reader of the call
+       * @param on_finish - invoked by poller thread with status of the call
        */
-      struct AsyncClientCall {
-        Response reply;
+      template <typename Rpc>
+      void asyncCall(
+          const std::string &peer,
+          Rpc &&rpc,
+          std::function<void(const grpc::Status &)> on_finish = nullptr) {
+        auto call = new AsyncClientCall;
+        call->peer = peer;
+        call->on_finish = std::move(on_finish);
 
-        grpc::ClientContext context;
+        call->response_reader = rpc(&call->context, &poller_->queue());
 
-        grpc::Status status;
+        call->response_reader->Finish(
+            &call->reply,
+            &call->status,
+            static_cast<AsyncCallPoller::Call *>(call));
+      }
 
-        std::unique_ptr<grpc::ClientAsyncResponseReader<Response>>
-            response_reader;
-      };
+      std::shared_ptr<GrpcChannelCache> channels_;
+      std::shared_ptr<AsyncCallPoller> poller_;
     };
   }  // namespace network
 }  // namespace iroha
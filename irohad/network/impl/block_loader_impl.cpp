@@ -15,7 +15,6 @@
  * limitations under the License.
  */
 
-#include <grpc++/create_channel.h>
 #include <algorithm>
 
 #include "backend/protobuf/block.hpp"
@@ -33,8 +32,10 @@ using namespace shared_model::interface;
 BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQuery> peer_query,
     std::shared_ptr<BlockQuery> block_query,
-    std::shared_ptr<model::ModelCryptoProvider> crypto_provider)
-    : peer_query_(std::move(peer_query)),
+    std::shared_ptr<model::ModelCryptoProvider> crypto_provider,
+    std::shared_ptr<GrpcChannelCache> channels)
+    : channels_(std::move(channels)),
+      peer_query_(std::move(peer_query)),
       block_query_(std::move(block_query)),
       crypto_provider_(crypto_provider) {
   log_ = logger::log("BlockLoaderImpl");
@@ -75,8 +76,8 @@ rxcpp::observable<Wrapper<Block>> BlockLoaderImpl::retrieveBlocks(
     // request next block to our top
     request.set_height(top_block->height + 1);
 
-    auto reader =
-        this->getPeerStub(peer.value()).retrieveBlocks(&context, request);
+    auto stub = this->getPeerStub(peer.value());
+    auto reader = stub->retrieveBlocks(&context, request);
     while (reader->Read(&block)) {
       auto result = makeWrapper<Block, shared_model::proto::Block>(block);
       std::unique_ptr<iroha::model::Block> old_block(result->makeOldModel());
@@ -108,7 +109,7 @@ nonstd::optional<Wrapper<Block>> BlockLoaderImpl::retrieveBlock(
   request.set_hash(toBinaryString(block_hash));
 
   auto status =
-      getPeerStub(peer.value()).retrieveBlock(&context, request, &block);
+      getPeerStub(peer.value())->retrieveBlock(&context, request, &block);
   if (not status.ok()) {
     log_->error(status.error_message());
     return nonstd::nullopt;
@@ -144,16 +145,7 @@ nonstd::optional<iroha::model::Peer> BlockLoaderImpl::findPeer(
   return *std::unique_ptr<iroha::model::Peer>((*it)->makeOldModel());
 }
 
-proto::Loader::Stub &BlockLoaderImpl::getPeerStub(
+std::unique_ptr<proto::Loader::Stub> BlockLoaderImpl::getPeerStub(
     const iroha::model::Peer &peer) {
-  auto it = peer_connections_.find(peer);
-  if (it == peer_connections_.end()) {
-    it = peer_connections_
-             .insert(std::make_pair(
-                 peer,
-                 proto::Loader::NewStub(grpc::CreateChannel(
-                     peer.address, grpc::InsecureChannelCredentials()))))
-             .first;
-  }
-  return *it->second;
+  return channels_->stub<proto::Loader>(peer.address);
 }
@@ -20,13 +20,12 @@
 
 #include "network/block_loader.hpp"
 
-#include <unordered_map>
-
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/peer_query.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger.hpp"
 #include "model/model_crypto_provider.hpp"
+#include "network/impl/grpc_channel_cache.hpp"
 
 namespace iroha {
   namespace network {
@@ -35,7 +34,9 @@ namespace iroha {
       BlockLoaderImpl(
           std::shared_ptr<ametsuchi::PeerQuery> peer_query,
           std::shared_ptr<ametsuchi::BlockQuery> block_query,
-          std::shared_ptr<model::ModelCryptoProvider> crypto_provider);
+          std::shared_ptr<model::ModelCryptoProvider> crypto_provider,
+          std::shared_ptr<GrpcChannelCache> channels =
+              GrpcChannelCache::shared());
 
       rxcpp::observable<Wrapper<shared_model::interface::Block>> retrieveBlocks(
           const shared_model::crypto::PublicKey &peer_pubkey) override;
@@ -54,14 +55,14 @@ namespace iroha {
       nonstd::optional<model::Peer> findPeer(
           const shared_model::crypto::PublicKey &pubkey);
       /**
-       * Get or create a RPC stub for connecting to peer
+       * Create a RPC stub on cached channel to peer
        * @param peer for connecting
        * @return RPC stub
        */
-      proto::Loader::Stub &getPeerStub(const model::Peer &peer);
+      std::unique_ptr<proto::Loader::Stub> getPeerStub(
+          const model::Peer &peer);
 
-      std::unordered_map<model::Peer, std::unique_ptr<proto::Loader::Stub>>
-          peer_connections_;
+      std::shared_ptr<GrpcChannelCache> channels_;
       std::shared_ptr<ametsuchi::PeerQuery> peer_query_;
       std::shared_ptr<ametsuchi::BlockQuery> block_query_;
       std::shared_ptr<model::ModelCryptoProvider> crypto_provider_;
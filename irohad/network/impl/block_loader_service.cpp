@@ -18,27 +18,166 @@
 #include "network/impl/block_loader_service.hpp"
 
 #include "common/byteutils.hpp"
+#include "model/block.hpp"
 
 using namespace iroha;
 using namespace iroha::ametsuchi;
 using namespace iroha::model;
-using namespace iroha::model::converters;
 using namespace iroha::network;
 
+const char *BlockLoaderService::kRetrieveBlocksMethod =
+    "/iroha.network.proto.Loader/retrieveBlocks";
+
+namespace {
+  /**
+   * Wrap block bytes into buffer without copying, keeping block memory
+   * until the buffer is sent
+   */
+  grpc::ByteBuffer toByteBuffer(RawBlock block) {
+    auto holder = new std::shared_ptr<const void>(std::move(block.holder));
+    grpc::Slice slice(
+        grpc_slice_new_with_user_data(
+            const_cast<uint8_t *>(block.data),
+            block.size,
+            [](void *holder) {
+              delete static_cast<std::shared_ptr<const void> *>(holder);
+            },
+            holder),
+        grpc::Slice::STEAL_REF);
+    return grpc::ByteBuffer(&slice, 1);
+  }
+
+  bool parseMessage(const grpc::ByteBuffer &buffer,
+                    google::protobuf::Message &message) {
+    std::vector<grpc::Slice> slices;
+    if (not buffer.Dump(&slices).ok()) {
+      return false;
+    }
+    std::string bytes;
+    for (const auto &slice : slices) {
+      bytes.append(reinterpret_cast<const char *>(slice.begin()),
+                   slice.size());
+    }
+    return message.ParseFromString(bytes);
+  }
+}  // namespace
+
+/**
+ * Single call of generic handler. Blocks are written one by one, each after
+ * the previous one is sent
+ */
+class BlockLoaderService::BlocksCall {
+ public:
+  explicit BlocksCall(BlockLoaderService &service)
+      : service_(service), stream_(&context_) {
+    service_.generic_service_.RequestCall(
+        &context_, &stream_, service_.cq_.get(), service_.cq_.get(), this);
+  }
+
+  /**
+   * Continue the call after its last operation is completed
+   * @param ok - whether the operation succeeded
+   * @return false if the call is over
+   */
+  bool proceed(bool ok) {
+    // operations fail when the call is cancelled or server is shut down
+    if (not ok) {
+      return false;
+    }
+    switch (state_) {
+      case State::kRequested:
+        // accept the next call
+        new BlocksCall(service_);
+        if (context_.method() != kRetrieveBlocksMethod) {
+          return finish(grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                                     "Method is not served"));
+        }
+        state_ = State::kReading;
+        stream_.Read(&buffer_, this);
+        return true;
+      case State::kReading: {
+        proto::BlocksRequest request;
+        if (not parseMessage(buffer_, request)) {
+          return finish(grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                     "Bad request"));
+        }
+        height_ = request.height();
+        state_ = State::kWriting;
+        return write();
+      }
+      case State::kWriting:
+        ++height_;
+        return write();
+      case State::kFinishing:
+        return false;
+    }
+    return false;
+  }
+
+ private:
+  enum class State { kRequested, kReading, kWriting, kFinishing };
+
+  bool write() {
+    auto block = service_.storage_->getRawBlock(height_);
+    if (not block) {
+      return finish(grpc::Status::OK);
+    }
+    stream_.Write(toByteBuffer(std::move(*block)), this);
+    return true;
+  }
+
+  bool finish(const grpc::Status &status) {
+    state_ = State::kFinishing;
+    stream_.Finish(status, this);
+    return true;
+  }
+
+  BlockLoaderService &service_;
+  grpc::GenericServerContext context_;
+  grpc::GenericServerAsyncReaderWriter stream_;
+  grpc::ByteBuffer buffer_;
+  State state_ = State::kRequested;
+  uint64_t height_ = 0;
+};
+
 BlockLoaderService::BlockLoaderService(std::shared_ptr<BlockQuery> storage)
     : storage_(std::move(storage)) {
   log_ = logger::log("BlockLoaderService");
 }
 
-grpc::Status BlockLoaderService::retrieveBlocks(
-    ::grpc::ServerContext *context,
-    const proto::BlocksRequest *request,
-    ::grpc::ServerWriter<::iroha::protocol::Block> *writer) {
-  storage_->getBlocksFrom(request->height())
-      .map([this](auto block) { return factory_.serialize(block); })
-      .as_blocking()
-      .subscribe([writer](auto block) { writer->Write(block); });
-  return grpc::Status::OK;
+BlockLoaderService::~BlockLoaderService() {
+  if (not cq_) {
+    return;
+  }
+  cq_->Shutdown();
+  if (thread_.joinable()) {
+    thread_.join();
+  } else {
+    // queue is drained before destruction even if calls were not handled
+    handleCalls();
+  }
+}
+
+void BlockLoaderService::registerIn(grpc::ServerBuilder &builder) {
+  builder.RegisterService(this);
+  builder.RegisterAsyncGenericService(&generic_service_);
+  cq_ = builder.AddCompletionQueue();
+}
+
+void BlockLoaderService::start() {
+  new BlocksCall(*this);
+  thread_ = std::thread(&BlockLoaderService::handleCalls, this);
+}
+
+void BlockLoaderService::handleCalls() {
+  void *tag;
+  bool ok;
+  while (cq_->Next(&tag, &ok)) {
+    auto call = static_cast<BlocksCall *>(tag);
+    if (not call->proceed(ok)) {
+      delete call;
+    }
+  }
 }
 
 grpc::Status BlockLoaderService::retrieveBlock(
@@ -53,16 +192,11 @@ grpc::Status BlockLoaderService::retrieveBlock(
                         "Bad hash provided");
   }
 
-  nonstd::optional<protocol::Block> result;
-  storage_->getBlocksFrom(1)
-      .filter([hash](auto block) { return block.hash == hash.value(); })
-      .map([this](auto block) { return factory_.serialize(block); })
-      .as_blocking()
-      .subscribe([&result](auto block) { result = block; });
-  if (not result.has_value()) {
+  auto result = storage_->getProtoBlockByHashSync(hash.value());
+  if (not result) {
     log_->info("Cannot find block with requested hash");
     return grpc::Status(grpc::StatusCode::NOT_FOUND, "Block not found");
   }
-  response->CopyFrom(result.value());
+  response->Swap(&result.value());
   return grpc::Status::OK;
 }
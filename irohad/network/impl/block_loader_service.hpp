@@ -18,30 +18,64 @@
 #ifndef IROHA_BLOCK_LOADER_SERVICE_HPP
 #define IROHA_BLOCK_LOADER_SERVICE_HPP
 
+#include <grpc++/generic/async_generic_service.h>
+#include <grpc++/server_builder.h>
+#include <thread>
+
 #include "ametsuchi/block_query.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger.hpp"
-#include "model/converters/pb_block_factory.hpp"
 
 namespace iroha {
   namespace network {
-    class BlockLoaderService : public proto::Loader::Service {
+    /**
+     * Serves blocks to other peers. Stored blocks are streamed by generic
+     * handler as they are kept in block store, without parsing and encoding
+     */
+    class BlockLoaderService
+        : public proto::Loader::WithGenericMethod_retrieveBlocks<
+              proto::Loader::Service> {
      public:
       explicit BlockLoaderService(
           std::shared_ptr<ametsuchi::BlockQuery> storage);
 
-      grpc::Status retrieveBlocks(
-          ::grpc::ServerContext *context,
-          const proto::BlocksRequest *request,
-          ::grpc::ServerWriter<protocol::Block> *writer) override;
+      /**
+       * Stops handling of streamed blocks. Server must be shut down before
+       */
+      ~BlockLoaderService() override;
+
+      /**
+       * Register service with its generic handler in server builder
+       * @param builder - builder of server to serve blocks
+       */
+      void registerIn(grpc::ServerBuilder &builder);
+
+      /**
+       * Start handling streamed blocks requests, after server is started
+       */
+      void start();
 
       grpc::Status retrieveBlock(::grpc::ServerContext *context,
                                  const proto::BlockRequest *request,
                                  protocol::Block *response) override;
 
+      /**
+       * Full name of method, which streams blocks
+       */
+      static const char *kRetrieveBlocksMethod;
+
      private:
-      model::converters::PbBlockFactory factory_;
+      class BlocksCall;
+
+      /**
+       * Handle events of streamed blocks calls until queue is shut down
+       */
+      void handleCalls();
+
       std::shared_ptr<ametsuchi::BlockQuery> storage_;
+      grpc::AsyncGenericService generic_service_;
+      std::unique_ptr<grpc::ServerCompletionQueue> cq_;
+      std::thread thread_;
       logger::Logger log_;
     };
   }  // namespace network
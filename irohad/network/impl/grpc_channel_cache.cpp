@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "network/impl/grpc_channel_cache.hpp"
+
+#include <unordered_set>
+
+namespace iroha {
+  namespace network {
+
+    std::shared_ptr<GrpcChannelCache> GrpcChannelCache::shared() {
+      static auto instance = std::make_shared<GrpcChannelCache>();
+      return instance;
+    }
+
+    std::shared_ptr<grpc::Channel> GrpcChannelCache::channel(
+        const std::string &address) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &channel = channels_[address];
+      if (not channel) {
+        channel =
+            grpc::CreateChannel(address, grpc::InsecureChannelCredentials());
+      }
+      return channel;
+    }
+
+    void GrpcChannelCache::retain(const std::vector<std::string> &addresses) {
+      std::unordered_set<std::string> current(addresses.begin(),
+                                              addresses.end());
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = channels_.begin(); it != channels_.end();) {
+        if (current.count(it->first) == 0) {
+          it = channels_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    size_t GrpcChannelCache::size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return channels_.size();
+    }
+
+  }  // namespace network
+}  // namespace iroha
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_GRPC_CHANNEL_CACHE_HPP
+#define IROHA_GRPC_CHANNEL_CACHE_HPP
+
+#include <grpc++/grpc++.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Cache of gRPC channels to peers, keyed by peer address.
+     * Creation of a channel resolves the address and establishes connection,
+     * so channels are reused by all clients of the peer, and dropped when
+     * the peer leaves the ledger
+     */
+    class GrpcChannelCache {
+     public:
+      /**
+       * @return cache shared by transports of the peer
+       */
+      static std::shared_ptr<GrpcChannelCache> shared();
+
+      /**
+       * @param address - address of peer
+       * @return channel to the peer, created on first request
+       */
+      std::shared_ptr<grpc::Channel> channel(const std::string &address);
+
+      /**
+       * Stub of the service on the cached channel
+       * @tparam Service - generated gRPC service
+       * @param address - address of peer
+       */
+      template <typename Service>
+      std::unique_ptr<typename Service::Stub> stub(const std::string &address) {
+        return Service::NewStub(channel(address));
+      }
+
+      /**
+       * Drop channels to peers, which are not in the list
+       * @param addresses - addresses of current peers
+       */
+      void retain(const std::vector<std::string> &addresses);
+
+      /**
+       * @return number of cached channels
+       */
+      size_t size() const;
+
+     private:
+      mutable std::mutex mutex_;
+      std::unordered_map<std::string, std::shared_ptr<grpc::Channel>>
+          channels_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_GRPC_CHANNEL_CACHE_HPP
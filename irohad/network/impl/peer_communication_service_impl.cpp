@@ -32,7 +32,7 @@ namespace iroha {
       ordering_gate_->propagateTransaction(transaction);
     }
 
-    rxcpp::observable<model::Proposal>
+    rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
     PeerCommunicationServiceImpl::on_proposal() {
       return ordering_gate_->on_proposal();
     }
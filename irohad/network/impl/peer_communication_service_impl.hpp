@@ -35,7 +35,8 @@ namespace iroha {
       void propagate_transaction(
           std::shared_ptr<const model::Transaction> transaction) override;
 
-      rxcpp::observable<model::Proposal> on_proposal() override;
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+      on_proposal() override;
 
       rxcpp::observable<Commit> on_commit() override;
 
@@ -19,7 +19,7 @@
 #define IROHA_ORDERING_SERVICE_HPP
 
 #include <rxcpp/rx-observable.hpp>
-#include "model/proposal.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "model/transaction.hpp"
 
 namespace iroha {
@@ -41,7 +41,9 @@ namespace iroha {
        * Return observable of all proposals in the consensus
        * @return observable with notifications
        */
-      virtual rxcpp::observable<model::Proposal> on_proposal() = 0;
+      virtual rxcpp::observable<
+          std::shared_ptr<shared_model::interface::Proposal>>
+      on_proposal() = 0;
 
       virtual ~OrderingGate() = default;
     };
@@ -18,6 +18,7 @@
 #define IROHA_ORDERING_GATE_TRANSPORT_H
 
 #include <memory>
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "model/proposal.hpp"
 
 namespace iroha {
@@ -33,7 +34,8 @@ namespace iroha {
        * Callback on receiving proposal
        * @param proposal - proposal object itself
        */
-      virtual void onProposal(model::Proposal) = 0;
+      virtual void onProposal(
+          std::unique_ptr<shared_model::interface::Proposal> proposal) = 0;
 
       virtual ~OrderingGateNotification() = default;
     };
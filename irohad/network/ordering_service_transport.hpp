@@ -33,8 +33,9 @@ namespace iroha {
       /**
        * Callback on receiving transaction
        * @param transaction - transaction object itself
+       * @return false if transaction is rejected and will not be ordered
        */
-      virtual void onTransaction(
+      virtual bool onTransaction(
           std::shared_ptr<shared_model::interface::Transaction>
               transaction) = 0;
 
@@ -18,8 +18,8 @@
 #ifndef IROHA_PEER_COMMUNICATION_SERVICE_HPP
 #define IROHA_PEER_COMMUNICATION_SERVICE_HPP
 
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "model/block.hpp"
-#include "model/proposal.hpp"
 
 #include <rxcpp/rx.hpp>
 
@@ -45,7 +45,9 @@ namespace iroha {
        * @return observable with Proposals.
        * (List of Proposals)
        */
-      virtual rxcpp::observable<model::Proposal> on_proposal() = 0;
+      virtual rxcpp::observable<
+          std::shared_ptr<shared_model::interface::Proposal>>
+      on_proposal() = 0;
 
       /**
        * Event is triggered when commit block arrives.
@@ -33,13 +33,17 @@ namespace iroha {
       transport_->propagateTransaction(transaction);
     }
 
-    rxcpp::observable<model::Proposal> OrderingGateImpl::on_proposal() {
+    rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+    OrderingGateImpl::on_proposal() {
       return proposals_.get_observable();
     }
 
-    void OrderingGateImpl::onProposal(model::Proposal proposal) {
+    void OrderingGateImpl::onProposal(
+        std::unique_ptr<shared_model::interface::Proposal> proposal) {
       log_->info("Received new proposal");
-      proposals_.get_subscriber().on_next(proposal);
+      proposals_.get_subscriber().on_next(
+          std::shared_ptr<shared_model::interface::Proposal>(
+              std::move(proposal)));
     }
 
   }  // namespace ordering
@@ -43,12 +43,19 @@ namespace iroha {
       void propagateTransaction(
           std::shared_ptr<const model::Transaction> transaction) override;
 
-      rxcpp::observable<model::Proposal> on_proposal() override;
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+      on_proposal() override;
 
-      void onProposal(model::Proposal proposal) override;
+      /**
+       * Publish received proposal to subscribers, which share it
+       */
+      void onProposal(std::unique_ptr<shared_model::interface::Proposal>
+                          proposal) override;
 
      private:
-      rxcpp::subjects::subject<model::Proposal> proposals_;
+      rxcpp::subjects::subject<
+          std::shared_ptr<shared_model::interface::Proposal>>
+          proposals_;
       std::shared_ptr<iroha::network::OrderingGateTransport> transport_;
       logger::Logger log_;
     };
@@ -16,23 +16,26 @@
  */
 #include "ordering_gate_transport_grpc.hpp"
 
+#include <algorithm>
+
+#include "backend/protobuf/proposal.hpp"
+
 using namespace iroha::ordering;
 
+const size_t OrderingGateTransportGrpc::kDefaultMaxBatchSize;
+constexpr std::chrono::milliseconds
+    OrderingGateTransportGrpc::kDefaultBatchWindow;
+
 grpc::Status OrderingGateTransportGrpc::onProposal(
     ::grpc::ServerContext *context,
     const iroha::protocol::Proposal *request,
     ::google::protobuf::Empty *response) {
   log_->info("receive proposal");
 
-  auto transactions = decltype(std::declval<model::Proposal>().transactions)();
-  for (const auto &tx : request->transactions()) {
-    transactions.push_back(*factory_.deserialize(tx));
-  }
-  log_->info("transactions in proposal: {}", transactions.size());
+  auto proposal = std::make_unique<shared_model::proto::Proposal>(
+      iroha::protocol::Proposal(*request));
+  log_->info("transactions in proposal: {}", proposal->transactions().size());
 
-  model::Proposal proposal(transactions);
-  proposal.height = request->height();
-  proposal.created_time = request->created_time();
   if (not subscriber_.expired()) {
     subscriber_.lock()->onProposal(std::move(proposal));
   } else {
@@ -43,20 +46,60 @@ grpc::Status OrderingGateTransportGrpc::onProposal(
 }
 
 OrderingGateTransportGrpc::OrderingGateTransportGrpc(
-    const std::string &server_address)
-    : client_(proto::OrderingServiceTransportGrpc::NewStub(grpc::CreateChannel(
-          server_address, grpc::InsecureChannelCredentials()))),
+    const std::string &server_address,
+    size_t max_batch_size,
+    std::chrono::milliseconds batch_window,
+    std::shared_ptr<timer::TimerWheel> timer_wheel)
+    : server_address_(server_address),
+      client_(channels_->stub<proto::OrderingServiceTransportGrpc>(
+          server_address_)),
+      max_batch_size_(std::max<size_t>(max_batch_size, 1)),
+      batch_window_(batch_window),
+      timer_wheel_(std::move(timer_wheel)),
       log_(logger::log("OrderingGate")) {}
 
 void OrderingGateTransportGrpc::propagateTransaction(
     std::shared_ptr<const model::Transaction> transaction) {
   log_->info("Propagate tx (on transport)");
-  auto call = new AsyncClientCall;
+  auto tx = factory_.serialize(*transaction);
+
+  std::unique_lock<std::mutex> lock(batch_mutex_);
+  batch_.add_transactions()->Swap(&tx);
+  if (static_cast<size_t>(batch_.transactions_size()) >= max_batch_size_) {
+    sendBatch(std::move(lock));
+  } else if (batch_.transactions_size() == 1) {
+    std::weak_ptr<OrderingGateTransportGrpc> self = shared_from_this();
+    batch_timer_ = timer_wheel_->schedule(batch_window_, [self] {
+      if (auto transport = self.lock()) {
+        transport->flush();
+      }
+    });
+  }
+}
 
-  call->response_reader = client_->AsynconTransaction(
-      &call->context, factory_.serialize(*transaction), &cq_);
+void OrderingGateTransportGrpc::flush() {
+  sendBatch(std::unique_lock<std::mutex>(batch_mutex_));
+}
+
+void OrderingGateTransportGrpc::sendBatch(std::unique_lock<std::mutex> lock) {
+  auto batch_timer = batch_timer_;
+  batch_timer_ = 0;
+  proto::TxList batch;
+  batch.Swap(&batch_);
+  lock.unlock();
+
+  timer_wheel_->cancel(batch_timer);
+  if (batch.transactions_size() == 0) {
+    return;
+  }
+
+  asyncCall(server_address_, [&](auto context, auto cq) {
+    return client_->AsynconTransactions(context, batch, cq);
+  });
+}
 
-  call->response_reader->Finish(&call->reply, &call->status, call);
+OrderingGateTransportGrpc::~OrderingGateTransportGrpc() {
+  flush();
 }
 
 void OrderingGateTransportGrpc::subscribe(
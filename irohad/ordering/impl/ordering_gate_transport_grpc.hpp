@@ -18,21 +18,43 @@
 #define IROHA_ORDERING_GATE_TRANSPORT_GRPC_H
 
 #include <google/protobuf/empty.pb.h>
+#include <chrono>
+#include <mutex>
+
 #include "logger/logger.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "network/ordering_gate_transport.hpp"
 #include "ordering.grpc.pb.h"
 #include "proposal.pb.h"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
   namespace ordering {
+    /**
+     * Ordering gate transport, which sends transactions to ordering service
+     * in batches. A batch is sent when it reaches max_batch_size transactions,
+     * or batch_window after its first transaction
+     * @param server_address - address of ordering service
+     * @param max_batch_size - max number of transactions in batch
+     * @param batch_window - max delay of transaction propagation
+     * @param timer_wheel - scheduler of batch sending
+     */
     class OrderingGateTransportGrpc
         : public iroha::network::OrderingGateTransport,
           public proto::OrderingGateTransportGrpc::Service,
+          public std::enable_shared_from_this<OrderingGateTransportGrpc>,
           private network::AsyncGrpcClient<google::protobuf::Empty> {
      public:
-      explicit OrderingGateTransportGrpc(const std::string &server_address);
+      static const size_t kDefaultMaxBatchSize = 100;
+      static constexpr std::chrono::milliseconds kDefaultBatchWindow{5};
+
+      explicit OrderingGateTransportGrpc(
+          const std::string &server_address,
+          size_t max_batch_size = kDefaultMaxBatchSize,
+          std::chrono::milliseconds batch_window = kDefaultBatchWindow,
+          std::shared_ptr<timer::TimerWheel> timer_wheel =
+              timer::TimerWheel::shared());
 
       grpc::Status onProposal(::grpc::ServerContext *context,
                               const protocol::Proposal *request,
@@ -44,10 +66,35 @@ namespace iroha {
       void subscribe(std::shared_ptr<iroha::network::OrderingGateNotification>
                          subscriber) override;
 
+      /**
+       * Send transactions of current batch, if any
+       */
+      void flush();
+
+      ~OrderingGateTransportGrpc() override;
+
      private:
+      /**
+       * Take transactions of current batch and send them to ordering service
+       * Timer of the batch may wait for batch_mutex_, so the lock is released
+       * before the timer is cancelled
+       * @param lock - locked batch_mutex_
+       */
+      void sendBatch(std::unique_lock<std::mutex> lock);
+
       std::weak_ptr<iroha::network::OrderingGateNotification> subscriber_;
+      const std::string server_address_;
       std::unique_ptr<proto::OrderingServiceTransportGrpc::Stub> client_;
       model::converters::PbTransactionFactory factory_;
+
+      const size_t max_batch_size_;
+      const std::chrono::milliseconds batch_window_;
+      std::shared_ptr<timer::TimerWheel> timer_wheel_;
+
+      std::mutex batch_mutex_;
+      proto::TxList batch_;
+      timer::TimerWheel::TimerId batch_timer_ = 0;
+
       logger::Logger log_;
     };
 
@@ -16,6 +16,9 @@
  */
 
 #include "ordering/impl/ordering_service_impl.hpp"
+
+#include <algorithm>
+
 #include "ametsuchi/ordering_service_persistent_state.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
@@ -23,39 +26,80 @@
 
 namespace iroha {
   namespace ordering {
+    const size_t OrderingServiceImpl::kDefaultQueueCapacity;
+    const size_t OrderingServiceImpl::kDefaultSeenCapacity;
+    const size_t OrderingServiceImpl::kSizeRequest;
+    const size_t OrderingServiceImpl::kStopRequest;
+
     OrderingServiceImpl::OrderingServiceImpl(
         std::shared_ptr<ametsuchi::PeerQuery> wsv,
         size_t max_size,
         size_t delay_milliseconds,
         std::shared_ptr<network::OrderingServiceTransport> transport,
         std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-            persistent_state)
-        : wsv_(wsv),
+            persistent_state,
+        size_t queue_capacity,
+        size_t seen_capacity,
+        std::shared_ptr<timer::TimerWheel> timer_wheel)
+        : timer_wheel_(std::move(timer_wheel)),
+          wsv_(wsv),
+          seen_(seen_capacity),
           max_size_(max_size),
           delay_milliseconds_(delay_milliseconds),
           transport_(transport),
           persistent_state_(persistent_state) {
-      updateTimer();
       log_ = logger::log("OrderingServiceImpl");
+      queue_.set_capacity(queue_capacity);
 
       // restore state of ordering service from persistent storage
       proposal_height = persistent_state_->loadProposalHeight().value();
+
+      updateTimer();
+      proposal_thread_ = std::thread([this] { this->processRequests(); });
     }
 
-    void OrderingServiceImpl::onTransaction(
+    bool OrderingServiceImpl::onTransaction(
         std::shared_ptr<shared_model::interface::Transaction> transaction) {
-      queue_.push(transaction);
-      log_->info("Queue size is {}", queue_.unsafe_size());
+      auto hash = shared_model::crypto::toBinaryString(transaction->hash());
+      auto start = std::chrono::steady_clock::now();
+      if (not seen_.insert(hash)) {
+        ++duplicates_;
+        log_->debug("Duplicate transaction {} is dropped",
+                    transaction->hash().hex());
+        return true;
+      }
+      if (not queue_.try_push(transaction)) {
+        // forget rejected transaction, so that it can be resubmitted
+        seen_.erase(hash);
+        ++dropped_;
+        log_->warn("Queue is full, transaction is rejected");
+        return false;
+      }
+      enqueue_latency_ += (std::chrono::steady_clock::now() - start).count();
+      ++accepted_;
 
-      if (queue_.unsafe_size() >= max_size_) {
-        handle.unsubscribe();
-        updateTimer();
+      if (static_cast<size_t>(queue_.size()) >= max_size_
+          and not size_requested_.exchange(true)) {
+        requests_.push(kSizeRequest);
       }
+      return true;
+    }
+
+    OrderingServiceImpl::Metrics OrderingServiceImpl::metrics() const {
+      return {static_cast<size_t>(queue_.size()),
+              accepted_.load(),
+              dropped_.load(),
+              duplicates_.load(),
+              seen_.memoryUsage(),
+              std::chrono::nanoseconds(enqueue_latency_.load())};
     }
 
     void OrderingServiceImpl::generateProposal() {
       std::vector<shared_model::proto::Transaction> fetched_txs;
-        log_->info("Start proposal generation");
+      log_->info("Start proposal generation");
+      // queue is never popped concurrently, so its size is not negative
+      fetched_txs.reserve(
+          std::min(max_size_, static_cast<size_t>(queue_.size())));
       for (std::shared_ptr<shared_model::interface::Transaction> tx;
            fetched_txs.size() < max_size_ and queue_.try_pop(tx);) {
         fetched_txs.emplace_back(
@@ -88,17 +132,38 @@ namespace iroha {
     }
 
     void OrderingServiceImpl::updateTimer() {
+      // the handler only enqueues request, so waiting for it is safe
+      timer_wheel_->cancel(timer_id_);
       if (not queue_.empty()) {
         this->generateProposal();
       }
-      timer = rxcpp::observable<>::timer(
-          std::chrono::milliseconds(delay_milliseconds_));
-      handle = timer.subscribe_on(rxcpp::observe_on_new_thread())
-                   .subscribe([this](auto) { this->updateTimer(); });
+      timer_id_ = timer_wheel_->schedule(
+          std::chrono::milliseconds(delay_milliseconds_),
+          [this, generation = ++timer_generation_] {
+            requests_.push(generation);
+          });
+    }
+
+    void OrderingServiceImpl::processRequests() {
+      size_t request;
+      while (requests_.pop(request), request != kStopRequest) {
+        if (request == kSizeRequest) {
+          size_requested_ = false;
+          // one request stands for every full proposal in the queue
+          while (static_cast<size_t>(queue_.size()) >= max_size_) {
+            updateTimer();
+          }
+        } else if (request == timer_generation_) {
+          // timer was not replaced since it expired
+          updateTimer();
+        }
+      }
     }
 
     OrderingServiceImpl::~OrderingServiceImpl() {
-      handle.unsubscribe();
+      requests_.push(kStopRequest);
+      proposal_thread_.join();
+      timer_wheel_->cancel(timer_id_);
     }
   }  // namespace ordering
 }  // namespace iroha
@@ -19,8 +19,13 @@
 #define IROHA_ORDERING_SERVICE_IMPL_HPP
 
 #include <tbb/concurrent_queue.h>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <rxcpp/rx.hpp>
+#include <thread>
 #include <unordered_map>
 
 #include "ametsuchi/peer_query.hpp"
@@ -31,6 +36,8 @@
 #include "network/ordering_service.hpp"
 #include "network/ordering_service_transport.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/seen_transactions.hpp"
+#include "timer/timer_wheel.hpp"
 
 namespace iroha {
 
@@ -42,31 +49,69 @@ namespace iroha {
     /**
      * OrderingService implementation with gRPC synchronous server
      * Allows receiving transactions concurrently from multiple peers by using
-     * concurrent queue
+     * concurrent bounded queue. Transactions which do not fit into the queue
+     * are rejected, transactions which were already received are dropped
      * Sends proposal by given timer interval and proposal size
      * @param delay_milliseconds timer delay
      * @param max_size proposal size
      * @param persistent_state - storage for persistent state of ordering
      * service
+     * @param queue_capacity - max number of transactions waiting for proposal
+     * @param seen_capacity - min number of last received transactions, which
+     * are remembered to drop their duplicates, at most twice as many are kept
+     * @param timer_wheel - scheduler of proposal timer
      */
     class OrderingServiceImpl : public network::OrderingService {
      public:
+      static const size_t kDefaultQueueCapacity = 100000;
+      static const size_t kDefaultSeenCapacity = 100000;
+
+      /**
+       * State of transaction queue
+       */
+      struct Metrics {
+        /// number of transactions waiting for proposal
+        size_t queue_depth;
+        /// number of enqueued transactions
+        size_t accepted;
+        /// number of transactions rejected because queue is full
+        size_t dropped;
+        /// number of dropped duplicates of received transactions
+        size_t duplicates;
+        /// memory used by hashes of received transactions in bytes
+        size_t seen_memory;
+        /// total time spent on enqueueing of accepted transactions
+        std::chrono::nanoseconds enqueue_latency;
+      };
+
       OrderingServiceImpl(
           std::shared_ptr<ametsuchi::PeerQuery> wsv,
           size_t max_size,
           size_t delay_milliseconds,
           std::shared_ptr<network::OrderingServiceTransport> transport,
           std::shared_ptr<ametsuchi::OrderingServicePersistentState>
-              persistent_state);
+              persistent_state,
+          size_t queue_capacity = kDefaultQueueCapacity,
+          size_t seen_capacity = kDefaultSeenCapacity,
+          std::shared_ptr<timer::TimerWheel> timer_wheel =
+              timer::TimerWheel::shared());
 
       /**
        * Process transaction received from network
-       * Enqueues transaction and publishes corresponding event
+       * Enqueues transaction and publishes corresponding event. Duplicate of
+       * a received transaction is dropped, and reported as accepted, since
+       * the transaction is already ordered
        * @param transaction
+       * @return false if queue is full and transaction is rejected
        */
-      void onTransaction(std::shared_ptr<shared_model::interface::Transaction>
+      bool onTransaction(std::shared_ptr<shared_model::interface::Transaction>
                              transaction) override;
 
+      /**
+       * @return current state of transaction queue
+       */
+      Metrics metrics() const;
+
       ~OrderingServiceImpl() override;
 
      protected:
@@ -85,22 +130,51 @@ namespace iroha {
       void generateProposal() override;
 
       /**
-       * Method update peers for sending proposal
+       * Generate proposal if queue is not empty, and update the timer to be
+       * called after delay_milliseconds_
+       * Must be called on proposal thread
        */
+      void updateTimer();
 
       /**
-       * Update the timer to be called after delay_milliseconds_
+       * Proposal thread: handle requests of proposal by timer and by
+       * proposal size, until stop is requested. Proposal generation saves
+       * state to storage and sends proposal to peers, so it is kept off the
+       * timer wheel thread, shared with other timers
        */
-      void updateTimer();
+      void processRequests();
 
-      rxcpp::observable<long> timer;
-      rxcpp::composite_subscription handle;
+      /// request of proposal by proposal size
+      static const size_t kSizeRequest = 0;
+      /// request to stop proposal thread
+      static const size_t kStopRequest = std::numeric_limits<size_t>::max();
+
+      std::shared_ptr<timer::TimerWheel> timer_wheel_;
+      timer::TimerWheel::TimerId timer_id_ = 0;
       std::shared_ptr<ametsuchi::PeerQuery> wsv_;
 
-      tbb::concurrent_queue<
+      tbb::concurrent_bounded_queue<
           std::shared_ptr<shared_model::interface::Transaction>>
           queue_;
 
+      /**
+       * Requests of proposal: generation of the timer which has expired, or
+       * one of kSizeRequest and kStopRequest
+       */
+      tbb::concurrent_bounded_queue<size_t> requests_;
+      std::atomic<bool> size_requested_{false};
+      size_t timer_generation_ = 0;
+
+      /**
+       * Hashes of received transactions
+       */
+      SeenTransactions seen_;
+
+      std::atomic<size_t> accepted_{0};
+      std::atomic<size_t> dropped_{0};
+      std::atomic<size_t> duplicates_{0};
+      std::atomic<std::chrono::nanoseconds::rep> enqueue_latency_{0};
+
       /**
        * max number of txs in proposal
        */
@@ -127,6 +201,8 @@ namespace iroha {
       size_t proposal_height;
 
       logger::Logger log_;
+
+      std::thread proposal_thread_;
     };
   }  // namespace ordering
 }  // namespace iroha
@@ -19,8 +19,13 @@
 #include "backend/protobuf/transaction.hpp"
 #include "builders/protobuf/proposal.hpp"
 
+#include <grpc++/generic/generic_stub.h>
+
 using namespace iroha::ordering;
 
+const char *OrderingServiceTransportGrpc::kOnProposalMethod =
+    "/iroha.ordering.proto.OrderingGateTransportGrpc/onProposal";
+
 void OrderingServiceTransportGrpc::subscribe(
     std::shared_ptr<iroha::network::OrderingServiceNotification> subscriber) {
   subscriber_ = subscriber;
@@ -32,35 +37,67 @@ grpc::Status OrderingServiceTransportGrpc::onTransaction(
     ::google::protobuf::Empty *response) {
   if (subscriber_.expired()) {
     log_->error("No subscriber");
-  } else {
-    subscriber_.lock()->onTransaction(
-        std::make_shared<shared_model::proto::Transaction>(
-            iroha::protocol::Transaction(*request)));
+  } else if (not subscriber_.lock()->onTransaction(
+                 std::make_shared<shared_model::proto::Transaction>(
+                     iroha::protocol::Transaction(*request)))) {
+    return ::grpc::Status(::grpc::StatusCode::RESOURCE_EXHAUSTED,
+                          "Ordering service queue is full");
   }
 
   return ::grpc::Status::OK;
 }
 
-void OrderingServiceTransportGrpc::publishProposal(
-    std::unique_ptr<shared_model::interface::Proposal> proposal,
-    const std::vector<std::string> &peers) {
-  std::unordered_map<std::string,
-                     std::unique_ptr<proto::OrderingGateTransportGrpc::Stub>>
-      peers_map;
+grpc::Status OrderingServiceTransportGrpc::onTransactions(
+    ::grpc::ServerContext *context,
+    const proto::TxList *request,
+    ::google::protobuf::Empty *response) {
+  auto subscriber = subscriber_.lock();
+  if (not subscriber) {
+    log_->error("No subscriber");
+    return ::grpc::Status::OK;
+  }
 
-  for (const auto &peer : peers) {
-    peers_map[peer] = proto::OrderingGateTransportGrpc::NewStub(
-        grpc::CreateChannel(peer, grpc::InsecureChannelCredentials()));
+  size_t rejected = 0;
+  for (const auto &tx : request->transactions()) {
+    if (not subscriber->onTransaction(
+            std::make_shared<shared_model::proto::Transaction>(
+                iroha::protocol::Transaction(tx)))) {
+      ++rejected;
+    }
+  }
+  if (rejected != 0) {
+    return ::grpc::Status(
+        ::grpc::StatusCode::RESOURCE_EXHAUSTED,
+        std::to_string(rejected) + " of "
+            + std::to_string(request->transactions_size())
+            + " transactions are rejected, ordering service queue is full");
   }
 
-  for (const auto &peer : peers_map) {
-    auto call = new AsyncClientCall;
+  return ::grpc::Status::OK;
+}
 
-    auto proto = static_cast<shared_model::proto::Proposal *>(proposal.get());
-    call->response_reader = peer.second->AsynconProposal(
-        &call->context, proto->getTransport(), &cq_);
+void OrderingServiceTransportGrpc::publishProposal(
+    std::unique_ptr<shared_model::interface::Proposal> proposal,
+    const std::vector<std::string> &peers) {
+  // proposal is sent to all ledger peers, so channels to other addresses
+  // belong to peers which have left
+  channels_->retain(peers);
 
-    call->response_reader->Finish(&call->reply, &call->status, call);
+  // slices of the buffer are reference counted, so the proposal is
+  // serialized and copied once for all peers
+  auto proto_proposal =
+      static_cast<shared_model::proto::Proposal *>(proposal.get());
+  grpc::Slice slice(proto_proposal->getTransport().SerializeAsString());
+  grpc::ByteBuffer payload(&slice, 1);
+
+  for (const auto &peer : peers) {
+    grpc::GenericStub stub(channels_->channel(peer));
+    asyncCall(peer, [&](auto context, auto cq) {
+      auto reader =
+          stub.PrepareUnaryCall(context, kOnProposalMethod, payload, cq);
+      reader->StartCall();
+      return reader;
+    });
   }
 }
 
@@ -18,6 +18,7 @@
 #define IROHA_ORDERING_SERVICE_TRANSPORT_GRPC_HPP
 
 #include <google/protobuf/empty.pb.h>
+#include <grpc++/support/byte_buffer.h>
 #include "block.pb.h"
 #include "logger/logger.hpp"
 #include "ordering.grpc.pb.h"
@@ -28,11 +29,18 @@
 namespace iroha {
   namespace ordering {
 
+    /**
+     * Ordering service transport, which serializes a proposal once and sends
+     * the same bytes to every peer through generic gRPC calls
+     */
     class OrderingServiceTransportGrpc
         : public iroha::network::OrderingServiceTransport,
           public proto::OrderingServiceTransportGrpc::Service,
-          network::AsyncGrpcClient<google::protobuf::Empty> {
+          network::AsyncGrpcClient<grpc::ByteBuffer> {
      public:
+      /// full name of ordering gate method, which receives proposals
+      static const char *kOnProposalMethod;
+
       OrderingServiceTransportGrpc();
       void subscribe(
           std::shared_ptr<iroha::network::OrderingServiceNotification>
@@ -46,6 +54,14 @@ namespace iroha {
                                  const protocol::Transaction *request,
                                  ::google::protobuf::Empty *response) override;
 
+      /**
+       * Pass every transaction of the list to subscriber
+       * @return RESOURCE_EXHAUSTED if any of transactions is rejected
+       */
+      grpc::Status onTransactions(::grpc::ServerContext *context,
+                                  const proto::TxList *request,
+                                  ::google::protobuf::Empty *response) override;
+
       ~OrderingServiceTransportGrpc() = default;
 
      private:
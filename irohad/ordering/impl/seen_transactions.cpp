@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ordering/impl/seen_transactions.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace ordering {
+    const size_t SeenTransactions::kShards;
+
+    SeenTransactions::Shard::Shard(size_t capacity) : capacity(capacity) {
+      current.reserve(capacity);
+    }
+
+    SeenTransactions::SeenTransactions(size_t capacity) {
+      auto shard_capacity = std::max<size_t>(capacity / kShards, 1);
+      for (size_t i = 0; i < kShards; ++i) {
+        shards_.push_back(std::make_unique<Shard>(shard_capacity));
+      }
+    }
+
+    SeenTransactions::Shard &SeenTransactions::shardOf(
+        const std::string &hash) {
+      // bytes of transaction hash are uniform
+      auto byte = hash.empty() ? 0 : static_cast<unsigned char>(hash.back());
+      return *shards_[byte % kShards];
+    }
+
+    bool SeenTransactions::insert(const std::string &hash) {
+      auto &shard = shardOf(hash);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (shard.current.count(hash) or shard.previous.count(hash)) {
+        return false;
+      }
+      if (shard.current.size() >= shard.capacity) {
+        // buckets of the previous generation are reused by the next one
+        shard.previous.swap(shard.current);
+        shard.current.clear();
+      }
+      shard.current.insert(hash);
+      return true;
+    }
+
+    void SeenTransactions::erase(const std::string &hash) {
+      auto &shard = shardOf(hash);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.current.erase(hash) or shard.previous.erase(hash);
+    }
+
+    size_t SeenTransactions::memoryUsage() const {
+      size_t result = 0;
+      for (const auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        auto hashes = shard->current.size() + shard->previous.size();
+        result += hashes * (sizeof(std::string) + 2 * sizeof(void *));
+        for (const auto &set : {&shard->current, &shard->previous}) {
+          result += set->bucket_count() * sizeof(void *);
+        }
+      }
+      return result;
+    }
+
+  }  // namespace ordering
+}  // namespace iroha
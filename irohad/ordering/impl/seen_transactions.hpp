@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_SEEN_TRANSACTIONS_HPP
+#define IROHA_SEEN_TRANSACTIONS_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Thread safe set of hashes of recently received transactions.
+     * Hashes are split into shards, each guarded by its own mutex. A shard
+     * keeps two generations of hashes in exact sets: when the current one is
+     * full, it replaces the previous one, which is forgotten. So at least
+     * capacity last hashes are remembered, memory is bounded by twice the
+     * capacity, and a hash which was not inserted is never reported as seen
+     */
+    class SeenTransactions {
+     public:
+      static const size_t kShards = 16;
+
+      /**
+       * @param capacity - number of hashes in a generation
+       */
+      explicit SeenTransactions(size_t capacity);
+
+      /**
+       * Record the hash, unless it is already remembered
+       * @param hash - bytes of the hash
+       * @return true if hash is recorded, false if it is remembered
+       */
+      bool insert(const std::string &hash);
+
+      /**
+       * Forget the hash, so that it can be recorded again
+       * @param hash - bytes of the hash
+       */
+      void erase(const std::string &hash);
+
+      /**
+       * @return approximate memory used by sets of hashes in bytes
+       */
+      size_t memoryUsage() const;
+
+     private:
+      struct Shard {
+        explicit Shard(size_t capacity);
+
+        mutable std::mutex mutex;
+        /// number of hashes in a generation of the shard
+        const size_t capacity;
+        std::unordered_set<std::string> current;
+        std::unordered_set<std::string> previous;
+      };
+
+      Shard &shardOf(const std::string &hash);
+
+      std::vector<std::unique_ptr<Shard>> shards_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_SEEN_TRANSACTIONS_HPP
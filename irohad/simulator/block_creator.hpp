@@ -19,8 +19,8 @@
 #define IROHA_BLOCK_CREATOR_HPP
 
 #include <rxcpp/rx-observable.hpp>
+#include "interfaces/iroha_internal/proposal.hpp"
 #include "model/block.hpp"
-#include "model/proposal.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -34,7 +34,8 @@ namespace iroha {
        * Processing proposal for making stateful validation
        * @param proposal - object for validation
        */
-      virtual void process_verified_proposal(model::Proposal) = 0;
+      virtual void process_verified_proposal(
+          std::shared_ptr<shared_model::interface::Proposal> proposal) = 0;
 
       /**
        * Emit blocks made from proposals
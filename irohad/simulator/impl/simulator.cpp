@@ -16,32 +16,37 @@
  */
 
 #include "simulator/impl/simulator.hpp"
-#include "backend/protobuf/from_old_model.hpp"
 #include "model/sha3_hash.hpp"
 
 namespace iroha {
   namespace simulator {
 
+    const size_t Simulator::kMaxSpeculativeDepth;
+
     Simulator::Simulator(
         std::shared_ptr<network::OrderingGate> ordering_gate,
         std::shared_ptr<validation::StatefulValidator> statefulValidator,
         std::shared_ptr<ametsuchi::TemporaryFactory> factory,
         std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
-        std::shared_ptr<model::ModelCryptoProvider> crypto_provider)
+        std::shared_ptr<model::ModelCryptoProvider> crypto_provider,
+        bool pipelined)
         : validator_(std::move(statefulValidator)),
           ametsuchi_factory_(std::move(factory)),
           block_queries_(std::move(blockQuery)),
-          crypto_provider_(std::move(crypto_provider)) {
+          crypto_provider_(std::move(crypto_provider)),
+          pipelined_(pipelined) {
       log_ = logger::log("Simulator");
-      ordering_gate->on_proposal().subscribe(proposal_subscription_,
-                                             [this](model::Proposal proposal) {
-                                               this->process_proposal(proposal);
-                                             });
+      ordering_gate->on_proposal().subscribe(
+          proposal_subscription_,
+          [this](std::shared_ptr<shared_model::interface::Proposal> proposal) {
+            this->process_proposal(*proposal);
+          });
 
       notifier_.get_observable().subscribe(
           verified_proposal_subscription_,
-          [this](model::Proposal verified_proposal) {
-            this->process_verified_proposal(verified_proposal);
+          [this](std::shared_ptr<shared_model::interface::Proposal>
+                     verified_proposal) {
+            this->process_verified_proposal(std::move(verified_proposal));
           });
     }
 
@@ -50,11 +55,13 @@ namespace iroha {
       verified_proposal_subscription_.unsubscribe();
     }
 
-    rxcpp::observable<model::Proposal> Simulator::on_verified_proposal() {
+    rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+    Simulator::on_verified_proposal() {
       return notifier_.get_observable();
     }
 
-    void Simulator::process_proposal(model::Proposal proposal) {
+    void Simulator::process_proposal(
+        const shared_model::interface::Proposal &proposal) {
       log_->info("process proposal");
       // Get last block from local ledger
       block_queries_->getTopBlocks(1).as_blocking().subscribe(
@@ -63,23 +70,31 @@ namespace iroha {
         log_->warn("Could not fetch last block");
         return;
       }
-      if (last_block.value().height + 1 != proposal.height) {
+      dropCommittedBlocks();
+      const auto &top_block = pending_blocks_.empty()
+          ? last_block.value()
+          : pending_blocks_.back().block;
+      if (top_block.height + 1 != proposal.height()) {
         log_->warn("Last block height: {}, proposal height: {}",
-                   last_block.value().height,
-                   proposal.height);
+                   top_block.height,
+                   proposal.height());
         return;
       }
-      auto temporaryStorageResult = ametsuchi_factory_->createTemporaryWsv();
+      if (pending_blocks_.size() > kMaxSpeculativeDepth) {
+        log_->warn("{} blocks are not committed, proposal {} is skipped",
+                   pending_blocks_.size(),
+                   proposal.height());
+        return;
+      }
+      auto temporaryStorageResult = createTemporaryWsv();
       temporaryStorageResult.match(
           [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
                   &temporaryStorage) {
-            auto shm_proposal = shared_model::proto::Proposal(
-                shared_model::proto::from_old(proposal));
             auto validated_proposal =
-                validator_->validate(shm_proposal, *temporaryStorage.value);
-            std::unique_ptr<model::Proposal> old_proposal(
-                validated_proposal->makeOldModel());
-            notifier_.get_subscriber().on_next(*old_proposal);
+                validator_->validate(proposal,
+                                     *temporaryStorage.value,
+                                     [this] { return createTemporaryWsv(); });
+            notifier_.get_subscriber().on_next(validated_proposal);
           },
           [&](expected::Error<std::string> &error) {
             log_->error(error.error);
@@ -89,20 +104,63 @@ namespace iroha {
           });
     }
 
-    void Simulator::process_verified_proposal(model::Proposal proposal) {
+    expected::Result<std::unique_ptr<ametsuchi::TemporaryWsv>, std::string>
+    Simulator::createTemporaryWsv() {
+      auto temporaryStorageResult = ametsuchi_factory_->createTemporaryWsv();
+      temporaryStorageResult.match(
+          [this](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                     &temporaryStorage) {
+            // transactions of created blocks are already validated
+            for (const auto &pending : pending_blocks_) {
+              for (const auto &tx : pending.proposal->transactions()) {
+                temporaryStorage.value->apply(
+                    *tx.operator->(),
+                    [](const auto &, auto &) { return true; });
+              }
+            }
+          },
+          [](expected::Error<std::string> &) {});
+      return temporaryStorageResult;
+    }
+
+    void Simulator::process_verified_proposal(
+        std::shared_ptr<shared_model::interface::Proposal> proposal) {
       log_->info("process verified proposal");
+      // block is created and signed in old model
+      std::unique_ptr<model::Proposal> old_proposal(proposal->makeOldModel());
       model::Block new_block;
-      new_block.height = proposal.height;
-      new_block.prev_hash = last_block.value().hash;
-      new_block.transactions = proposal.transactions;
-      new_block.txs_number = proposal.transactions.size();
-      new_block.created_ts = proposal.created_time;
+      new_block.height = old_proposal->height;
+      new_block.prev_hash = pending_blocks_.empty()
+          ? last_block.value().hash
+          : pending_blocks_.back().block.hash;
+      new_block.transactions = std::move(old_proposal->transactions);
+      new_block.txs_number = new_block.transactions.size();
+      new_block.created_ts = proposal->created_time();
       new_block.hash = hash(new_block);
       crypto_provider_->sign(new_block);
+      if (pipelined_) {
+        pending_blocks_.push_back({new_block, std::move(proposal)});
+      }
 
       block_notifier_.get_subscriber().on_next(new_block);
     }
 
+    void Simulator::dropCommittedBlocks() {
+      while (not pending_blocks_.empty()
+             and pending_blocks_.front().block.height
+                 <= last_block.value().height) {
+        pending_blocks_.pop_front();
+      }
+      if (not pending_blocks_.empty()
+          and pending_blocks_.front().block.prev_hash
+              != last_block.value().hash) {
+        log_->warn("Committed block differs from created one, {} blocks are "
+                   "discarded",
+                   pending_blocks_.size());
+        pending_blocks_.clear();
+      }
+    }
+
     rxcpp::observable<model::Block> Simulator::on_block() {
       return block_notifier_.get_observable();
     }
@@ -18,6 +18,7 @@
 #ifndef IROHA_SIMULATOR_HPP
 #define IROHA_SIMULATOR_HPP
 
+#include <deque>
 #include <nonstd/optional.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/temporary_factory.hpp"
@@ -32,31 +33,73 @@
 namespace iroha {
   namespace simulator {
 
+    /**
+     * Validates proposals and creates blocks from them.
+     * In pipelined mode proposal for the next height is validated while the
+     * block of the previous one is still being agreed on: the proposal is
+     * validated against temporary wsv with transactions of not yet committed
+     * blocks applied. If committed block differs from the created one, blocks
+     * created on top of it are discarded
+     * @param pipelined - whether to validate proposals on top of not yet
+     * committed blocks
+     */
     class Simulator : public VerifiedProposalCreator, public BlockCreator {
      public:
+      /// max number of not yet committed blocks under validated proposal
+      static const size_t kMaxSpeculativeDepth = 1;
+
       Simulator(
           std::shared_ptr<network::OrderingGate> ordering_gate,
           std::shared_ptr<validation::StatefulValidator> statefulValidator,
           std::shared_ptr<ametsuchi::TemporaryFactory> factory,
           std::shared_ptr<ametsuchi::BlockQuery> blockQuery,
-          std::shared_ptr<model::ModelCryptoProvider> crypto_provider);
+          std::shared_ptr<model::ModelCryptoProvider> crypto_provider,
+          bool pipelined = false);
 
       Simulator(const Simulator &) = delete;
       Simulator &operator=(const Simulator &) = delete;
 
       ~Simulator();
 
-      void process_proposal(model::Proposal proposal) override;
+      void process_proposal(
+          const shared_model::interface::Proposal &proposal) override;
 
-      rxcpp::observable<model::Proposal> on_verified_proposal() override;
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+      on_verified_proposal() override;
 
-      void process_verified_proposal(model::Proposal proposal) override;
+      void process_verified_proposal(
+          std::shared_ptr<shared_model::interface::Proposal> proposal) override;
 
       rxcpp::observable<model::Block> on_block() override;
 
      private:
+      /**
+       * Block, which is created, but not yet committed
+       */
+      struct PendingBlock {
+        model::Block block;
+        /// verified proposal of the block, which transactions are applied to
+        /// temporary wsv
+        std::shared_ptr<shared_model::interface::Proposal> proposal;
+      };
+
+      /**
+       * Forget created blocks, which are committed, or which do not extend
+       * the last committed block
+       */
+      void dropCommittedBlocks();
+
+      /**
+       * Create temporary wsv with transactions of created, but not yet
+       * committed blocks applied
+       */
+      expected::Result<std::unique_ptr<ametsuchi::TemporaryWsv>, std::string>
+      createTemporaryWsv();
+
       // internal
-      rxcpp::subjects::subject<model::Proposal> notifier_;
+      rxcpp::subjects::subject<
+          std::shared_ptr<shared_model::interface::Proposal>>
+          notifier_;
       rxcpp::subjects::subject<model::Block> block_notifier_;
 
       rxcpp::composite_subscription proposal_subscription_;
@@ -71,6 +114,11 @@ namespace iroha {
 
       // last block
       nonstd::optional<model::Block> last_block;
+
+      const bool pipelined_;
+
+      // created, but not yet committed blocks in height order
+      std::deque<PendingBlock> pending_blocks_;
     };
   }  // namespace simulator
 }  // namespace iroha
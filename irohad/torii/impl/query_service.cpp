@@ -95,4 +95,57 @@ namespace torii {
     return grpc::Status::OK;
   }
 
+  void QueryService::FetchTransactions(
+      iroha::protocol::Query const &request,
+      grpc::ServerWriter<iroha::protocol::QueryResponse> &response_writer) {
+    shared_model::proto::TransportBuilder<
+        shared_model::proto::Query,
+        shared_model::validation::DefaultQueryValidator>()
+        .build(request)
+        .match(
+            [this, &response_writer](
+                const iroha::expected::Value<shared_model::proto::Query>
+                    &query) {
+              auto subscription = rxcpp::composite_subscription();
+              query_processor_
+                  ->queryPages(
+                      std::make_shared<shared_model::proto::Query>(query.value))
+                  .subscribe(
+                      subscription,
+                      [&subscription, &response_writer](
+                          std::shared_ptr<
+                              shared_model::interface::QueryResponse>
+                              response) {
+                        // stop paging when client has closed the stream
+                        if (not response_writer.Write(
+                                static_cast<
+                                    shared_model::proto::QueryResponse &>(
+                                    *response)
+                                    .getTransport())) {
+                          subscription.unsubscribe();
+                        }
+                      });
+            },
+            [&request, &response_writer](
+                const iroha::expected::Error<std::string> &error) {
+              iroha::protocol::QueryResponse response;
+              auto hash =
+                  shared_model::proto::Query::HashProviderType::makeHash(
+                      shared_model::proto::makeBlob(request.payload()));
+              response.set_query_hash(
+                  shared_model::crypto::toBinaryString(hash));
+              response.mutable_error_response()->set_reason(
+                  iroha::protocol::ErrorResponse::STATELESS_INVALID);
+              response_writer.WriteLast(response, grpc::WriteOptions());
+            });
+  }
+
+  grpc::Status QueryService::FetchTransactions(
+      grpc::ServerContext *context,
+      const iroha::protocol::Query *request,
+      grpc::ServerWriter<iroha::protocol::QueryResponse> *response_writer) {
+    FetchTransactions(*request, *response_writer);
+    return grpc::Status::OK;
+  }
+
 }  // namespace torii
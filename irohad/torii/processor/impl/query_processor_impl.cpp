@@ -18,13 +18,17 @@
 #include "torii/processor/query_processor_impl.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "backend/protobuf/from_old_model.hpp"
+#include "model/queries/responses/transactions_response.hpp"
+#include "model/sha3_hash.hpp"
 
 namespace iroha {
   namespace torii {
 
+    constexpr uint32_t QueryProcessorImpl::kDefaultPageSize;
+
     QueryProcessorImpl::QueryProcessorImpl(
-        std::unique_ptr<model::QueryProcessingFactory> qpf)
-        : qpf_(std::move(qpf)) {}
+        std::unique_ptr<model::QueryProcessingFactory> qpf, uint32_t page_size)
+        : qpf_(std::move(qpf)), page_size_(page_size) {}
 
     void QueryProcessorImpl::queryHandle(
         std::shared_ptr<shared_model::interface::Query> qry) {
@@ -44,5 +48,56 @@ namespace iroha {
       return subject_.get_observable();
     }
 
+    rxcpp::observable<std::shared_ptr<shared_model::interface::QueryResponse>>
+    QueryProcessorImpl::queryPages(
+        std::shared_ptr<shared_model::interface::Query> qry) {
+      return rxcpp::observable<>::create<
+          std::shared_ptr<shared_model::interface::QueryResponse>>(
+          [this, qry](auto subscriber) {
+            std::shared_ptr<model::Query> query(qry->makeOldModel());
+            // every page refers to the query of the client
+            auto query_hash = iroha::hash(*query).to_string();
+
+            model::Pager *pager = nullptr;
+            if (instanceof <model::GetAccountTransactions>(query.get())) {
+              pager =
+                  &static_cast<model::GetAccountTransactions &>(*query).pager;
+            } else if (instanceof <model::GetAccountAssetTransactions>(
+                           query.get())) {
+              pager = &static_cast<model::GetAccountAssetTransactions &>(
+                           *query)
+                           .pager;
+            }
+            if (pager and pager->page_size == 0) {
+              pager->page_size = page_size_;
+            }
+
+            while (subscriber.is_subscribed()) {
+              auto qpf_response =
+                  qpf_->execute(std::shared_ptr<const model::Query>(query));
+              auto response =
+                  shared_model::proto::from_old(qpf_response).getTransport();
+              response.set_query_hash(query_hash);
+              subscriber.on_next(
+                  std::make_shared<shared_model::proto::QueryResponse>(
+                      std::move(response)));
+
+              if (not pager
+                  or not instanceof <model::TransactionsResponse>(
+                         qpf_response.get())) {
+                break;
+              }
+              const auto &next_cursor =
+                  static_cast<model::TransactionsResponse &>(*qpf_response)
+                      .next_cursor;
+              if (not next_cursor) {
+                break;
+              }
+              pager->cursor = *next_cursor;
+            }
+            subscriber.on_completed();
+          });
+    }
+
   }  // namespace torii
 }  // namespace iroha
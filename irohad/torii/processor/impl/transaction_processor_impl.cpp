@@ -35,11 +35,12 @@ namespace iroha {
       log_ = logger::log("TxProcessor");
 
       // insert all txs from proposal to proposal set
-      pcs_->on_proposal().subscribe([this](model::Proposal proposal) {
-        for (const auto &tx : proposal.transactions) {
-          proposal_set_.insert(hash(tx).to_string());
+      pcs_->on_proposal().subscribe([this](auto proposal) {
+        for (const auto &tx : proposal->transactions()) {
+          auto tx_hash = shared_model::crypto::toBinaryString(tx->hash());
+          proposal_set_.insert(tx_hash);
           TransactionResponse response;
-          response.tx_hash = hash(tx).to_string();
+          response.tx_hash = tx_hash;
           response.current_status =
               TransactionResponse::STATELESS_VALIDATION_SUCCESS;
           notifier_.get_subscriber().on_next(
@@ -51,6 +51,16 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::QueryResponse>>
       queryNotifier() = 0;
 
+      /**
+       * Execute query for account history page by page
+       * @param qry - client intent
+       * @return observable with query responses, one for every page. Other
+       * queries have a single response
+       */
+      virtual rxcpp::observable<
+          std::shared_ptr<shared_model::interface::QueryResponse>>
+      queryPages(std::shared_ptr<shared_model::interface::Query> qry) = 0;
+
       virtual ~QueryProcessor(){};
     };
   }  // namespace torii
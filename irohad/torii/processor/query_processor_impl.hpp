@@ -30,8 +30,14 @@ namespace iroha {
      */
     class QueryProcessorImpl : public QueryProcessor {
      public:
+      /**
+       * @param qpf - query processing factory
+       * @param page_size - number of transactions in a page of account
+       * history streamed to client, if client has not set it
+       */
       explicit QueryProcessorImpl(
-          std::unique_ptr<model::QueryProcessingFactory> qpf);
+          std::unique_ptr<model::QueryProcessingFactory> qpf,
+          uint32_t page_size = kDefaultPageSize);
 
       /**
        * Register client query
@@ -48,11 +54,23 @@ namespace iroha {
           shared_model::interface::QueryResponse>>
       queryNotifier() override;
 
+      /**
+       * Execute query for account history page by page
+       * @param qry - client intent
+       * @return observable with query responses, one for every page
+       */
+      rxcpp::observable<std::shared_ptr<
+          shared_model::interface::QueryResponse>>
+      queryPages(std::shared_ptr<shared_model::interface::Query> qry) override;
+
+      static constexpr uint32_t kDefaultPageSize = 100;
+
      private:
       rxcpp::subjects::subject<
           std::shared_ptr<shared_model::interface::QueryResponse>>
           subject_;
       std::unique_ptr<model::QueryProcessingFactory> qpf_;
+      uint32_t page_size_;
     };
   }  // namespace torii
 }  // namespace iroha
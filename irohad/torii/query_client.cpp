@@ -54,6 +54,25 @@ namespace torii_utils {
     return stub_->Find(&context, query, &response);
   }
 
+  /**
+   * requests account history from a torii server page by page (blocking, sync)
+   * @param query
+   * @param responses
+   * @return grpc::Status
+   */
+  grpc::Status QuerySyncClient::FetchTransactions(
+      const iroha::protocol::Query &query,
+      std::vector<QueryResponse> &responses) const {
+    grpc::ClientContext context;
+    std::unique_ptr<grpc::ClientReader<QueryResponse>> reader(
+        stub_->FetchTransactions(&context, query));
+    QueryResponse response;
+    while (reader->Read(&response)) {
+      responses.push_back(response);
+    }
+    return reader->Finish();
+  }
+
   void QuerySyncClient::swap(QuerySyncClient &lhs, QuerySyncClient &rhs) {
     using std::swap;
     swap(lhs.ip_, rhs.ip_);
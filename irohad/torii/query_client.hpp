@@ -23,6 +23,7 @@ limitations under the License.
 #include <grpc++/grpc++.h>
 #include <memory>
 #include <thread>
+#include <vector>
 
 namespace torii_utils {
 
@@ -48,6 +49,17 @@ namespace torii_utils {
     grpc::Status Find(const iroha::protocol::Query &query,
                       iroha::protocol::QueryResponse &response) const;
 
+    /**
+     * requests account history from a torii server page by page
+     * (blocking, sync)
+     * @param query - contains Query for account history.
+     * @param responses - QueryResponse for every received page.
+     * @return grpc::Status
+     */
+    grpc::Status FetchTransactions(
+        const iroha::protocol::Query &query,
+        std::vector<iroha::protocol::QueryResponse> &responses) const;
+
    private:
     void swap(QuerySyncClient& lhs, QuerySyncClient& rhs);
 
@@ -56,6 +56,22 @@ namespace torii {
                       const iroha::protocol::Query *request,
                       iroha::protocol::QueryResponse *response) override;
 
+    /**
+     * actual implementation of FetchTransactions in QueryService, which
+     * streams account history page by page
+     * @param request - Query for account history
+     * @param response_writer - stream of QueryResponse, one for every page
+     */
+    void FetchTransactions(
+        iroha::protocol::Query const &request,
+        grpc::ServerWriter<iroha::protocol::QueryResponse> &response_writer);
+
+    grpc::Status FetchTransactions(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        grpc::ServerWriter<iroha::protocol::QueryResponse> *response_writer)
+        override;
+
    private:
     std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
 
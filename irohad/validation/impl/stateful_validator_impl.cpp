@@ -15,6 +15,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <future>
 #include <numeric>
 #include <set>
 
@@ -22,11 +24,13 @@
 #include "builders/protobuf/proposal.hpp"
 #include "model/account.hpp"
 #include "validation/impl/stateful_validator_impl.hpp"
+#include "validation/impl/transaction_conflicts.hpp"
 
 namespace iroha {
   namespace validation {
 
-    StatefulValidatorImpl::StatefulValidatorImpl() {
+    StatefulValidatorImpl::StatefulValidatorImpl(size_t workers)
+        : workers_(std::max<size_t>(workers, 1)) {
       log_ = logger::log("SFV");
     }
 
@@ -36,51 +40,134 @@ namespace iroha {
         ametsuchi::TemporaryWsv &temporaryWsv) {
       log_->info("transactions in proposal: {}",
                  proposal.transactions().size());
-      auto checking_transaction = [this](const auto &tx, auto &queries) {
-        return (queries.getAccount(tx.creatorAccountId()) |
-                [&](const auto &account) {
-                  // Check if tx creator has account and has quorum to execute
-                  // transaction
-                  return tx.signatures().size() >= account.quorum
-                      ? queries.getSignatories(tx.creatorAccountId())
-                      : nonstd::nullopt;
-                }
-                |
-                [&](const auto &signatories) {
-                  auto model_signatories =
-                      signatories
-                      | boost::adaptors::transformed([](const auto &signatory) {
-                          return shared_model::crypto::PublicKey(
-                              signatory.to_string());
-                        });
-                  // Check if signatures in transaction are account signatory
-                  return this->signaturesSubset(
-                             tx.signatures(),
-                             std::vector<shared_model::crypto::PublicKey>(
-                                 model_signatories.begin(),
-                                 model_signatories.end()))
-                      ? nonstd::make_optional(model_signatories)
-                      : nonstd::nullopt;
-                })
-            .has_value();
-      };
-
-      // Filter only valid transactions
-      auto filter = [&temporaryWsv, checking_transaction](auto &acc,
-                                                          const auto &tx) {
-        std::unique_ptr<model::Transaction> old_tx(tx->makeOldModel());
-        auto answer =
-            temporaryWsv.apply(*(tx.operator->()), checking_transaction);
-        if (answer) {
-          acc.push_back(tx);
-        }
-        return acc;
-      };
+      auto &txs = proposal.transactions();
+      std::vector<size_t> indexes(txs.size());
+      std::iota(indexes.begin(), indexes.end(), 0);
+      std::vector<char> valid(txs.size(), false);
+      validateTransactions(txs, indexes, temporaryWsv, valid);
+      return makeProposal(proposal, valid);
+    }
 
+    std::shared_ptr<shared_model::interface::Proposal>
+    StatefulValidatorImpl::validate(
+        const shared_model::interface::Proposal &proposal,
+        ametsuchi::TemporaryWsv &temporaryWsv,
+        const TemporaryWsvFactory &create_wsv) {
+      if (workers_ == 1 or not create_wsv) {
+        return validate(proposal, temporaryWsv);
+      }
+      log_->info("transactions in proposal: {}",
+                 proposal.transactions().size());
       auto &txs = proposal.transactions();
-      decltype(txs) valid = {};
+      auto batches = splitIntoBatches(txs);
+      log_->info("independent batches: {}", batches.size());
+      // each batch writes only its own indexes
+      std::vector<char> valid(txs.size(), false);
+
+      // first batch is validated by the caller on given wsv, others on
+      // created ones
+      std::vector<std::future<bool>> workers;
+      for (size_t i = 1; i < batches.size(); ++i) {
+        workers.push_back(std::async(std::launch::async, [&, i] {
+          return create_wsv().match(
+              [&](expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>
+                      &wsv) {
+                this->validateTransactions(txs, batches[i], *wsv.value, valid);
+                return true;
+              },
+              [](expected::Error<std::string> &) { return false; });
+        }));
+      }
+      validateTransactions(txs, batches.front(), temporaryWsv, valid);
+      for (size_t i = 1; i < batches.size(); ++i) {
+        if (not workers[i - 1].get()) {
+          // batches are independent, so given wsv can validate it afterwards
+          log_->warn("Could not create temporary wsv for batch {}", i);
+          validateTransactions(txs, batches[i], temporaryWsv, valid);
+        }
+      }
+      return makeProposal(proposal, valid);
+    }
 
-      auto valid_txs = std::accumulate(txs.begin(), txs.end(), valid, filter);
+    std::vector<std::vector<size_t>> StatefulValidatorImpl::splitIntoBatches(
+        const TransactionsType &txs) const {
+      auto groups = independentGroups(txs);
+      std::stable_sort(
+          groups.begin(), groups.end(), [](const auto &a, const auto &b) {
+            return a.size() > b.size();
+          });
+
+      std::vector<std::vector<size_t>> batches(
+          std::min(workers_, std::max<size_t>(groups.size(), 1)));
+      for (const auto &group : groups) {
+        auto &batch = *std::min_element(
+            batches.begin(), batches.end(), [](const auto &a, const auto &b) {
+              return a.size() < b.size();
+            });
+        batch.insert(batch.end(), group.begin(), group.end());
+      }
+      // transactions of a group stay in proposal order after merge
+      for (auto &batch : batches) {
+        std::sort(batch.begin(), batch.end());
+      }
+      return batches;
+    }
+
+    void StatefulValidatorImpl::validateTransactions(
+        const TransactionsType &txs,
+        const std::vector<size_t> &indexes,
+        ametsuchi::TemporaryWsv &temporaryWsv,
+        std::vector<char> &valid) {
+      for (auto i : indexes) {
+        valid[i] = temporaryWsv.apply(
+            *(txs[i].operator->()), [this](const auto &tx, auto &queries) {
+              return this->checkTransaction(tx, queries);
+            });
+      }
+    }
+
+    bool StatefulValidatorImpl::checkTransaction(
+        const shared_model::interface::Transaction &tx,
+        ametsuchi::WsvQuery &queries) {
+      return (queries.getAccount(tx.creatorAccountId()) |
+              [&](const auto &account) {
+                // Check if tx creator has account and has quorum to execute
+                // transaction
+                return tx.signatures().size() >= account.quorum
+                    ? queries.getSignatories(tx.creatorAccountId())
+                    : nonstd::nullopt;
+              }
+              |
+              [&](const auto &signatories) {
+                auto model_signatories =
+                    signatories
+                    | boost::adaptors::transformed([](const auto &signatory) {
+                        return shared_model::crypto::PublicKey(
+                            signatory.to_string());
+                      });
+                // Check if signatures in transaction are account signatory
+                return this->signaturesSubset(
+                           tx.signatures(),
+                           std::vector<shared_model::crypto::PublicKey>(
+                               model_signatories.begin(),
+                               model_signatories.end()))
+                    ? nonstd::make_optional(model_signatories)
+                    : nonstd::nullopt;
+              })
+          .has_value();
+    }
+
+    std::shared_ptr<shared_model::interface::Proposal>
+    StatefulValidatorImpl::makeProposal(
+        const shared_model::interface::Proposal &proposal,
+        const std::vector<char> &valid) {
+      auto &txs = proposal.transactions();
+      TransactionsType valid_txs;
+      for (size_t i = 0; i < txs.size(); ++i) {
+        if (valid[i]) {
+          valid_txs.push_back(txs[i]);
+        }
+      }
 
       // TODO: kamilsa IR-1010 20.02.2018 rework validation logic, so that this
       // cast is not needed and stateful validator does not know about the
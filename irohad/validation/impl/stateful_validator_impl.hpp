@@ -29,7 +29,11 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
-      StatefulValidatorImpl();
+      /**
+       * @param workers - maximal number of threads validating independent
+       * transactions of proposal
+       */
+      explicit StatefulValidatorImpl(size_t workers = 1);
 
       /**
        * Function perform stateful validation on proposal
@@ -44,7 +48,51 @@ namespace iroha {
           const shared_model::interface::Proposal &proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
+      std::shared_ptr<shared_model::interface::Proposal> validate(
+          const shared_model::interface::Proposal &proposal,
+          ametsuchi::TemporaryWsv &temporaryWsv,
+          const TemporaryWsvFactory &create_wsv) override;
+
      private:
+      using TransactionsType =
+          shared_model::interface::Proposal::TransactionContainer;
+
+      /**
+       * Split transactions of proposal into at most workers_ batches, which
+       * do not depend on each other. Largest groups of dependent transactions
+       * are assigned first, each to the least loaded batch
+       * @param txs - transactions of proposal
+       * @return indexes of transactions of each batch in proposal order
+       */
+      std::vector<std::vector<size_t>> splitIntoBatches(
+          const TransactionsType &txs) const;
+
+      /**
+       * Apply transactions with given indexes to wsv one by one
+       * @param txs - transactions of proposal
+       * @param indexes - indexes of transactions to apply
+       * @param temporaryWsv - wsv to apply transactions to
+       * @param valid - set to true for indexes of valid transactions
+       */
+      void validateTransactions(const TransactionsType &txs,
+                                const std::vector<size_t> &indexes,
+                                ametsuchi::TemporaryWsv &temporaryWsv,
+                                std::vector<char> &valid);
+
+      /**
+       * Check that creator has account with quorum and signatures of
+       * transaction belong to its signatories
+       */
+      bool checkTransaction(const shared_model::interface::Transaction &tx,
+                            ametsuchi::WsvQuery &queries);
+
+      /**
+       * Build proposal of transactions marked as valid
+       */
+      std::shared_ptr<shared_model::interface::Proposal> makeProposal(
+          const shared_model::interface::Proposal &proposal,
+          const std::vector<char> &valid);
+
       /**
        * Checks if public keys of signatures are present in vector of pubkeys
        * @param signatures - collection of signatures
@@ -57,6 +105,7 @@ namespace iroha {
               &signatures,
           const std::vector<shared_model::crypto::PublicKey> &public_keys);
 
+      const size_t workers_;
       logger::Logger log_;
     };
   }  // namespace validation
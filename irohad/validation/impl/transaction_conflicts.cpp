@@ -0,0 +1,236 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "validation/impl/transaction_conflicts.hpp"
+
+#include <numeric>
+#include <unordered_map>
+
+#include <boost/variant/static_visitor.hpp>
+
+#include "interfaces/commands/command.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    namespace {
+      using shared_model::detail::PolymorphicWrapper;
+      namespace interface = shared_model::interface;
+
+      std::string accountKey(const std::string &account_id) {
+        return "account:" + account_id;
+      }
+
+      std::string assetKey(const std::string &asset_id) {
+        return "asset:" + asset_id;
+      }
+
+      std::string domainKey(const std::string &domain_id) {
+        return "domain:" + domain_id;
+      }
+
+      std::string roleKey(const std::string &role_name) {
+        return "role:" + role_name;
+      }
+
+      /// all peer commands conflict with each other
+      const std::string kPeersKey = "peers";
+
+      /**
+       * Adds keys of the visited command to the sets
+       */
+      class CommandKeysVisitor : public boost::static_visitor<void> {
+       public:
+        explicit CommandKeysVisitor(TransactionKeys &keys) : keys_(keys) {}
+
+        void operator()(
+            const PolymorphicWrapper<interface::AddAssetQuantity> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+          keys_.reads.insert(assetKey(cmd->assetId()));
+        }
+
+        void operator()(const PolymorphicWrapper<interface::AddPeer> &) const {
+          keys_.writes.insert(kPeersKey);
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::AddSignatory> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::AppendRole> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+          keys_.reads.insert(roleKey(cmd->roleName()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::CreateAccount> &cmd) const {
+          keys_.writes.insert(
+              accountKey(cmd->accountName() + "@" + cmd->domainId()));
+          keys_.reads.insert(domainKey(cmd->domainId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::CreateAsset> &cmd) const {
+          keys_.writes.insert(
+              assetKey(cmd->assetName() + "#" + cmd->domainId()));
+          keys_.reads.insert(domainKey(cmd->domainId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::CreateDomain> &cmd) const {
+          keys_.writes.insert(domainKey(cmd->domainId()));
+          keys_.reads.insert(roleKey(cmd->userDefaultRole()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::CreateRole> &cmd) const {
+          keys_.writes.insert(roleKey(cmd->roleName()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::DetachRole> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+          keys_.reads.insert(roleKey(cmd->roleName()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::GrantPermission> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::RemoveSignatory> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::RevokePermission> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::SetAccountDetail> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::SetQuorum> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::SubtractAssetQuantity> &cmd)
+            const {
+          keys_.writes.insert(accountKey(cmd->accountId()));
+          keys_.reads.insert(assetKey(cmd->assetId()));
+        }
+
+        void operator()(
+            const PolymorphicWrapper<interface::TransferAsset> &cmd) const {
+          keys_.writes.insert(accountKey(cmd->srcAccountId()));
+          keys_.writes.insert(accountKey(cmd->destAccountId()));
+          keys_.reads.insert(assetKey(cmd->assetId()));
+        }
+
+       private:
+        TransactionKeys &keys_;
+      };
+
+      /**
+       * Find representative of the set with path halving
+       */
+      size_t findRoot(std::vector<size_t> &parents, size_t i) {
+        while (parents[i] != i) {
+          parents[i] = parents[parents[i]];
+          i = parents[i];
+        }
+        return i;
+      }
+    }  // namespace
+
+    TransactionKeys transactionKeys(
+        const shared_model::interface::Transaction &tx) {
+      TransactionKeys keys;
+      // signatories and quorum of creator are checked, its transaction
+      // counter is changed
+      keys.writes.insert(accountKey(tx.creatorAccountId()));
+      CommandKeysVisitor visitor(keys);
+      for (const auto &command : tx.commands()) {
+        boost::apply_visitor(visitor, command->get());
+      }
+      return keys;
+    }
+
+    std::vector<std::vector<size_t>> independentGroups(
+        const std::vector<shared_model::detail::PolymorphicWrapper<
+            shared_model::interface::Transaction>> &transactions) {
+      std::vector<size_t> parents(transactions.size());
+      std::iota(parents.begin(), parents.end(), 0);
+      // attach to the smaller root, so root is the first transaction of set
+      auto unite = [&parents](size_t a, size_t b) {
+        a = findRoot(parents, a);
+        b = findRoot(parents, b);
+        parents[std::max(a, b)] = std::min(a, b);
+      };
+
+      // transactions, which access the key
+      struct Accesses {
+        std::vector<size_t> readers;
+        std::vector<size_t> writers;
+      };
+      std::unordered_map<std::string, Accesses> accesses;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        auto keys = transactionKeys(*transactions[i].operator->());
+        for (const auto &key : keys.writes) {
+          accesses[key].writers.push_back(i);
+        }
+        for (const auto &key : keys.reads) {
+          accesses[key].readers.push_back(i);
+        }
+      }
+      // readers of a key depend on each other only through its writers
+      for (const auto &key : accesses) {
+        const auto &writers = key.second.writers;
+        if (writers.empty()) {
+          continue;
+        }
+        for (auto writer : writers) {
+          unite(writers.front(), writer);
+        }
+        for (auto reader : key.second.readers) {
+          unite(writers.front(), reader);
+        }
+      }
+
+      std::vector<std::vector<size_t>> groups;
+      // index of group by its root transaction
+      std::unordered_map<size_t, size_t> group_of_root;
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        auto root = findRoot(parents, i);
+        auto group = group_of_root.emplace(root, groups.size());
+        if (group.second) {
+          groups.emplace_back();
+        }
+        groups[group.first->second].push_back(i);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
@@ -0,0 +1,67 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TRANSACTION_CONFLICTS_HPP
+#define IROHA_TRANSACTION_CONFLICTS_HPP
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    /**
+     * Keys of world state, which transaction reads or modifies, e.g.
+     * "account:admin@test"
+     */
+    struct TransactionKeys {
+      /// definitions of assets, domains and roles used by commands
+      std::unordered_set<std::string> reads;
+      /// creator and accounts, definitions, and peers changed by commands
+      std::unordered_set<std::string> writes;
+    };
+
+    /**
+     * Collect keys of world state, which transaction reads or modifies.
+     * Transactions, which do not modify keys of each other, do not affect
+     * validity of each other
+     * @param tx - transaction to analyze
+     * @return read and written keys
+     */
+    TransactionKeys transactionKeys(
+        const shared_model::interface::Transaction &tx);
+
+    /**
+     * Split transactions into groups, which do not modify keys of each
+     * other.
+     * Transactions inside a group depend on each other and have to be
+     * validated sequentially, groups may be validated independently
+     * @param transactions - transactions of proposal
+     * @return groups of indexes of transactions, each group keeps order of
+     * proposal, groups are ordered by their first transaction
+     */
+    std::vector<std::vector<size_t>> independentGroups(
+        const std::vector<shared_model::detail::PolymorphicWrapper<
+            shared_model::interface::Transaction>> &transactions);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_CONFLICTS_HPP
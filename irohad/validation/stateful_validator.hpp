@@ -16,7 +16,12 @@ limitations under the License.
 #ifndef IROHA_VALIDATION_STATEFUL_VALIDATOR_HPP
 #define IROHA_VALIDATION_STATEFUL_VALIDATOR_HPP
 
+#include <functional>
+#include <memory>
+#include <string>
+
 #include "ametsuchi/temporary_wsv.hpp"
+#include "common/result.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 
 namespace iroha {
@@ -27,6 +32,14 @@ namespace iroha {
      */
     class StatefulValidator {
      public:
+      /**
+       * Creates temporary wsv with the same state as the one passed to
+       * validation
+       */
+      using TemporaryWsvFactory = std::function<
+          expected::Result<std::unique_ptr<ametsuchi::TemporaryWsv>,
+                           std::string>()>;
+
       virtual ~StatefulValidator() = default;
 
       /**
@@ -41,6 +54,22 @@ namespace iroha {
       virtual std::shared_ptr<shared_model::interface::Proposal> validate(
           const shared_model::interface::Proposal &proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) = 0;
+
+      /**
+       * Function perform stateful validation on proposal, transactions which
+       * do not depend on each other may be validated on additional temporary
+       * wsv concurrently. Validation result is the same as of sequential one
+       * @param proposal - proposal for validation
+       * @param temporaryWsv - temporary wsv for validation
+       * @param create_wsv - factory of additional temporary wsv
+       * @return proposal with valid transactions
+       */
+      virtual std::shared_ptr<shared_model::interface::Proposal> validate(
+          const shared_model::interface::Proposal &proposal,
+          ametsuchi::TemporaryWsv &temporaryWsv,
+          const TemporaryWsvFactory &create_wsv) {
+        return validate(proposal, temporaryWsv);
+      }
     };
   }  // namespace validation
 }  // namespace iroha
@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timer/timer_wheel.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace iroha {
+  namespace timer {
+
+    const size_t TimerWheel::kDefaultSlots;
+    const std::chrono::microseconds TimerWheel::kDefaultTick{500};
+
+    std::shared_ptr<TimerWheel> TimerWheel::shared() {
+      static auto instance = std::make_shared<TimerWheel>();
+      return instance;
+    }
+
+    TimerWheel::TimerWheel(std::chrono::microseconds tick, size_t slots)
+        : tick_(tick),
+          start_(Clock::now()),
+          slots_(slots),
+          thread_(&TimerWheel::run, this) {}
+
+    uint64_t TimerWheel::ticksUntil(Clock::time_point time) const {
+      auto elapsed = std::max(time - start_, Clock::duration::zero());
+      return (elapsed + tick_ - Clock::duration(1)) / tick_;
+    }
+
+    TimerWheel::TimerId TimerWheel::schedule(std::chrono::microseconds delay,
+                                             Handler handler) {
+      auto deadline_tick = ticksUntil(Clock::now() + delay);
+      std::lock_guard<std::mutex> lock(mutex_);
+      // timer which is already due is invoked on the next tick
+      deadline_tick = std::max(deadline_tick, processed_tick_ + 1);
+      auto id = ++last_id_;
+      auto index = deadline_tick % slots_.size();
+      auto &slot = slots_[index];
+      auto it =
+          slot.insert(slot.end(), Entry{id, deadline_tick, std::move(handler)});
+      timers_.emplace(id, std::make_pair(index, it));
+      wakeup_.notify_one();
+      return id;
+    }
+
+    bool TimerWheel::cancel(TimerId id) {
+      if (id == 0) {
+        return false;
+      }
+      // captured state may schedule or cancel timers on destruction, so the
+      // handler is destroyed after the lock is released
+      Handler cancelled;
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto timer = timers_.find(id);
+      if (timer != timers_.end()) {
+        auto &slot = slots_[timer->second.first];
+        cancelled = std::move(timer->second.second->handler);
+        slot.erase(timer->second.second);
+        timers_.erase(timer);
+        return true;
+      }
+      auto due =
+          std::find_if(due_.begin(), due_.end(), [id](const auto &entry) {
+            return entry.id == id;
+          });
+      if (due != due_.end()) {
+        cancelled = std::move(due->handler);
+        due_.erase(due);
+        return true;
+      }
+      if (std::this_thread::get_id() != thread_.get_id()) {
+        finished_.wait(lock, [this, id] { return running_ != id; });
+      }
+      return false;
+    }
+
+    size_t TimerWheel::pending() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return timers_.size() + due_.size();
+    }
+
+    uint64_t TimerWheel::nextDeadlineTick() const {
+      // pending deadlines are after processed tick, and slot of a tick holds
+      // only deadlines of that tick or later revolutions, so slots are walked
+      // in tick order until the earliest deadline seen is not later than the
+      // tick of the slot
+      auto earliest = std::numeric_limits<uint64_t>::max();
+      for (size_t offset = 1; offset <= slots_.size(); ++offset) {
+        auto tick = processed_tick_ + offset;
+        for (const auto &entry : slots_[tick % slots_.size()]) {
+          earliest = std::min(earliest, entry.deadline_tick);
+        }
+        if (earliest <= tick) {
+          break;
+        }
+      }
+      return earliest;
+    }
+
+    void TimerWheel::run() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stopped_) {
+        if (timers_.empty()) {
+          wakeup_.wait(lock, [this] { return stopped_ or not timers_.empty(); });
+          continue;
+        }
+
+        auto next_tick = processed_tick_ + 1;
+        auto deadline_tick = nextDeadlineTick();
+        wakeup_.wait_until(lock, start_ + deadline_tick * tick_);
+        if (stopped_) {
+          break;
+        }
+        // number of whole ticks passed
+        uint64_t current_tick = (Clock::now() - start_) / tick_;
+        if (current_tick < deadline_tick) {
+          // woken up by schedule, cancel or spuriously
+          continue;
+        }
+
+        // catch up with all ticks passed, every slot is visited at most once
+        auto first_tick = std::max(
+            next_tick, current_tick - std::min<uint64_t>(current_tick,
+                                                         slots_.size() - 1));
+        for (auto tick = first_tick; tick <= current_tick; ++tick) {
+          auto &slot = slots_[tick % slots_.size()];
+          for (auto it = slot.begin(); it != slot.end();) {
+            if (it->deadline_tick <= current_tick) {
+              timers_.erase(it->id);
+              due_.splice(due_.end(), slot, it++);
+            } else {
+              ++it;
+            }
+          }
+        }
+        processed_tick_ = current_tick;
+
+        // due timers are popped one by one, so they can still be cancelled
+        while (not stopped_ and not due_.empty()) {
+          auto handler = std::move(due_.front().handler);
+          running_ = due_.front().id;
+          due_.pop_front();
+          lock.unlock();
+          handler();
+          // captured state may schedule or cancel timers on destruction
+          handler = nullptr;
+          lock.lock();
+          running_ = 0;
+          finished_.notify_all();
+        }
+      }
+    }
+
+    TimerWheel::~TimerWheel() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+      }
+      wakeup_.notify_one();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+  }  // namespace timer
+}  // namespace iroha
@@ -0,0 +1,141 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_TIMER_WHEEL_HPP
+#define IROHA_TIMER_WHEEL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+  namespace timer {
+
+    /**
+     * Hashed timer wheel, which invokes handlers after delay on a single
+     * dedicated thread.
+     * Timers are placed into slots by their deadline tick, so scheduling and
+     * cancellation do not depend on the number of pending timers.
+     * Handlers are invoked without lock held, and should be short, since
+     * they delay other timers. Long work should be handed off to another
+     * thread
+     */
+    class TimerWheel {
+     public:
+      using Clock = std::chrono::steady_clock;
+      using Handler = std::function<void()>;
+      /// identifier of scheduled timer, 0 is never used
+      using TimerId = uint64_t;
+
+      static const size_t kDefaultSlots = 512;
+      static const std::chrono::microseconds kDefaultTick;
+
+      /**
+       * @return timer wheel shared by all components of the process
+       */
+      static std::shared_ptr<TimerWheel> shared();
+
+      /**
+       * @param tick - precision of the timers
+       * @param slots - number of slots of the wheel
+       */
+      explicit TimerWheel(std::chrono::microseconds tick = kDefaultTick,
+                          size_t slots = kDefaultSlots);
+
+      TimerWheel(const TimerWheel &) = delete;
+      TimerWheel &operator=(const TimerWheel &) = delete;
+
+      /**
+       * Invoke handler after delay
+       * @param delay before invocation
+       * @param handler - function to invoke
+       * @return identifier of the timer
+       */
+      TimerId schedule(std::chrono::microseconds delay, Handler handler);
+
+      /**
+       * Cancel the timer if it is not invoked yet, or wait until its handler
+       * returns if it is being invoked. The wait is skipped when called from
+       * a handler. Caller must not hold locks, which the handler takes
+       * @param id of the timer
+       * @return true if timer was pending
+       */
+      bool cancel(TimerId id);
+
+      /**
+       * @return number of pending timers
+       */
+      size_t pending() const;
+
+      ~TimerWheel();
+
+     private:
+      struct Entry {
+        TimerId id;
+        uint64_t deadline_tick;
+        Handler handler;
+      };
+      using Slot = std::list<Entry>;
+
+      /**
+       * @return number of ticks passed since creation, rounded up
+       */
+      uint64_t ticksUntil(Clock::time_point time) const;
+
+      /**
+       * Find the earliest deadline of pending timers, must be called with
+       * lock held and at least one pending timer
+       * @return tick of the earliest deadline
+       */
+      uint64_t nextDeadlineTick() const;
+
+      /**
+       * Wheel thread: sleep until next tick with pending timers, and invoke
+       * handlers of expired timers
+       */
+      void run();
+
+      const std::chrono::microseconds tick_;
+      const Clock::time_point start_;
+
+      std::vector<Slot> slots_;
+      /// slot and position of every pending timer
+      std::unordered_map<TimerId, std::pair<size_t, Slot::iterator>> timers_;
+      TimerId last_id_ = 0;
+      /// expired timers, which handlers are not invoked yet
+      Slot due_;
+      /// timer, which handler is being invoked, 0 if none
+      TimerId running_ = 0;
+      /// all timers with deadline up to this tick are invoked
+      uint64_t processed_tick_ = 0;
+      bool stopped_ = false;
+
+      mutable std::mutex mutex_;
+      std::condition_variable wakeup_;
+      std::condition_variable finished_;
+      std::thread thread_;
+    };
+  }  // namespace timer
+}  // namespace iroha
+
+#endif  // IROHA_TIMER_WHEEL_HPP
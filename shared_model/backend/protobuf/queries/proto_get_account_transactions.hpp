@@ -20,6 +20,7 @@
 
 #include "interfaces/queries/get_account_transactions.hpp"
 
+#include "backend/protobuf/queries/proto_pager.hpp"
 #include "queries.pb.h"
 #include "utils/lazy_initializer.hpp"
 #include "utils/reference_holder.hpp"
@@ -45,11 +46,26 @@ namespace shared_model {
         return account_transactions_.account_id();
       }
 
+      const interface::Pager &pager() const override {
+        return *pager_;
+      }
+
+      bool hasPager() const override {
+        return account_transactions_.has_pager();
+      }
+
      private:
+      // lazy
+      template <typename T>
+      using Lazy = detail::LazyInitializer<T>;
+
       // ------------------------------| fields |-------------------------------
 
       const iroha::protocol::GetAccountTransactions &account_transactions_{
           proto_->payload().get_account_transactions()};
+
+      const Lazy<proto::Pager> pager_{
+          [this] { return proto::Pager(account_transactions_.pager()); }};
     };
 
   }  // namespace proto
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_PROTO_PAGER_HPP
+#define IROHA_PROTO_PAGER_HPP
+
+#include "interfaces/queries/pager.hpp"
+
+#include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "queries.pb.h"
+
+namespace shared_model {
+  namespace proto {
+    class Pager final
+        : public CopyableProto<interface::Pager, iroha::protocol::Pager, Pager> {
+     public:
+      template <typename PagerType>
+      explicit Pager(PagerType &&pager)
+          : CopyableProto(std::forward<PagerType>(pager)) {}
+
+      Pager(const Pager &o) : Pager(o.proto_) {}
+
+      Pager(Pager &&o) noexcept : Pager(std::move(o.proto_)) {}
+
+      interface::types::HeightType cursorHeight() const override {
+        return proto_->cursor().height();
+      }
+
+      interface::types::TxIndexType cursorIndex() const override {
+        return proto_->cursor().index();
+      }
+
+      interface::types::PageSizeType pageSize() const override {
+        return proto_->page_size();
+      }
+    };
+
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_PROTO_PAGER_HPP
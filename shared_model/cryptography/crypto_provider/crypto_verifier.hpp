@@ -18,6 +18,9 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
+#include <utility>
+#include <vector>
+
 #include "cryptography/blob.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/keypair.hpp"
@@ -46,6 +49,18 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify several signatures attached to the same source data
+       * @param signatures - pairs of signature and public key of signatory
+       * @param source - data that was signed
+       * @return validity of each signature in order of signatures
+       */
+      static std::vector<bool> verify(
+          const std::vector<std::pair<Signed, PublicKey>> &signatures,
+          const Blob &source) {
+        return Algorithm::verify(signatures, source);
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
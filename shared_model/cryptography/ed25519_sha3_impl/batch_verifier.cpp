@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cryptography/ed25519_sha3_impl/batch_verifier.hpp"
+
+#include <algorithm>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    const size_t BatchVerifier::kMinParallelBatch;
+
+    std::vector<bool> BatchVerifier::verify(const std::vector<Item> &items) {
+      // elements of vector<bool> can not be written concurrently
+      std::vector<uint8_t> valid(items.size());
+      auto verify_range = [&items, &valid](size_t begin, size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          valid[i] = iroha::verify(items[i].hash.data(),
+                                   items[i].hash.size(),
+                                   items[i].public_key,
+                                   items[i].signature);
+        }
+      };
+      if (items.size() < kMinParallelBatch) {
+        verify_range(0, items.size());
+      } else {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, items.size()),
+                          [&verify_range](const auto &range) {
+                            verify_range(range.begin(), range.end());
+                          });
+      }
+      return std::vector<bool>(valid.begin(), valid.end());
+    }
+
+    std::vector<bool> BatchVerifier::verify(
+        const std::vector<std::pair<Signed, PublicKey>> &signatures,
+        const Blob &orig) {
+      auto hash = iroha::sha3_256(toBinaryString(orig));
+      std::vector<Item> items;
+      items.reserve(signatures.size());
+      for (const auto &signature : signatures) {
+        items.push_back(
+            {hash,
+             iroha::pubkey_t::from_string(toBinaryString(signature.second)),
+             iroha::sig_t::from_string(toBinaryString(signature.first))});
+      }
+      return verify(items);
+    }
+
+    bool BatchVerifier::verifyAll(const std::vector<Item> &items) {
+      auto valid = verify(items);
+      return std::all_of(
+          valid.begin(), valid.end(), [](bool is_valid) { return is_valid; });
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,78 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_SHARED_MODEL_BATCH_VERIFIER_HPP
+#define IROHA_SHARED_MODEL_BATCH_VERIFIER_HPP
+
+#include <utility>
+#include <vector>
+
+#include "common/types.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace crypto {
+    /**
+     * Verification of many ed25519 signatures at once.
+     * Message is hashed once for all of its signatures, and signatures are
+     * verified concurrently by threads of tbb scheduler
+     */
+    class BatchVerifier {
+     public:
+      /// smaller batches are verified on the calling thread
+      static const size_t kMinParallelBatch = 4;
+
+      /**
+       * Signature of a hashed message
+       */
+      struct Item {
+        iroha::hash256_t hash;
+        iroha::pubkey_t public_key;
+        iroha::sig_t signature;
+      };
+
+      /**
+       * Verify signatures of hashed messages
+       * @param items - signatures to verify
+       * @return validity of each signature in order of items
+       */
+      static std::vector<bool> verify(const std::vector<Item> &items);
+
+      /**
+       * Verify signatures of a single message
+       * @param signatures - pairs of signature and public key of signatory
+       * @param orig - original message, which is hashed once
+       * @return validity of each signature in order of signatures
+       */
+      static std::vector<bool> verify(
+          const std::vector<std::pair<Signed, PublicKey>> &signatures,
+          const Blob &orig);
+
+      /**
+       * @return true if all signatures are valid
+       */
+      static bool verifyAll(const std::vector<Item> &items);
+
+      /// close constructor for forbidding instantiation
+      BatchVerifier() = delete;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_BATCH_VERIFIER_HPP
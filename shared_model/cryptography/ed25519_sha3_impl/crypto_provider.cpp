@@ -16,6 +16,7 @@
  */
 
 #include "cryptography/ed25519_sha3_impl/crypto_provider.hpp"
+#include "cryptography/ed25519_sha3_impl/batch_verifier.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/signer.hpp"
 #include "cryptography/ed25519_sha3_impl/verifier.hpp"
@@ -34,6 +35,12 @@ namespace shared_model {
       return Verifier::verify(signedData, orig, publicKey);
     }
 
+    std::vector<bool> CryptoProviderEd25519Sha3::verify(
+        const std::vector<std::pair<Signed, PublicKey>> &signatures,
+        const Blob &orig) {
+      return BatchVerifier::verify(signatures, orig);
+    }
+
     Seed CryptoProviderEd25519Sha3::generateSeed() {
       return Seed(iroha::create_seed().to_string());
     }
@@ -18,6 +18,9 @@
 #ifndef IROHA_CRYPTOPROVIDER_HPP
 #define IROHA_CRYPTOPROVIDER_HPP
 
+#include <utility>
+#include <vector>
+
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
@@ -47,6 +50,17 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies signatures of one message at once
+       * @param signatures - pairs of signature and public key of signatory
+       * @param orig - original message
+       * @return validity of each signature in order of signatures
+       */
+      static std::vector<bool> verify(
+          const std::vector<std::pair<Signed, PublicKey>> &signatures,
+          const Blob &orig);
+
       /**
        * Generates new seed
        * @return Seed generated
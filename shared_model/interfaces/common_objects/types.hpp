@@ -75,6 +75,10 @@ namespace shared_model {
       using DetailType = std::string;
       /// Type of JSON data
       using JsonType = std::string;
+      /// Type of transaction index in a block
+      using TxIndexType = uint32_t;
+      /// Type of page size of paginated queries
+      using PageSizeType = uint32_t;
     }  // namespace types
   }    // namespace interface
 }  // namespace shared_model
@@ -20,6 +20,7 @@
 
 #include "interfaces/base/primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/pager.hpp"
 
 #ifndef DISABLE_BACKWARD
 #include "model/queries/get_transactions.hpp"
@@ -42,12 +43,25 @@ namespace shared_model {
        * @return assetId of requested transactions
        */
       virtual const types::AccountIdType &assetId() const = 0;
+      /**
+       * @return requested page of transactions
+       */
+      virtual const Pager &pager() const = 0;
+
+      /**
+       * @return true, if the client requested a page, otherwise whole
+       * history is requested and pager() has default values
+       */
+      virtual bool hasPager() const = 0;
 
 #ifndef DISABLE_BACKWARD
       OldModelType *makeOldModel() const override {
         auto oldModel = new iroha::model::GetAccountAssetTransactions;
         oldModel->account_id = accountId();
         oldModel->asset_id = assetId();
+        oldModel->pager =
+            *std::unique_ptr<iroha::model::Pager>(pager().makeOldModel());
+        oldModel->pager.present = hasPager();
         return oldModel;
       }
 
@@ -58,11 +72,13 @@ namespace shared_model {
             .init("GetAccountAssetTransactions")
             .append("account_id", accountId())
             .append("asset_id", assetId())
+            .append("pager", pager().toString())
             .finalize();
       }
 
       bool operator==(const ModelType &rhs) const override {
-        return accountId() == rhs.accountId() and assetId() == rhs.assetId();
+        return accountId() == rhs.accountId() and assetId() == rhs.assetId()
+            and pager() == rhs.pager() and hasPager() == rhs.hasPager();
       }
     };
 
@@ -20,6 +20,7 @@
 
 #include "interfaces/base/primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/queries/pager.hpp"
 
 #ifndef DISABLE_BACKWARD
 #include "model/queries/get_transactions.hpp"
@@ -37,10 +38,24 @@ namespace shared_model {
        */
       virtual const types::AccountIdType &accountId() const = 0;
 
+      /**
+       * @return requested page of transactions
+       */
+      virtual const Pager &pager() const = 0;
+
+      /**
+       * @return true, if the client requested a page, otherwise whole
+       * history is requested and pager() has default values
+       */
+      virtual bool hasPager() const = 0;
+
 #ifndef DISABLE_BACKWARD
       virtual OldModelType *makeOldModel() const override {
         auto oldModel = new iroha::model::GetAccountTransactions;
         oldModel->account_id = accountId();
+        oldModel->pager =
+            *std::unique_ptr<iroha::model::Pager>(pager().makeOldModel());
+        oldModel->pager.present = hasPager();
         return oldModel;
       }
 
@@ -50,11 +65,13 @@ namespace shared_model {
         return detail::PrettyStringBuilder()
             .init("GetAccountTransactions")
             .append("account_id", accountId())
+            .append("pager", pager().toString())
             .finalize();
       }
 
       bool operator==(const ModelType &rhs) const override {
-        return accountId() == rhs.accountId();
+        return accountId() == rhs.accountId() and pager() == rhs.pager()
+            and hasPager() == rhs.hasPager();
       }
     };
   }  // namespace interface
@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IROHA_SHARED_MODEL_PAGER_HPP
+#define IROHA_SHARED_MODEL_PAGER_HPP
+
+#include "interfaces/base/primitive.hpp"
+#include "interfaces/common_objects/types.hpp"
+
+#ifndef DISABLE_BACKWARD
+#include "model/queries/get_transactions.hpp"
+#endif
+
+namespace shared_model {
+  namespace interface {
+    /**
+     * Page of account history, which starts right after the transaction
+     * pointed by the cursor
+     */
+    class Pager : public PRIMITIVE(Pager) {
+     public:
+      /**
+       * @return height of the block with the last transaction of the
+       * previous page
+       */
+      virtual types::HeightType cursorHeight() const = 0;
+
+      /**
+       * @return index of the last transaction of the previous page in its
+       * block
+       */
+      virtual types::TxIndexType cursorIndex() const = 0;
+
+      /**
+       * @return maximum number of transactions in the page, 0 for no limit
+       */
+      virtual types::PageSizeType pageSize() const = 0;
+
+#ifndef DISABLE_BACKWARD
+      OldModelType *makeOldModel() const override {
+        auto oldModel = new iroha::model::Pager;
+        oldModel->cursor.height = cursorHeight();
+        oldModel->cursor.index = cursorIndex();
+        oldModel->page_size = pageSize();
+        return oldModel;
+      }
+
+#endif
+
+      std::string toString() const override {
+        return detail::PrettyStringBuilder()
+            .init("Pager")
+            .append("cursor_height", std::to_string(cursorHeight()))
+            .append("cursor_index", std::to_string(cursorIndex()))
+            .append("page_size", std::to_string(pageSize()))
+            .finalize();
+      }
+
+      bool operator==(const ModelType &rhs) const override {
+        return cursorHeight() == rhs.cursorHeight()
+            and cursorIndex() == rhs.cursorIndex()
+            and pageSize() == rhs.pageSize();
+      }
+    };
+  }  // namespace interface
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_PAGER_HPP
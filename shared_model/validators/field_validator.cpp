@@ -235,11 +235,17 @@ namespace shared_model {
         ReasonsGroupType &reason,
         const interface::SignatureSetType &signatures,
         const crypto::Blob &source) const {
+      std::vector<std::pair<crypto::Signed, crypto::PublicKey>> signed_data;
       for (const auto &signature : signatures) {
-        if (not shared_model::crypto::CryptoVerifier<>::verify(
-                signature->signedData(), source, signature->publicKey())) {
+        signed_data.emplace_back(signature->signedData(),
+                                 signature->publicKey());
+      }
+      auto valid =
+          shared_model::crypto::CryptoVerifier<>::verify(signed_data, source);
+      for (size_t i = 0; i < valid.size(); ++i) {
+        if (not valid[i]) {
           auto message = (boost::format("Wrong signature with %s")
-                          % signature->publicKey().toString())
+                          % signed_data[i].second.toString())
                              .str();
           reason.second.push_back(message);
         }
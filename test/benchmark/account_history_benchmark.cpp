@@ -0,0 +1,139 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Latency of account history queries over a populated block index.
+/// Requires PostgreSQL, configured with the same IROHA_POSTGRES_*
+/// environment variables as ametsuchi tests
+
+#include <benchmark/benchmark.h>
+#include <boost/filesystem.hpp>
+#include <pqxx/pqxx>
+
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/postgres_block_index.hpp"
+#include "ametsuchi/impl/postgres_block_query.hpp"
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "backend/protobuf/from_old_model.hpp"
+#include "model/converters/pb_block_factory.hpp"
+#include "model/generators/command_generator.hpp"
+
+using namespace iroha;
+
+/// Ledger of state.range(0) blocks with kTransactions transfers each, every
+/// kAccounts-th transaction of a block is created by the queried account
+class AccountHistoryFixture : public benchmark::Fixture {
+ public:
+  static const size_t kTransactions = 100;
+  static const size_t kAccounts = 10;
+
+  void SetUp(const benchmark::State &state) override {
+    auto pg_host = std::getenv("IROHA_POSTGRES_HOST");
+    auto pg_port = std::getenv("IROHA_POSTGRES_PORT");
+    auto pg_user = std::getenv("IROHA_POSTGRES_USER");
+    auto pg_pass = std::getenv("IROHA_POSTGRES_PASSWORD");
+    if (pg_host and pg_port and pg_user and pg_pass) {
+      pgopt = std::string("host=") + pg_host + " port=" + pg_port
+          + " user=" + pg_user + " password=" + pg_pass;
+    }
+    // storage creates the schema, including block index tables
+    ametsuchi::StorageImpl::create(storage_path, pgopt).match(
+        [&](expected::Value<std::shared_ptr<ametsuchi::StorageImpl>>
+                &_storage) { storage = _storage.value; },
+        [](expected::Error<std::string> &error) {
+          throw std::runtime_error("StorageImpl: " + error.error);
+        });
+    store = std::move(*ametsuchi::FlatFile::create(block_store_path));
+    connection = std::make_unique<pqxx::lazyconnection>(pgopt);
+    transaction = std::make_unique<pqxx::nontransaction>(*connection);
+    query =
+        std::make_unique<ametsuchi::PostgresBlockQuery>(*transaction, *store);
+
+    ametsuchi::PostgresBlockIndex index(*transaction);
+    model::generators::CommandGenerator cmd_gen;
+    model::Block block;
+    for (size_t i = 0; i < kTransactions; ++i) {
+      model::Transaction tx;
+      tx.creator_account_id =
+          "user" + std::to_string(i % kAccounts) + "@test";
+      tx.commands.push_back(cmd_gen.generateTransferAsset(
+          tx.creator_account_id, "admin@test", "coin#test", Amount(i, 2)));
+      block.transactions.push_back(tx);
+    }
+    block.txs_number = block.transactions.size();
+    auto blocks = static_cast<ametsuchi::FlatFile::Identifier>(state.range(0));
+    for (ametsuchi::FlatFile::Identifier id = 1; id <= blocks; ++id) {
+      block.height = id;
+      store->add(id,
+                 stringToBytes(factory.serialize(block).SerializeAsString()));
+      index.index(shared_model::proto::from_old(block));
+    }
+  }
+
+  void TearDown(const benchmark::State &) override {
+    query.reset();
+    transaction.reset();
+    connection.reset();
+    store.reset();
+    storage->dropStorage();
+    storage.reset();
+    boost::filesystem::remove_all(block_store_path);
+  }
+
+  std::string pgopt =
+      "host=localhost port=5432 user=postgres password=mysecretpassword";
+  const std::string storage_path = "/tmp/account_history_storage";
+  const std::string block_store_path = "/tmp/account_history_benchmark";
+  std::shared_ptr<ametsuchi::StorageImpl> storage;
+  std::unique_ptr<ametsuchi::FlatFile> store;
+  std::unique_ptr<pqxx::lazyconnection> connection;
+  std::unique_ptr<pqxx::nontransaction> transaction;
+  std::unique_ptr<ametsuchi::PostgresBlockQuery> query;
+  model::converters::PbBlockFactory factory;
+};
+
+/// Whole history of an account, which has transactions in every block
+BENCHMARK_DEFINE_F(AccountHistoryFixture, AccountTransactions)
+(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    size_t count = 0;
+    query->getAccountTransactions("user0@test").subscribe([&count](auto) {
+      ++count;
+    });
+    benchmark::DoNotOptimize(count);
+  }
+}
+
+/// History of an account filtered by asset
+BENCHMARK_DEFINE_F(AccountHistoryFixture, AccountAssetTransactions)
+(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    size_t count = 0;
+    query->getAccountAssetTransactions("user0@test", "coin#test")
+        .subscribe([&count](auto) { ++count; });
+    benchmark::DoNotOptimize(count);
+  }
+}
+
+// history is read from every block, so latency is measured against ledger size
+BENCHMARK_REGISTER_F(AccountHistoryFixture, AccountTransactions)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+BENCHMARK_REGISTER_F(AccountHistoryFixture, AccountAssetTransactions)
+    ->RangeMultiplier(10)
+    ->Range(10, 1000);
+
+BENCHMARK_MAIN();
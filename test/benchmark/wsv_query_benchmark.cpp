@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Latency of world state view reads and writes, which are executed as
+/// prepared statements. Requires PostgreSQL, configured with the same
+/// IROHA_POSTGRES_* environment variables as ametsuchi tests
+
+#include <benchmark/benchmark.h>
+#include <pqxx/pqxx>
+
+#include "ametsuchi/impl/postgres_wsv_command.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/storage_impl.hpp"
+
+using namespace iroha;
+
+/// World state with a single account, which has a role with permissions
+class WsvFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State &) override {
+    auto pg_host = std::getenv("IROHA_POSTGRES_HOST");
+    auto pg_port = std::getenv("IROHA_POSTGRES_PORT");
+    auto pg_user = std::getenv("IROHA_POSTGRES_USER");
+    auto pg_pass = std::getenv("IROHA_POSTGRES_PASSWORD");
+    if (pg_host and pg_port and pg_user and pg_pass) {
+      pgopt = std::string("host=") + pg_host + " port=" + pg_port
+          + " user=" + pg_user + " password=" + pg_pass;
+    }
+    // storage creates the schema
+    ametsuchi::StorageImpl::create(storage_path, pgopt).match(
+        [&](expected::Value<std::shared_ptr<ametsuchi::StorageImpl>>
+                &_storage) { storage = _storage.value; },
+        [](expected::Error<std::string> &error) {
+          throw std::runtime_error("StorageImpl: " + error.error);
+        });
+    connection = std::make_unique<pqxx::lazyconnection>(pgopt);
+    transaction = std::make_unique<pqxx::nontransaction>(*connection);
+    command = std::make_unique<ametsuchi::PostgresWsvCommand>(*transaction);
+    query = std::make_unique<ametsuchi::PostgresWsvQuery>(*transaction);
+
+    account.account_id = "user@test";
+    account.domain_id = "test";
+    account.quorum = 1;
+    account.json_data = "{}";
+    command->insertRole("user");
+    command->insertRolePermissions("user", {"can_transfer", "can_receive"});
+    command->insertDomain(model::Domain{"test", "user"});
+    command->insertAccount(account);
+    command->insertAccountRole(account.account_id, "user");
+  }
+
+  void TearDown(const benchmark::State &) override {
+    query.reset();
+    command.reset();
+    transaction.reset();
+    connection.reset();
+    storage->dropStorage();
+    storage.reset();
+  }
+
+  std::string pgopt =
+      "host=localhost port=5432 user=postgres password=mysecretpassword";
+  const std::string storage_path = "/tmp/wsv_query_benchmark";
+  std::shared_ptr<ametsuchi::StorageImpl> storage;
+  std::unique_ptr<pqxx::lazyconnection> connection;
+  std::unique_ptr<pqxx::nontransaction> transaction;
+  std::unique_ptr<ametsuchi::PostgresWsvCommand> command;
+  std::unique_ptr<ametsuchi::PostgresWsvQuery> query;
+  model::Account account;
+};
+
+/// Reads performed by stateful validation for every transaction
+BENCHMARK_F(WsvFixture, AccountPermissions)(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    auto result = query->getAccount(account.account_id) | [&](const auto &) {
+      return query->getAccountRoles(account.account_id);
+    } | [&](const auto &roles) {
+      return query->getRolePermissions(roles.front());
+    };
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+/// Write of a single row, repeated with the same statement
+BENCHMARK_F(WsvFixture, UpdateAccount)(benchmark::State &state) {
+  while (state.KeepRunning()) {
+    ++account.quorum;
+    benchmark::DoNotOptimize(command->updateAccount(account));
+  }
+}
+
+BENCHMARK_MAIN();
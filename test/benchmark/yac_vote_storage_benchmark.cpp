@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// Throughput of vote ingestion by YAC vote storage depending on number of
+/// peers in consensus round
+
+#include <benchmark/benchmark.h>
+
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
+#include "consensus/yac/storage/yac_vote_storage.hpp"
+
+using namespace iroha::consensus::yac;
+
+/**
+ * Votes of all peers of the cluster for the same block
+ * @param peers - number of peers in round
+ */
+static std::vector<VoteMessage> makeVotes(size_t peers) {
+  std::vector<VoteMessage> votes(peers);
+  for (size_t i = 0; i < peers; ++i) {
+    votes[i].hash = YacHash("proposal", "block");
+    auto id = std::to_string(i);
+    std::copy(id.begin(), id.end(), votes[i].signature.pubkey.begin());
+  }
+  return votes;
+}
+
+/// Every peer sends its vote once, as when votes come one by one
+static void BM_VoteIngestion(benchmark::State &state) {
+  spdlog::set_level(spdlog::level::err);
+  auto peers = static_cast<size_t>(state.range(0));
+  auto votes = makeVotes(peers);
+  while (state.KeepRunning()) {
+    YacVoteStorage storage;
+    for (const auto &vote : votes) {
+      benchmark::DoNotOptimize(storage.store(vote, peers));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers);
+}
+BENCHMARK(BM_VoteIngestion)->RangeMultiplier(2)->Range(4, 256);
+
+/// Every peer sends commit with votes of all peers, so all votes except the
+/// first commit are duplicates
+static void BM_CommitIngestion(benchmark::State &state) {
+  spdlog::set_level(spdlog::level::err);
+  auto peers = static_cast<size_t>(state.range(0));
+  CommitMessage commit(makeVotes(peers));
+  while (state.KeepRunning()) {
+    YacVoteStorage storage;
+    for (size_t i = 0; i < peers; ++i) {
+      benchmark::DoNotOptimize(storage.store(commit, peers));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers * peers);
+}
+BENCHMARK(BM_CommitIngestion)->RangeMultiplier(2)->Range(4, 256);
+
+BENCHMARK_MAIN();
@@ -87,8 +87,9 @@ namespace integration_framework {
         ->getPeerCommunicationService()
         ->on_proposal()
         .subscribe([this](auto proposal) {
-          proposal_queue_.push(
-              std::make_shared<iroha::model::Proposal>(proposal));
+          // proposals are checked in old model
+          proposal_queue_.push(std::shared_ptr<iroha::model::Proposal>(
+              proposal->makeOldModel()));
           log_->info("proposal");
           queue_cond.notify_all();
         });
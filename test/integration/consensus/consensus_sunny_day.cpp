@@ -57,7 +57,6 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   std::unique_ptr<grpc::Server> server;
   std::shared_ptr<NetworkImpl> network;
   std::shared_ptr<MockYacCryptoProvider> crypto;
-  std::shared_ptr<TimerImpl> timer;
   uint64_t delay = 3 * 1000;
   std::shared_ptr<Yac> yac;
 
@@ -66,12 +65,15 @@ class ConsensusSunnyDayTest : public ::testing::Test {
   void SetUp() override {
     network = std::make_shared<NetworkImpl>();
     crypto = std::make_shared<FixedCryptoProvider>(std::to_string(my_num));
-    timer = std::make_shared<TimerImpl>();
     auto order = ClusterOrdering::create(default_peers);
     ASSERT_TRUE(order);
 
-    yac = Yac::create(
-        YacVoteStorage(), network, crypto, timer, order.value(), delay);
+    yac = Yac::create(YacVoteStorage(),
+                      network,
+                      crypto,
+                      [] { return std::make_shared<TimerImpl>(); },
+                      order.value(),
+                      delay);
     network->subscribe(yac);
 
     std::mutex mtx;
@@ -104,7 +104,9 @@ class TxPipelineIntegrationTestFixture
   std::vector<iroha::model::Block> blocks;
 
   using Commit = rxcpp::observable<iroha::model::Block>;
-  std::unique_ptr<TestSubscriber<iroha::model::Proposal>> proposal_wrapper;
+  std::unique_ptr<
+      TestSubscriber<std::shared_ptr<shared_model::interface::Proposal>>>
+      proposal_wrapper;
   std::unique_ptr<TestSubscriber<Commit>> commit_wrapper;
 
   iroha::model::Block genesis_block;
@@ -119,11 +121,15 @@ class TxPipelineIntegrationTestFixture
  private:
   void setTestSubscribers(size_t num_blocks) {
     // verify proposal
-    proposal_wrapper = std::make_unique<TestSubscriber<iroha::model::Proposal>>(
+    proposal_wrapper = std::make_unique<
+        TestSubscriber<std::shared_ptr<shared_model::interface::Proposal>>>(
         make_test_subscriber<CallExact>(
             irohad->getPeerCommunicationService()->on_proposal(), num_blocks));
-    proposal_wrapper->subscribe(
-        [this](auto proposal) { proposals.push_back(proposal); });
+    // proposals are compared in old model
+    proposal_wrapper->subscribe([this](auto proposal) {
+      proposals.push_back(
+          *std::unique_ptr<iroha::model::Proposal>(proposal->makeOldModel()));
+    });
 
     // verify commit and block
     commit_wrapper = std::make_unique<TestSubscriber<Commit>>(
@@ -178,24 +178,50 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
 );
 CREATE TABLE IF NOT EXISTS height_by_hash (
     hash bytea,
-    height text
+    height bigint
 );
 CREATE TABLE IF NOT EXISTS height_by_account_set (
     account_id text,
-    height text
+    height bigint
 );
 CREATE TABLE IF NOT EXISTS index_by_creator_height (
     id serial,
     creator_id text,
-    height text,
-    index text
+    height bigint,
+    index int
 );
 CREATE TABLE IF NOT EXISTS index_by_id_height_asset (
     id text,
-    height text,
+    height bigint,
     asset_id text,
-    index text
+    index int
 );
+DO $$
+BEGIN
+    -- migrate block index tables created with text heights and indexes
+    IF EXISTS (SELECT 1 FROM information_schema.columns
+               WHERE table_name = 'height_by_hash'
+               AND column_name = 'height' AND data_type = 'text') THEN
+        ALTER TABLE height_by_hash
+            ALTER COLUMN height TYPE bigint USING height::bigint;
+        ALTER TABLE height_by_account_set
+            ALTER COLUMN height TYPE bigint USING height::bigint;
+        ALTER TABLE index_by_creator_height
+            ALTER COLUMN height TYPE bigint USING height::bigint,
+            ALTER COLUMN index TYPE int USING index::int;
+        ALTER TABLE index_by_id_height_asset
+            ALTER COLUMN height TYPE bigint USING height::bigint,
+            ALTER COLUMN index TYPE int USING index::int;
+    END IF;
+END $$;
+CREATE INDEX IF NOT EXISTS height_by_hash_hash_index
+    ON height_by_hash (hash);
+CREATE INDEX IF NOT EXISTS height_by_account_set_account_id_height_index
+    ON height_by_account_set (account_id, height);
+CREATE INDEX IF NOT EXISTS index_by_creator_height_creator_id_height_index
+    ON index_by_creator_height (creator_id, height, index);
+CREATE INDEX IF NOT EXISTS index_by_id_height_asset_id_asset_id_height_index
+    ON index_by_id_height_asset (id, asset_id, height, index);
 )";
     };
   }  // namespace ametsuchi
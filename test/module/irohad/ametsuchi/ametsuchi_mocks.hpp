@@ -28,6 +28,7 @@
 #include "ametsuchi/temporary_factory.hpp"
 #include "ametsuchi/temporary_wsv.hpp"
 #include "ametsuchi/wsv_query.hpp"
+#include "block.pb.h"
 #include "common/result.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "model/account.hpp"
@@ -36,6 +37,7 @@
 #include "model/block.hpp"
 #include "model/domain.hpp"
 #include "model/peer.hpp"
+#include "model/queries/get_transactions.hpp"
 #include "model/transaction.hpp"
 
 namespace iroha {
@@ -129,22 +131,44 @@ namespace iroha {
       MOCK_METHOD1(
           getAccountTransactions,
           rxcpp::observable<model::Transaction>(const std::string &account_id));
+      MOCK_METHOD2(getAccountTransactions,
+                   rxcpp::observable<TransactionWithCursor>(
+                       const std::string &account_id,
+                       const model::Pager &pager));
       MOCK_METHOD1(
           getTxByHashSync,
           boost::optional<model::Transaction>(const std::string &hash));
+      MOCK_METHOD1(
+          getProtoBlockByHashSync,
+          boost::optional<protocol::Block>(const hash256_t &hash));
       MOCK_METHOD2(
           getAccountAssetTransactions,
           rxcpp::observable<model::Transaction>(const std::string &account_id,
                                                 const std::string &asset_id));
+      MOCK_METHOD3(getAccountAssetTransactions,
+                   rxcpp::observable<TransactionWithCursor>(
+                       const std::string &account_id,
+                       const std::string &asset_id,
+                       const model::Pager &pager));
       MOCK_METHOD1(getTransactions,
                    rxcpp::observable<boost::optional<model::Transaction>>(
                        const std::vector<iroha::hash256_t> &tx_hashes));
       MOCK_METHOD2(getBlocks,
                    rxcpp::observable<model::Block>(uint32_t, uint32_t));
       MOCK_METHOD1(getBlocksFrom, rxcpp::observable<model::Block>(uint32_t));
+      MOCK_METHOD1(getRawBlock, boost::optional<RawBlock>(uint32_t));
       MOCK_METHOD1(getTopBlocks, rxcpp::observable<model::Block>(uint32_t));
     };
 
+    class MockTemporaryWsv : public TemporaryWsv {
+     public:
+      MOCK_METHOD2(
+          apply,
+          bool(const shared_model::interface::Transaction &,
+               std::function<bool(const shared_model::interface::Transaction &,
+                                  WsvQuery &)>));
+    };
+
     class MockTemporaryFactory : public TemporaryFactory {
      public:
       MOCK_METHOD0(
@@ -178,12 +202,12 @@ namespace iroha {
           createMutableStorage,
           expected::Result<std::unique_ptr<MutableStorage>, std::string>(void));
 
-      void commit(std::unique_ptr<MutableStorage> mutableStorage) override {
+      bool commit(std::unique_ptr<MutableStorage> mutableStorage) override {
         // gmock workaround for non-copyable parameters
-        commit_(mutableStorage);
+        return commit_(mutableStorage);
       }
 
-      MOCK_METHOD1(commit_, void(std::unique_ptr<MutableStorage> &));
+      MOCK_METHOD1(commit_, bool(std::unique_ptr<MutableStorage> &));
     };
 
     class MockPeerQuery : public PeerQuery {
@@ -204,12 +228,12 @@ namespace iroha {
       MOCK_METHOD0(
           createMutableStorage,
           expected::Result<std::unique_ptr<MutableStorage>, std::string>(void));
-      MOCK_METHOD1(doCommit, void(MutableStorage *storage));
+      MOCK_METHOD1(doCommit, bool(MutableStorage *storage));
       MOCK_METHOD1(insertBlock, bool(model::Block block));
       MOCK_METHOD0(dropStorage, void(void));
 
-      void commit(std::unique_ptr<MutableStorage> storage) override {
-        doCommit(storage.get());
+      bool commit(std::unique_ptr<MutableStorage> storage) override {
+        return doCommit(storage.get());
       }
     };
 
@@ -868,6 +868,46 @@ TEST_F(AmetsuchiTest, FindTxByHashTest) {
   ASSERT_EQ(blocks->getTxByHashSync(tx3hash), boost::none);
 }
 
+/**
+ * @given storage with a block, which hash was not indexed on commit
+ * @when storage is created again
+ * @then block is found by its hash
+ */
+TEST_F(AmetsuchiTest, BlockHashesAreIndexedOnCreate) {
+  auto create = [this] {
+    std::shared_ptr<StorageImpl> storage;
+    StorageImpl::create(block_store_path, pgopt_)
+        .match(
+            [&](iroha::expected::Value<std::shared_ptr<StorageImpl>>
+                    &_storage) { storage = _storage.value; },
+            [](iroha::expected::Error<std::string> &error) {
+              FAIL() << "StorageImpl: " << error.error;
+            });
+    return storage;
+  };
+  auto storage = create();
+  ASSERT_TRUE(storage);
+  auto block = getBlock();
+  ASSERT_TRUE(storage->insertBlock(block));
+
+  // ledger committed before block hashes were indexed
+  pqxx::connection connection(pgopt_);
+  pqxx::work txn(connection);
+  txn.exec("DELETE FROM height_by_hash WHERE hash = "
+           + txn.quote(pqxx::binarystring(block.hash.data(), block.hash.size()))
+           + ";");
+  txn.commit();
+  ASSERT_FALSE(storage->getBlockQuery()->getProtoBlockByHashSync(block.hash));
+
+  storage = create();
+  ASSERT_TRUE(storage);
+  auto found = storage->getBlockQuery()->getProtoBlockByHashSync(block.hash);
+  ASSERT_TRUE(found);
+  ASSERT_EQ(found->payload().height(), 1);
+
+  storage->dropStorage();
+}
+
 /**
  * @given initialized storage for ordering service
  * @when save proposal height
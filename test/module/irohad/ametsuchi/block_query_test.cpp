@@ -15,12 +15,12 @@
  * limitations under the License.
  */
 
-#include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
 #include "backend/protobuf/from_old_model.hpp"
 #include "framework/test_subscriber.hpp"
+#include "model/converters/pb_common.hpp"
 #include "model/sha3_hash.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
 
@@ -85,10 +85,12 @@ class BlockQueryTest : public AmetsuchiTest {
 
     for (const auto &b : {block1, block2}) {
       file->add(b.height,
-                iroha::stringToBytes(converters::jsonToString(
-                    converters::JsonBlockFactory().serialize(b))));
+                iroha::stringToBytes(converters::PbBlockFactory()
+                                         .serialize(b)
+                                         .SerializeAsString()));
 
-      index->index(shared_model::proto::from_old(b));
+      ASSERT_TRUE(index->index(shared_model::proto::from_old(b)));
+      block_hashes.push_back(iroha::hash(b));
       blocks_total++;
     }
   }
@@ -96,6 +98,7 @@ class BlockQueryTest : public AmetsuchiTest {
   std::unique_ptr<pqxx::lazyconnection> postgres_connection;
   std::unique_ptr<pqxx::nontransaction> transaction;
   std::vector<iroha::hash256_t> tx_hashes;
+  std::vector<iroha::hash256_t> block_hashes;
   std::shared_ptr<BlockQuery> blocks;
   std::shared_ptr<BlockIndex> index;
   std::unique_ptr<FlatFile> file;
@@ -136,6 +139,52 @@ TEST_F(BlockQueryTest, GetAccountTransactionsFromSingleBlock) {
   ASSERT_TRUE(getCreator2TxWrapper.validate());
 }
 
+/**
+ * @given block store with 2 blocks totally containing 3 txs created by
+ * user1@test
+ * @when query to get the first page of 2 transactions created by user1@test
+ * is invoked
+ * @then query returns both txs of the first block with their positions
+ */
+TEST_F(BlockQueryTest, GetAccountTransactionsFirstPage) {
+  Pager pager;
+  pager.page_size = 2;
+  std::vector<TxCursor> cursors;
+  auto wrapper = make_test_subscriber<CallExact>(
+      blocks->getAccountTransactions(creator1, pager), 2);
+  wrapper.subscribe([this, &cursors](auto val) {
+    EXPECT_EQ(val.second.creator_account_id, creator1);
+    cursors.push_back(val.first);
+  });
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(1, cursors.at(0).height);
+  ASSERT_EQ(0, cursors.at(0).index);
+  ASSERT_EQ(1, cursors.at(1).height);
+  ASSERT_EQ(1, cursors.at(1).index);
+}
+
+/**
+ * @given block store with 2 blocks totally containing 3 txs created by
+ * user1@test
+ * @when query to get the page of transactions created by user1@test after
+ * the last transaction of the first block is invoked
+ * @then query returns the only tx of user1@test in the second block
+ */
+TEST_F(BlockQueryTest, GetAccountTransactionsPageAfterCursor) {
+  Pager pager;
+  pager.cursor.height = 1;
+  pager.cursor.index = 1;
+  pager.page_size = 2;
+  auto wrapper = make_test_subscriber<CallExact>(
+      blocks->getAccountTransactions(creator1, pager), 1);
+  wrapper.subscribe([this](auto val) {
+    EXPECT_EQ(val.second.creator_account_id, creator1);
+    EXPECT_EQ(2, val.first.height);
+    EXPECT_EQ(0, val.first.index);
+  });
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given block store
  * @when query to get transactions created by user with id not registered in the
@@ -245,6 +294,22 @@ TEST_F(BlockQueryTest, GetNonExistentBlock) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given block store with 2 blocks
+ * @when raw blocks are requested by height
+ * @then stored bytes are returned for existing heights only
+ */
+TEST_F(BlockQueryTest, GetRawBlock) {
+  for (uint32_t height = 1; height <= 2; ++height) {
+    auto raw = blocks->getRawBlock(height);
+    ASSERT_TRUE(raw);
+    ASSERT_EQ(std::vector<uint8_t>(raw->data, raw->data + raw->size),
+              *file->get(height));
+  }
+  ASSERT_FALSE(blocks->getRawBlock(0));
+  ASSERT_FALSE(blocks->getRawBlock(3));
+}
+
 /**
  * @given block store with 2 blocks totally containing 3 txs created by
  * user1@test AND 1 tx created by user2@test
@@ -302,20 +367,17 @@ TEST_F(BlockQueryTest, GetBlocksFrom1) {
 /**
  * @given block store with 2 blocks totally containing 3 txs created by
  * user1@test AND 1 tx created by user2@test. Block #1 is filled with trash data
- * (NOT JSON).
+ * (NOT protobuf).
  * @when read block #1
  * @then get no blocks
  */
-TEST_F(BlockQueryTest, GetBlockButItIsNotJSON) {
-  namespace fs = boost::filesystem;
+TEST_F(BlockQueryTest, GetBlockButItIsNotProtobuf) {
   size_t block_n = 1;
 
-  // write something that is NOT JSON to block #1
-  auto block_path = fs::path{block_store_path} / FlatFile::id_to_name(block_n);
-  fs::ofstream block_file(block_path);
+  // write something that is NOT protobuf to block #1
+  file->dropAll();
   std::string content = R"(this is definitely not json)";
-  block_file << content;
-  block_file.close();
+  file->add(block_n, iroha::stringToBytes(content));
 
   auto wrapper =
       make_test_subscriber<CallExact>(blocks->getBlocks(block_n, 1), 0);
@@ -326,24 +388,21 @@ TEST_F(BlockQueryTest, GetBlockButItIsNotJSON) {
 
 /**
  * @given block store with 2 blocks totally containing 3 txs created by
- * user1@test AND 1 tx created by user2@test. Block #1 is filled with trash data
- * (NOT JSON).
+ * user1@test AND 1 tx created by user2@test. Block #1 is stored in the legacy
+ * JSON format.
  * @when read block #1
  * @then get no blocks
  */
-TEST_F(BlockQueryTest, GetBlockButItIsInvalidBlock) {
-  namespace fs = boost::filesystem;
+TEST_F(BlockQueryTest, GetBlockButItIsLegacyJSON) {
   size_t block_n = 1;
 
-  // write bad block instead of block #1
-  auto block_path = fs::path{block_store_path} / FlatFile::id_to_name(block_n);
-  fs::ofstream block_file(block_path);
+  // write not migrated JSON document instead of block #1
+  file->dropAll();
   std::string content = R"({
   "testcase": [],
   "description": "make sure this is valid json, but definitely not a block"
 })";
-  block_file << content;
-  block_file.close();
+  file->add(block_n, iroha::stringToBytes(content));
 
   auto wrapper =
       make_test_subscriber<CallExact>(blocks->getBlocks(block_n, 1), 0);
@@ -368,3 +427,39 @@ TEST_F(BlockQueryTest, GetTop2Blocks) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given block store with 2 blocks
+ * @when get block by hash of the second block
+ * @then the second block is returned
+ */
+TEST_F(BlockQueryTest, GetProtoBlockByHash) {
+  auto block = blocks->getProtoBlockByHashSync(block_hashes.at(1));
+  ASSERT_TRUE(block);
+  ASSERT_EQ(block->payload().height(), 2);
+  ASSERT_EQ(iroha::hash(*block), block_hashes.at(1));
+}
+
+/**
+ * @given block store with 2 blocks
+ * @when get block by hash of a transaction
+ * @then nothing is returned
+ */
+TEST_F(BlockQueryTest, GetProtoBlockByTransactionHash) {
+  auto block = blocks->getProtoBlockByHashSync(tx_hashes.at(0));
+  ASSERT_FALSE(block);
+}
+
+/**
+ * @given block index, which table is dropped
+ * @when block is indexed
+ * @then failure is reported
+ */
+TEST_F(BlockQueryTest, IndexFailureIsReported) {
+  Block block;
+  block.height = 3;
+  block.transactions.push_back(Transaction{});
+  transaction->exec("DROP TABLE index_by_creator_height;");
+
+  ASSERT_FALSE(index->index(shared_model::proto::from_old(block)));
+}
@@ -54,8 +54,9 @@ namespace iroha {
 
       void insert(const model::Block &block) {
         file->add(block.height,
-                  iroha::stringToBytes(model::converters::jsonToString(
-                      model::converters::JsonBlockFactory().serialize(block))));
+                  iroha::stringToBytes(model::converters::PbBlockFactory()
+                                           .serialize(block)
+                                           .SerializeAsString()));
         index->index(shared_model::proto::from_old(block));
       }
 
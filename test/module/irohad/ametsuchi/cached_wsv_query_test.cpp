@@ -0,0 +1,102 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ametsuchi/impl/cached_wsv_command.hpp"
+#include "ametsuchi/impl/cached_wsv_query.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using ::testing::Return;
+using ::testing::_;
+
+class CachedWsvQueryTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto wsv = std::make_unique<MockWsvQuery>();
+    auto command = std::make_unique<MockWsvCommand>();
+    mock_wsv = wsv.get();
+    mock_command = command.get();
+    cache = std::make_shared<WsvCache>();
+    query = std::make_unique<CachedWsvQuery>(std::move(wsv), cache);
+    executor = std::make_unique<CachedWsvCommand>(std::move(command), *query);
+  }
+
+  MockWsvQuery *mock_wsv;
+  MockWsvCommand *mock_command;
+  std::shared_ptr<WsvCache> cache;
+  std::unique_ptr<CachedWsvQuery> query;
+  std::unique_ptr<CachedWsvCommand> executor;
+
+  std::string account_id = "admin@test";
+  std::vector<std::string> roles = {"admin"};
+};
+
+/**
+ * @given empty cache
+ * @when account roles are requested twice
+ * @then underlying query is called once, and second request is a cache hit
+ */
+TEST_F(CachedWsvQueryTest, RepeatedReadIsServedFromCache) {
+  EXPECT_CALL(*mock_wsv, getAccountRoles(account_id))
+      .WillOnce(Return(nonstd::make_optional(roles)));
+
+  ASSERT_EQ(roles, query->getAccountRoles(account_id));
+  ASSERT_EQ(roles, query->getAccountRoles(account_id));
+
+  auto metrics = cache->metrics();
+  ASSERT_EQ(1, metrics.hits);
+  ASSERT_EQ(1, metrics.misses);
+}
+
+/**
+ * @given cached account roles
+ * @when role is appended to account in the current transaction
+ * @then roles are read from underlying query
+ */
+TEST_F(CachedWsvQueryTest, ModifiedKeyBypassesCache) {
+  std::vector<std::string> appended = {"admin", "user"};
+  EXPECT_CALL(*mock_wsv, getAccountRoles(account_id))
+      .WillOnce(Return(nonstd::make_optional(roles)))
+      .WillOnce(Return(nonstd::make_optional(appended)));
+  EXPECT_CALL(*mock_command, insertAccountRole(account_id, "user"))
+      .WillOnce(Return(WsvCommandResult{}));
+
+  ASSERT_EQ(roles, query->getAccountRoles(account_id));
+  executor->insertAccountRole(account_id, "user");
+  ASSERT_EQ(appended, query->getAccountRoles(account_id));
+}
+
+/**
+ * @given roles, which are being loaded while cache is invalidated by commit
+ * @when roles are requested again
+ * @then value loaded before commit is not cached
+ */
+TEST_F(CachedWsvQueryTest, ValueLoadedBeforeCommitIsNotCached) {
+  EXPECT_CALL(*mock_wsv, getAccountRoles(account_id))
+      .WillOnce(::testing::InvokeWithoutArgs([this] {
+        cache->invalidate();
+        return nonstd::make_optional(roles);
+      }))
+      .WillOnce(Return(nonstd::make_optional(roles)));
+
+  query->getAccountRoles(account_id);
+  query->getAccountRoles(account_id);
+
+  ASSERT_EQ(0, cache->metrics().hits);
+}
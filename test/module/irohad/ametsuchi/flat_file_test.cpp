@@ -71,7 +71,8 @@ TEST_F(BlStore_Test, BlockStoreWhenRemoveBlock) {
         "----------| create blockstore and insert 3 elements "
         "|----------");
 
-    auto store = FlatFile::create(block_store_path);
+    // Every block is stored in its own segment
+    auto store = FlatFile::create(block_store_path, 1);
     ASSERT_TRUE(store);
     auto bl_store = std::move(*store);
 
@@ -85,7 +86,7 @@ TEST_F(BlStore_Test, BlockStoreWhenRemoveBlock) {
   }
 
   log_->info("----------| remove second and init new storage |----------");
-  std::remove((block_store_path + "/0000000000000002").c_str());
+  std::remove((block_store_path + "/0000000000000002.data").c_str());
   auto store = FlatFile::create(block_store_path);
   ASSERT_TRUE(store);
   auto bl_store = std::move(*store);
@@ -171,20 +172,20 @@ TEST_F(BlStore_Test, GetDirectory) {
 
 /**
  * @given block store with one entry
- * @when user has not enough permissions
+ * @when segment file with the entry is truncated
  * @then get() fails
  */
-TEST_F(BlStore_Test, GetDeniedBlock) {
+TEST_F(BlStore_Test, GetTruncatedBlock) {
   auto store = FlatFile::create(block_store_path);
   ASSERT_TRUE(store);
   auto bl_store = std::move(*store);
   auto id = 1u;
   bl_store->add(id, block);
 
-  auto filename =
-      boost::filesystem::path{block_store_path} / FlatFile::id_to_name(id);
+  auto filename = boost::filesystem::path{block_store_path}
+      / (FlatFile::id_to_name(id) + ".data");
 
-  boost::filesystem::remove(filename);
+  boost::filesystem::resize_file(filename, block.size() / 2);
   auto res = bl_store->get(id);
   ASSERT_FALSE(res);
 }
@@ -199,15 +200,174 @@ TEST_F(BlStore_Test, AddExistingId) {
   ASSERT_TRUE(store);
   auto bl_store = std::move(*store);
   auto id = 1u;
-  const auto file_name =
-      boost::filesystem::path{block_store_path} / FlatFile::id_to_name(id);
-  std::ofstream fout(file_name.string());
-  fout.close();
+  ASSERT_TRUE(bl_store->add(id, block));
 
   auto res = bl_store->add(id, block);
   ASSERT_FALSE(res);
 }
 
+/**
+ * @given block store with small segment size
+ * @when entries are added to several segments
+ * @then every entry is read back and segments are restored on reopening
+ */
+TEST_F(BlStore_Test, ReadFromSeveralSegments) {
+  const Identifier total = 10;
+  {
+    auto store = FlatFile::create(block_store_path, 3 * block.size());
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    for (Identifier id = 1; id <= total; ++id) {
+      ASSERT_TRUE(bl_store->add(id, std::vector<uint8_t>(block.size(), id)));
+    }
+    ASSERT_TRUE(bl_store->sync());
+  }
+
+  auto store = FlatFile::create(block_store_path, 3 * block.size());
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(bl_store->last_id(), total);
+  for (Identifier id = 1; id <= total; ++id) {
+    auto res = bl_store->get(id);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(*res, std::vector<uint8_t>(block.size(), id));
+  }
+}
+
+/**
+ * @given block store with two entries
+ * @when the last entry is partially written because of a crash
+ * @then storage is reopened with the torn entry truncated and accepts it again
+ */
+TEST_F(BlStore_Test, TornTailIsTruncated) {
+  {
+    auto store = FlatFile::create(block_store_path);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    bl_store->add(1u, block);
+    bl_store->add(2u, block);
+  }
+
+  auto filename = boost::filesystem::path{block_store_path}
+      / (FlatFile::id_to_name(1u) + ".data");
+  boost::filesystem::resize_file(
+      filename, boost::filesystem::file_size(filename) - block.size() / 2);
+
+  auto store = FlatFile::create(block_store_path);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(bl_store->last_id(), 1);
+  ASSERT_EQ(*bl_store->get(1u), block);
+  ASSERT_TRUE(bl_store->add(2u, block));
+  ASSERT_EQ(*bl_store->get(2u), block);
+}
+
+/**
+ * @given block store with entries in several segments
+ * @when it is rolled back to an entry in the middle of a segment
+ * @then later entries and segments are removed, both in storage and on
+ * reopening, and following entries are added after the kept one
+ */
+TEST_F(BlStore_Test, RollbackRemovesLaterEntries) {
+  const Identifier total = 7, kept = 4;
+  {
+    auto store = FlatFile::create(block_store_path, 3 * block.size());
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    for (Identifier id = 1; id <= total; ++id) {
+      ASSERT_TRUE(bl_store->add(id, std::vector<uint8_t>(block.size(), id)));
+    }
+
+    bl_store->rollback(kept);
+    ASSERT_EQ(bl_store->last_id(), kept);
+    ASSERT_FALSE(bl_store->get(kept + 1));
+    ASSERT_FALSE(boost::filesystem::exists(
+        boost::filesystem::path{block_store_path}
+        / (FlatFile::id_to_name(total) + ".data")));
+    ASSERT_TRUE(bl_store->add(kept + 1, block));
+    ASSERT_TRUE(bl_store->sync());
+  }
+
+  auto store = FlatFile::create(block_store_path, 3 * block.size());
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(bl_store->last_id(), kept + 1);
+  ASSERT_EQ(*bl_store->get(kept), std::vector<uint8_t>(block.size(), kept));
+  ASSERT_EQ(*bl_store->get(kept + 1), block);
+}
+
+/**
+ * @given block store with views of entries in the last segment and in the
+ * segment before it
+ * @when it is rolled back before viewed entries, and other entries are added
+ * @then views still read removed entries, while storage reads added ones,
+ * also on reopening
+ */
+TEST_F(BlStore_Test, RollbackKeepsViewsReadable) {
+  {
+    auto store = FlatFile::create(block_store_path, 3 * block.size());
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    for (Identifier id = 1; id <= 4; ++id) {
+      ASSERT_TRUE(bl_store->add(id, std::vector<uint8_t>(block.size(), id)));
+    }
+    auto removed_view = bl_store->view(3u);
+    auto removed_segment_view = bl_store->view(4u);
+    ASSERT_TRUE(removed_view);
+    ASSERT_TRUE(removed_segment_view);
+
+    bl_store->rollback(2u);
+    ASSERT_EQ(bl_store->last_id(), 2);
+    ASSERT_TRUE(bl_store->add(3u, block));
+    ASSERT_TRUE(bl_store->add(4u, block));
+    ASSERT_TRUE(bl_store->sync());
+
+    ASSERT_EQ(std::vector<uint8_t>(removed_view->data,
+                                   removed_view->data + removed_view->size),
+              std::vector<uint8_t>(block.size(), 3));
+    ASSERT_EQ(std::vector<uint8_t>(
+                  removed_segment_view->data,
+                  removed_segment_view->data + removed_segment_view->size),
+              std::vector<uint8_t>(block.size(), 4));
+    auto view = bl_store->view(3u);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(std::vector<uint8_t>(view->data, view->data + view->size),
+              block);
+  }
+
+  auto store = FlatFile::create(block_store_path, 3 * block.size());
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_EQ(bl_store->last_id(), 4);
+  ASSERT_EQ(*bl_store->get(2u), std::vector<uint8_t>(block.size(), 2));
+  ASSERT_EQ(*bl_store->get(3u), block);
+  ASSERT_EQ(*bl_store->get(4u), block);
+}
+
+/**
+ * @given block store with a view of its entry
+ * @when storage is dropped
+ * @then drop is refused while the view exists and succeeds after it is gone
+ */
+TEST_F(BlStore_Test, DropAllRefusedWhileViewed) {
+  auto store = FlatFile::create(block_store_path);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_TRUE(bl_store->add(1u, block));
+
+  {
+    auto view = bl_store->view(1u);
+    ASSERT_TRUE(view);
+    ASSERT_FALSE(bl_store->dropAll());
+    ASSERT_EQ(bl_store->last_id(), 1);
+    ASSERT_EQ(std::vector<uint8_t>(view->data, view->data + view->size),
+              block);
+  }
+
+  ASSERT_TRUE(bl_store->dropAll());
+  ASSERT_EQ(bl_store->last_id(), 0);
+}
+
 /**
  * @given empty folder
  * @when tries to create FlatFile with empty path
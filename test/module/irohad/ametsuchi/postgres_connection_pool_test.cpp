@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <pqxx/nontransaction>
+
+#include "ametsuchi/impl/postgres_connection_pool.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_fixture.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace iroha::expected;
+
+class PostgresConnectionPoolTest : public AmetsuchiTest {
+ protected:
+  void SetUp() override {
+    AmetsuchiTest::SetUp();
+    PostgresConnectionPool::create(pgopt_, 1, timeout)
+        .match(
+            [&](Value<std::shared_ptr<PostgresConnectionPool>> &created) {
+              pool = created.value;
+            },
+            [](Error<std::string> &error) {
+              FAIL() << "PostgresConnectionPool: " << error.error;
+            });
+    ASSERT_TRUE(pool);
+  }
+
+  /**
+   * Acquire connection, which is expected to be available
+   */
+  PooledConnection acquire() {
+    PooledConnection connection;
+    pool->acquire().match(
+        [&](Value<PooledConnection> &acquired) {
+          connection = std::move(acquired.value);
+        },
+        [](Error<std::string> &error) { FAIL() << error.error; });
+    return connection;
+  }
+
+  const std::chrono::milliseconds timeout{100};
+  std::shared_ptr<PostgresConnectionPool> pool;
+};
+
+/**
+ * @given pool of a single connection, which is acquired
+ * @when connection is acquired again
+ * @then acquisition fails after timeout
+ * @and succeeds after the connection is returned to the pool
+ */
+TEST_F(PostgresConnectionPoolTest, AcquireWaitsForReleasedConnection) {
+  auto connection = acquire();
+  ASSERT_TRUE(connection);
+
+  auto failed =
+      pool->acquire().match([](Value<PooledConnection> &) { return false; },
+                            [](Error<std::string> &) { return true; });
+  ASSERT_TRUE(failed);
+  ASSERT_EQ(1, pool->metrics().timeouts);
+
+  connection.reset();
+  ASSERT_TRUE(acquire());
+
+  auto metrics = pool->metrics();
+  ASSERT_EQ(2, metrics.acquired);
+  ASSERT_LE(metrics.max_wait, metrics.total_wait);
+}
+
+/**
+ * @given connection from the pool with changed session setting
+ * @when connection is returned and acquired again
+ * @then session setting is reset to default
+ */
+TEST_F(PostgresConnectionPoolTest, SessionIsResetOnRelease) {
+  std::string original;
+  {
+    auto connection = acquire();
+    pqxx::nontransaction transaction(*connection);
+    original = transaction.exec("SHOW statement_timeout;")[0][0].c_str();
+    transaction.exec("SET statement_timeout = 1234;");
+  }
+
+  auto connection = acquire();
+  pqxx::nontransaction transaction(*connection);
+  ASSERT_EQ(original,
+            transaction.exec("SHOW statement_timeout;")[0][0].c_str());
+}
@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ametsuchi/impl/wsv_overlay.hpp"
+#include "framework/result_fixture.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace iroha::model;
+using namespace framework::expected;
+using ::testing::Return;
+using ::testing::_;
+
+class WsvOverlayTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto wsv = std::make_unique<MockWsvQuery>();
+    mock_wsv = wsv.get();
+    overlay = std::make_unique<WsvOverlay>(std::move(wsv));
+
+    account.account_id = account_id;
+    account.domain_id = "test";
+    account.quorum = 1;
+    account.json_data = "{}";
+    EXPECT_CALL(*mock_wsv, getAccount(account_id))
+        .WillRepeatedly(Return(nonstd::make_optional(account)));
+  }
+
+  MockWsvQuery *mock_wsv;
+  std::unique_ptr<WsvOverlay> overlay;
+
+  std::string account_id = "admin@test";
+  Account account;
+  std::vector<std::string> roles = {"admin"};
+};
+
+/**
+ * @given overlay over world state view
+ * @when account roles are requested twice
+ * @then underlying query is called once
+ */
+TEST_F(WsvOverlayTest, RowIsLoadedOnce) {
+  EXPECT_CALL(*mock_wsv, getAccountRoles(account_id))
+      .WillOnce(Return(nonstd::make_optional(roles)));
+
+  ASSERT_EQ(roles, overlay->getAccountRoles(account_id));
+  ASSERT_EQ(roles, overlay->getAccountRoles(account_id));
+}
+
+/**
+ * @given existing account and role
+ * @when role is appended to account
+ * @then appended role is returned by the overlay
+ */
+TEST_F(WsvOverlayTest, CommandModifiesKeptRow) {
+  EXPECT_CALL(*mock_wsv, getRoles())
+      .WillOnce(Return(nonstd::make_optional(
+          std::vector<std::string>{"admin", "user"})));
+  EXPECT_CALL(*mock_wsv, getAccountRoles(account_id))
+      .WillOnce(Return(nonstd::make_optional(roles)));
+
+  ASSERT_NO_THROW(
+      checkValueCase(overlay->insertAccountRole(account_id, "user")));
+  ASSERT_EQ((std::vector<std::string>{"admin", "user"}),
+            overlay->getAccountRoles(account_id));
+}
+
+/**
+ * @given changes made after savepoint
+ * @when overlay is rolled back
+ * @then state before savepoint is returned, and changes made before
+ * savepoint are kept
+ */
+TEST_F(WsvOverlayTest, RollbackRestoresSavepoint) {
+  Account updated = account;
+  updated.quorum = 2;
+  overlay->updateAccount(updated);
+
+  overlay->savepoint();
+  updated.quorum = 3;
+  overlay->updateAccount(updated);
+  ASSERT_EQ(3, overlay->getAccount(account_id)->quorum);
+
+  overlay->rollback();
+  ASSERT_EQ(2, overlay->getAccount(account_id)->quorum);
+}
+
+/**
+ * @given existing role
+ * @when role with the same name is inserted, and account is inserted to
+ * missing domain
+ * @then both commands fail as they would in database
+ */
+TEST_F(WsvOverlayTest, ConstraintsAreChecked) {
+  EXPECT_CALL(*mock_wsv, getRoles())
+      .WillOnce(Return(nonstd::make_optional(roles)));
+  EXPECT_CALL(*mock_wsv, getAccount("user@missing"))
+      .WillOnce(Return(nonstd::nullopt));
+  EXPECT_CALL(*mock_wsv, getDomain("missing"))
+      .WillOnce(Return(nonstd::nullopt));
+
+  ASSERT_NO_THROW(checkErrorCase(overlay->insertRole("admin")));
+
+  Account user;
+  user.account_id = "user@missing";
+  user.domain_id = "missing";
+  user.quorum = 1;
+  ASSERT_NO_THROW(checkErrorCase(overlay->insertAccount(user)));
+}
+
+/**
+ * @given existing account
+ * @when detail is set by creator
+ * @then detail is returned by the overlay
+ */
+TEST_F(WsvOverlayTest, AccountDetailIsSet) {
+  ASSERT_NO_THROW(checkValueCase(
+      overlay->setAccountKV(account_id, "bob@test", "age", "24")));
+  ASSERT_EQ(std::string("24"),
+            overlay->getAccountDetail(account_id, "bob@test", "age"));
+  ASSERT_FALSE(overlay->getAccountDetail(account_id, "bob@test", "name"));
+}
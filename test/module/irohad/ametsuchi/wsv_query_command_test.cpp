@@ -17,6 +17,7 @@
 
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/wsv_overlay.hpp"
 #include "model/account.hpp"
 #include "model/domain.hpp"
 #include "model/peer.hpp"
@@ -400,6 +401,132 @@ ASSERT_NO_THROW(checkValueCase(command->deleteAccountGrantablePermission(
       EXPECT_FALSE(query->getDomain("invalid domain"));
     }
 
+    /**
+     * Overlay over the database state, which is expected to fail commands in
+     * the same cases as the database does
+     */
+    class WsvOverlayCommandTest : public WsvQueryCommandTest {
+     public:
+      void SetUp() override {
+        WsvQueryCommandTest::SetUp();
+        ASSERT_NO_THROW(checkValueCase(command->insertRole(role)));
+        ASSERT_NO_THROW(checkValueCase(command->insertDomain(domain)));
+        ASSERT_NO_THROW(checkValueCase(command->insertAccount(account)));
+        overlay = std::make_unique<WsvOverlay>(
+            std::make_unique<PostgresWsvQuery>(*wsv_transaction));
+      }
+
+      /**
+       * Apply command to the overlay, and then to the database
+       * @param apply - function, which applies command to given WsvCommand
+       * @return true if command succeeded in the database
+       */
+      template <typename Apply>
+      bool applyToBoth(Apply &&apply) {
+        auto is_value = [](const WsvCommandResult &result) {
+          return boost::get<WsvCommandResult::ValueType>(&result) != nullptr;
+        };
+        auto overlay_succeeded = is_value(apply(*overlay));
+        auto database_succeeded = is_value(apply(*command));
+        EXPECT_EQ(database_succeeded, overlay_succeeded);
+        return database_succeeded;
+      }
+
+      std::unique_ptr<WsvOverlay> overlay;
+    };
+
+    /**
+     * @given overlay over database with role, domain and account
+     * @when values longer than their character varying columns are inserted,
+     * and value of column length in multibyte characters is inserted
+     * @then overlay fails and succeeds in the same cases as database
+     */
+    TEST_F(WsvOverlayCommandTest, ColumnLengthsAreChecked) {
+      EXPECT_FALSE(applyToBoth([](WsvCommand &wsv) {
+        return wsv.insertRole(std::string(46, 'r'));
+      }));
+
+      model::Domain long_domain;
+      long_domain.domain_id = std::string(165, 'd');
+      long_domain.default_role = role;
+      EXPECT_FALSE(applyToBoth(
+          [&](WsvCommand &wsv) { return wsv.insertDomain(long_domain); }));
+
+      EXPECT_FALSE(applyToBoth([&](WsvCommand &wsv) {
+        return wsv.insertAccountRole(std::string(198, 'a'), role);
+      }));
+
+      model::Peer long_peer;
+      long_peer.pubkey.fill(1);
+      long_peer.address = std::string(22, 'a');
+      EXPECT_FALSE(applyToBoth(
+          [&](WsvCommand &wsv) { return wsv.insertPeer(long_peer); }));
+
+      // character varying limits characters, not bytes
+      model::Peer peer;
+      peer.pubkey.fill(2);
+      for (auto i = 0; i < 21; ++i) {
+        peer.address += "\u00e9";
+      }
+      EXPECT_TRUE(
+          applyToBoth([&](WsvCommand &wsv) { return wsv.insertPeer(peer); }));
+    }
+
+    /**
+     * @given overlay over database with role and domain
+     * @when account with invalid json data is inserted, and details are set
+     * to account with array data and to array of a creator
+     * @then overlay and database fail all the commands
+     */
+    TEST_F(WsvOverlayCommandTest, JsonDataIsChecked) {
+      auto invalid = account;
+      invalid.account_id = "invalid@" + domain.domain_id;
+      invalid.json_data = "{";
+      EXPECT_FALSE(applyToBoth(
+          [&](WsvCommand &wsv) { return wsv.insertAccount(invalid); }));
+
+      auto array = account;
+      array.account_id = "array@" + domain.domain_id;
+      array.json_data = R"([])";
+      ASSERT_TRUE(applyToBoth(
+          [&](WsvCommand &wsv) { return wsv.insertAccount(array); }));
+      EXPECT_FALSE(applyToBoth([&](WsvCommand &wsv) {
+        return wsv.setAccountKV(
+            array.account_id, array.account_id, "key", "value");
+      }));
+
+      auto creator_array = account;
+      creator_array.account_id = "creator_array@" + domain.domain_id;
+      creator_array.json_data = R"({"admin": []})";
+      ASSERT_TRUE(applyToBoth(
+          [&](WsvCommand &wsv) { return wsv.insertAccount(creator_array); }));
+      EXPECT_FALSE(applyToBoth([&](WsvCommand &wsv) {
+        return wsv.setAccountKV(
+            creator_array.account_id, "admin", "key", "value");
+      }));
+    }
+
+    /**
+     * @given overlay over database with account
+     * @when detail with quotes, backslash, comma and braces is set
+     * @then overlay and database store the same value
+     */
+    TEST_F(WsvOverlayCommandTest, DetailIsEscaped) {
+      std::string key = "key, {with} braces";
+      std::string value = R"("quoted" value with \ backslash)";
+      EXPECT_TRUE(applyToBoth([&](WsvCommand &wsv) {
+        return wsv.setAccountKV(
+            account.account_id, account.account_id, key, value);
+      }));
+
+      EXPECT_EQ(value,
+                query->getAccountDetail(
+                    account.account_id, account.account_id, key));
+      EXPECT_EQ(value,
+                overlay->getAccountDetail(
+                    account.account_id, account.account_id, key));
+    }
+
     // Since mocking database is not currently possible, use SetUp to create
     // invalid database
     class DatabaseInvalidTest : public WsvQueryCommandTest {
@@ -0,0 +1,132 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "consensus/yac/impl/executor_impl.hpp"
+
+using namespace iroha::consensus::yac;
+
+/**
+ * @given executor with several workers
+ * @when sequential tasks are submitted from concurrent tasks
+ * @then every task is invoked once, sequential tasks are invoked on the
+ * same thread, which is not the submitting one
+ */
+TEST(ExecutorTest, AllTasksInvokedBeforeDestruction) {
+  const size_t tasks = 1000;
+  std::atomic<size_t> concurrent{0};
+  size_t sequential = 0;
+  std::vector<std::thread::id> sequential_threads;
+  {
+    ExecutorImpl executor(4);
+    for (size_t i = 0; i < tasks; ++i) {
+      executor.runConcurrently([&] {
+        ++concurrent;
+        executor.runSequentially([&] {
+          ++sequential;
+          sequential_threads.push_back(std::this_thread::get_id());
+        });
+      });
+    }
+  }
+  ASSERT_EQ(concurrent, tasks);
+  ASSERT_EQ(sequential, tasks);
+  for (const auto &id : sequential_threads) {
+    ASSERT_EQ(id, sequential_threads.front());
+  }
+  ASSERT_NE(sequential_threads.front(), std::this_thread::get_id());
+}
+
+/**
+ * @given executor
+ * @when sequential tasks are submitted from one thread
+ * @then tasks are invoked in order of submission
+ */
+TEST(ExecutorTest, SequentialTasksInvokedInOrder) {
+  std::vector<int> order;
+  {
+    ExecutorImpl executor(2);
+    for (int i = 0; i < 100; ++i) {
+      executor.runSequentially([&order, i] { order.push_back(i); });
+    }
+  }
+  ASSERT_EQ(order.size(), 100u);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(order[i], i);
+  }
+}
+
+/**
+ * @given executor
+ * @when notifications are submitted from sequential tasks
+ * @then notifications are invoked in order of submission, on a thread other
+ * than the consensus one
+ */
+TEST(ExecutorTest, NotificationsInvokedOffConsensusThread) {
+  std::vector<int> order;
+  std::vector<std::thread::id> consensus_threads, notification_threads;
+  {
+    ExecutorImpl executor(2);
+    for (int i = 0; i < 100; ++i) {
+      executor.runSequentially([&, i] {
+        consensus_threads.push_back(std::this_thread::get_id());
+        executor.runNotification([&, i] {
+          order.push_back(i);
+          notification_threads.push_back(std::this_thread::get_id());
+        });
+      });
+    }
+  }
+  ASSERT_EQ(order.size(), 100u);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(order[i], i);
+    ASSERT_EQ(notification_threads[i], notification_threads.front());
+  }
+  ASSERT_NE(notification_threads.front(), consensus_threads.front());
+}
+
+/**
+ * @given executor
+ * @when sequential tasks submit concurrent tasks, which submit sequential
+ * and notification tasks, while executor is destroyed
+ * @then every task is invoked before destruction is finished
+ */
+TEST(ExecutorTest, TasksSubmittedDuringDestructionInvoked) {
+  const size_t tasks = 100;
+  std::atomic<size_t> concurrent{0};
+  size_t sequential = 0, notifications = 0;
+  {
+    ExecutorImpl executor(2);
+    for (size_t i = 0; i < tasks; ++i) {
+      executor.runSequentially([&] {
+        executor.runConcurrently([&] {
+          ++concurrent;
+          executor.runSequentially([&] {
+            ++sequential;
+            executor.runNotification([&] { ++notifications; });
+          });
+        });
+      });
+    }
+  }
+  ASSERT_EQ(concurrent, tasks);
+  ASSERT_EQ(sequential, tasks);
+  ASSERT_EQ(notifications, tasks);
+}
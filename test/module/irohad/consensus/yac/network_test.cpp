@@ -85,6 +85,57 @@ namespace iroha {
         std::unique_lock<std::mutex> lock(mtx);
         cv.wait_for(lock, std::chrono::milliseconds(100));
       }
+
+      /**
+       * @given initialized network with cluster of the peer
+       * @when send commit of the peer to itself
+       * @then commit is sent as certificate and handled
+       */
+      TEST_F(YacNetworkTest, CommitCertificateHandledWhenCommitSent) {
+        message.signature.pubkey = peer.pubkey;
+        message.hash.block_signature.pubkey = peer.pubkey;
+        CommitMessage commit(std::vector<VoteMessage>{message});
+        network->setCluster(*ClusterOrdering::create({peer}));
+
+        EXPECT_CALL(*notifications, on_commit(commit))
+            .Times(1)
+            .WillRepeatedly(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        network->send_commit(peer, commit);
+
+        // wait for response reader thread
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(100));
+      }
+
+      /**
+       * @given network of the peer with cluster of two peers, and sender with
+       * cluster of the peer only
+       * @when sender sends commit of the peer
+       * @then certificate is refused, and commit is handled after it is sent
+       * in full
+       */
+      TEST_F(YacNetworkTest, FullCommitSentWhenClusterDiffers) {
+        message.signature.pubkey = peer.pubkey;
+        message.hash.block_signature.pubkey = peer.pubkey;
+        CommitMessage commit(std::vector<VoteMessage>{message});
+        auto other = mk_peer("0.0.0.0:1");
+        network->setCluster(*ClusterOrdering::create({peer, other}));
+        auto sender = std::make_shared<NetworkImpl>();
+        sender->setCluster(*ClusterOrdering::create({peer}));
+
+        EXPECT_CALL(*notifications, on_commit(commit))
+            .Times(1)
+            .WillRepeatedly(
+                InvokeWithoutArgs(&cv, &std::condition_variable::notify_one));
+
+        sender->send_commit(peer, commit);
+
+        // wait for certificate and commit round-trips
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait_for(lock, std::chrono::milliseconds(500));
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -96,3 +96,15 @@ TEST_F(YacBlockStorageTest, YacBlockStorageWhenIsContains) {
   ASSERT_TRUE(storage.isContains(valid_votes.at(0)));
   ASSERT_FALSE(storage.isContains(valid_votes.at(3)));
 }
+
+/**
+ * @given storage with vote of a peer
+ * @when the same peer votes again
+ * @then second vote is not stored
+ */
+TEST_F(YacBlockStorageTest, YacBlockStorageWhenDuplicateVote) {
+  storage.insert(valid_votes.at(0));
+  storage.insert(valid_votes.at(0));
+
+  ASSERT_EQ(1, storage.getNumberOfVotes());
+}
@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "consensus/yac/transport/yac_pb_converters.hpp"
+
+using namespace iroha;
+using namespace iroha::consensus::yac;
+
+class CommitCertificateTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (auto key : {"a", "b", "c", "d"}) {
+      model::Peer peer;
+      peer.address = key;
+      peer.pubkey.fill(0);
+      peer.pubkey[0] = key[0];
+      peers.push_back(peer);
+    }
+  }
+
+  /**
+   * Vote of peer, which signs block with the same key
+   */
+  VoteMessage makeVote(const model::Peer &peer) {
+    VoteMessage vote;
+    vote.hash = hash;
+    vote.hash.block_signature.pubkey = peer.pubkey;
+    vote.hash.block_signature.signature.fill(peer.pubkey[0] + 1);
+    vote.signature.pubkey = peer.pubkey;
+    vote.signature.signature.fill(peer.pubkey[0]);
+    return vote;
+  }
+
+  YacHash hash = YacHash("proposal", "block");
+  std::vector<model::Peer> peers;
+};
+
+/**
+ * @given commit with votes of three of four peers in arbitrary order
+ * @when commit is serialized to certificate and deserialized back
+ * @then the same votes are restored in order of peers
+ */
+TEST_F(CommitCertificateTest, RestoresVotes) {
+  CommitMessage commit(
+      {makeVote(peers[3]), makeVote(peers[0]), makeVote(peers[2])});
+
+  auto certificate = PbConverters::serializeCertificate(commit, peers);
+  ASSERT_TRUE(certificate);
+  ASSERT_EQ(std::string(1, 0b1101), certificate->signers());
+
+  auto restored = PbConverters::deserializeCertificate(*certificate, peers);
+  ASSERT_TRUE(restored);
+  CommitMessage expected(
+      {makeVote(peers[0]), makeVote(peers[2]), makeVote(peers[3])});
+  ASSERT_EQ(expected, *restored);
+  for (size_t i = 0; i < restored->votes.size(); ++i) {
+    ASSERT_EQ(expected.votes[i].hash.block_signature,
+              restored->votes[i].hash.block_signature);
+  }
+}
+
+/**
+ * @given commit with vote of peer absent in cluster
+ * @when commit is serialized to certificate
+ * @then certificate is not created
+ */
+TEST_F(CommitCertificateTest, UnknownVoter) {
+  auto unknown = peers.back();
+  peers.pop_back();
+  CommitMessage commit({makeVote(peers[0]), makeVote(unknown)});
+
+  ASSERT_FALSE(PbConverters::serializeCertificate(commit, peers));
+}
+
+/**
+ * @given certificate where number of signatures does not match signers
+ * @when certificate is deserialized
+ * @then commit is not restored
+ */
+TEST_F(CommitCertificateTest, MalformedCertificate) {
+  CommitMessage commit({makeVote(peers[0]), makeVote(peers[1])});
+  auto certificate = PbConverters::serializeCertificate(commit, peers);
+  ASSERT_TRUE(certificate);
+
+  certificate->mutable_signatures()->RemoveLast();
+
+  ASSERT_FALSE(PbConverters::deserializeCertificate(*certificate, peers));
+}
+
+/**
+ * @given certificate created over cluster of four peers
+ * @when it is deserialized over cluster, where one peer is replaced
+ * @then cluster is reported as another one, and commit is not restored
+ */
+TEST_F(CommitCertificateTest, AnotherCluster) {
+  CommitMessage commit({makeVote(peers[0]), makeVote(peers[1])});
+  auto certificate = PbConverters::serializeCertificate(commit, peers);
+  ASSERT_TRUE(certificate);
+  ASSERT_TRUE(PbConverters::isSameCluster(*certificate, peers));
+
+  // bitmap of the same size addresses other peers
+  peers.back().pubkey[0] = 'e';
+
+  ASSERT_FALSE(PbConverters::isSameCluster(*certificate, peers));
+  ASSERT_FALSE(PbConverters::deserializeCertificate(*certificate, peers));
+}
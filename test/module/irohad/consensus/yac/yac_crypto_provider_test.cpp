@@ -58,6 +58,61 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify(vote));
       }
 
+      /**
+       * @given vote, verified by crypto provider
+       * @when the vote is verified again alone and inside of commit
+       * @then both verifications are cache hits
+       */
+      TEST_F(YacCryptoProviderTest, VerifiedVoteIsCached) {
+        YacHash hash("1", "1");
+        auto vote = crypto_provider->getVote(hash);
+
+        ASSERT_TRUE(crypto_provider->verify(vote));
+        ASSERT_TRUE(crypto_provider->verify(vote));
+        ASSERT_TRUE(crypto_provider->verify(CommitMessage({vote})));
+
+        auto metrics = crypto_provider->metrics();
+        ASSERT_EQ(2, metrics.hits);
+        ASSERT_EQ(1, metrics.misses);
+      }
+
+      /**
+       * @given vote with invalid signature
+       * @when the vote is verified twice
+       * @then both verifications fail and miss cache
+       */
+      TEST_F(YacCryptoProviderTest, InvalidVoteIsNotCached) {
+        YacHash hash("1", "1");
+        auto vote = crypto_provider->getVote(hash);
+        vote.hash.block_hash = "hash changed";
+
+        ASSERT_FALSE(crypto_provider->verify(vote));
+        ASSERT_FALSE(crypto_provider->verify(CommitMessage({vote})));
+
+        auto metrics = crypto_provider->metrics();
+        ASSERT_EQ(0, metrics.hits);
+        ASSERT_EQ(2, metrics.misses);
+      }
+
+      /**
+       * @given crypto provider with cache of a single vote
+       * @when two votes are verified, then the first one again
+       * @then the first vote is evicted and verified again
+       */
+      TEST_F(YacCryptoProviderTest, LeastRecentlyUsedVoteIsEvicted) {
+        crypto_provider = std::make_shared<CryptoProviderImpl>(keypair, 1);
+        auto first = crypto_provider->getVote(YacHash("1", "1"));
+        auto second = crypto_provider->getVote(YacHash("2", "2"));
+
+        ASSERT_TRUE(crypto_provider->verify(first));
+        ASSERT_TRUE(crypto_provider->verify(second));
+        ASSERT_TRUE(crypto_provider->verify(first));
+
+        auto metrics = crypto_provider->metrics();
+        ASSERT_EQ(0, metrics.hits);
+        ASSERT_EQ(3, metrics.misses);
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -195,3 +195,55 @@ TEST_F(YacGateTest, LoadBlockWhenDifferentCommit) {
 
   ASSERT_TRUE(gate_wrapper.validate());
 }
+
+/**
+ * @given yac gate, which voted for blocks of two consecutive rounds
+ * @when block of the first round is committed after the vote for the second
+ * one, and then the second block is committed
+ * @then both committed blocks are taken from the voted ones, and none is
+ * loaded from other peers
+ */
+TEST_F(YacGateTest, CommitPreviousBlockAfterNextVote) {
+  auto next_block = expected_block;
+  next_block.height = expected_block.height + 1;
+  auto next_hash = YacHash("next_proposal", "next_block");
+  next_hash.block_signature = next_block.sigs.front();
+
+  auto next_message = message;
+  next_message.hash = next_hash;
+
+  // make blocks of both rounds before any commit
+  EXPECT_CALL(*block_creator, on_block())
+      .WillOnce(Return(rxcpp::observable<>::from(expected_block, next_block)));
+
+  // make hash from block
+  EXPECT_CALL(*hash_provider, makeHash(_))
+      .WillOnce(Return(expected_hash))
+      .WillOnce(Return(next_hash));
+
+  // generate order of peers
+  EXPECT_CALL(*peer_orderer, getOrdering(_))
+      .WillRepeatedly(Return(ClusterOrdering::create({mk_peer("fake_node")})));
+
+  EXPECT_CALL(*hash_gate, vote(expected_hash, _)).Times(1);
+  EXPECT_CALL(*hash_gate, vote(next_hash, _)).Times(1);
+
+  // yac consensus commits rounds in order
+  EXPECT_CALL(*hash_gate, on_commit())
+      .WillOnce(Return(rxcpp::observable<>::from(
+          commit_message, CommitMessage({next_message}))));
+
+  EXPECT_CALL(*block_loader, retrieveBlock(_, _)).Times(0);
+
+  init();
+
+  // verify that yac gate emits both voted blocks in order of commits
+  auto gate_wrapper = make_test_subscriber<CallExact>(gate->on_commit(), 2);
+  std::vector<uint64_t> heights;
+  gate_wrapper.subscribe(
+      [&heights](auto block) { heights.push_back(block.height); });
+
+  ASSERT_TRUE(gate_wrapper.validate());
+  ASSERT_EQ((std::vector<uint64_t>{expected_block.height, next_block.height}),
+            heights);
+}
@@ -22,6 +22,7 @@
 
 #include "common/byteutils.hpp"
 #include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/executor.hpp"
 #include "consensus/yac/messages.hpp"
 #include "consensus/yac/timer.hpp"
 #include "consensus/yac/yac.hpp"
@@ -89,6 +90,34 @@ namespace iroha {
         }
       };
 
+      /**
+       * Timer, which keeps its handler pending, so the round stays open
+       */
+      class MockPendingTimer : public Timer {
+       public:
+        MOCK_METHOD2(invokeAfterDelay, void(uint64_t, std::function<void()>));
+        MOCK_METHOD0(deny, void());
+      };
+
+      /**
+       * Executor, which runs tasks in the calling thread, so yac handles
+       * messages synchronously
+       */
+      class InlineExecutor : public Executor {
+       public:
+        void runConcurrently(std::function<void()> task) override {
+          task();
+        }
+
+        void runSequentially(std::function<void()> task) override {
+          task();
+        }
+
+        void runNotification(std::function<void()> task) override {
+          task();
+        }
+      };
+
       class MockYacNetwork : public YacNetwork {
        public:
         void subscribe(
@@ -100,6 +129,7 @@ namespace iroha {
           notification.reset();
         }
 
+        MOCK_METHOD1(setCluster, void(const ClusterOrdering &));
         MOCK_METHOD2(send_commit, void(model::Peer, CommitMessage));
         MOCK_METHOD2(send_reject, void(model::Peer, RejectMessage));
         MOCK_METHOD2(send_vote, void(model::Peer, VoteMessage));
@@ -192,6 +222,8 @@ namespace iroha {
         std::shared_ptr<MockYacNetwork> network;
         std::shared_ptr<MockYacCryptoProvider> crypto;
         std::shared_ptr<MockTimer> timer;
+        /// every round of yac under test shares the same mock timer
+        TimerFactory timer_factory = [this] { return timer; };
         uint64_t delay = 100500;
         std::shared_ptr<Yac> yac;
 
@@ -213,14 +245,20 @@ namespace iroha {
           yac = Yac::create(YacVoteStorage(),
                             network,
                             crypto,
-                            timer,
+                            timer_factory,
                             ordering.value(),
-                            delay);
+                            delay,
+                            std::make_unique<InlineExecutor>());
           network->subscribe(yac);
         };
 
         void TearDown() override {
+          // yac denies timers of open rounds on destruction, which is not a
+          // part of the test case
+          ::testing::Mock::VerifyAndClearExpectations(timer.get());
+          EXPECT_CALL(*timer, deny()).Times(::testing::AnyNumber());
           network->release();
+          yac.reset();
         };
       };
     }  // namespace yac
@@ -0,0 +1,113 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <queue>
+#include <unordered_map>
+
+#include "consensus/yac/yac_propagation_strategy.hpp"
+
+using namespace iroha;
+using namespace iroha::consensus::yac;
+
+/**
+ * @return cluster of given number of peers with distinct keys
+ */
+static ClusterOrdering makeCluster(size_t size) {
+  std::vector<model::Peer> peers;
+  for (size_t i = 0; i < size; ++i) {
+    model::Peer peer;
+    peer.address = std::to_string(i);
+    peer.pubkey.fill(0);
+    peer.pubkey[0] = i / 256;
+    peer.pubkey[1] = i % 256;
+    peers.push_back(peer);
+  }
+  // ordering of round differs from ordering by key
+  std::reverse(peers.begin(), peers.end());
+  return *ClusterOrdering::create(peers);
+}
+
+/**
+ * @given cluster ordering
+ * @when broadcast propagation is used
+ * @then collected message is sent to all peers and is not relayed
+ */
+TEST(PropagationStrategyTest, BroadcastSendsToAll) {
+  auto cluster = makeCluster(7);
+  BroadcastPropagation propagation;
+
+  ASSERT_EQ(cluster.getPeers(), propagation.originTargets(cluster));
+  ASSERT_TRUE(propagation.relayTargets(cluster).empty());
+}
+
+/**
+ * @given cluster of 16 peers
+ * @when gossip propagation with fanout 3 is used by a peer
+ * @then message is sent to peers at distances 1, 2 and 4 by key
+ */
+TEST(PropagationStrategyTest, GossipFanoutIsBounded) {
+  auto cluster = makeCluster(16);
+  auto peers = cluster.getPeers();
+  auto self = std::find_if(peers.begin(), peers.end(), [](const auto &peer) {
+    return peer.address == "14";
+  });
+  GossipPropagation propagation(self->pubkey, 3);
+
+  auto targets = propagation.originTargets(cluster);
+
+  ASSERT_EQ(3, targets.size());
+  ASSERT_EQ("15", targets[0].address);
+  ASSERT_EQ("0", targets[1].address);
+  ASSERT_EQ("2", targets[2].address);
+}
+
+/**
+ * @given cluster of 100 peers, each using gossip propagation with fanout
+ * log2(100)
+ * @when one peer sends message and every peer relays it on first receipt
+ * @then all peers receive message in at most log2(100) hops
+ */
+TEST(PropagationStrategyTest, GossipReachesClusterInLogarithmicHops) {
+  const size_t size = 100;
+  const size_t hops = std::ceil(std::log2(size));
+  auto cluster = makeCluster(size);
+
+  std::unordered_map<std::string, size_t> received;
+  std::queue<model::Peer> pending;
+  auto origin = cluster.getPeers().front();
+  received[origin.address] = 0;
+  pending.push(origin);
+  while (not pending.empty()) {
+    auto peer = pending.front();
+    pending.pop();
+    auto targets = GossipPropagation(peer.pubkey, hops).relayTargets(cluster);
+    ASSERT_LE(targets.size(), hops);
+    for (const auto &target : targets) {
+      if (received.count(target.address) == 0) {
+        received[target.address] = received[peer.address] + 1;
+        pending.push(target);
+      }
+    }
+  }
+
+  ASSERT_EQ(size, received.size());
+  for (const auto &peer : received) {
+    ASSERT_LE(peer.second, hops) << "peer " << peer.first;
+  }
+}
@@ -45,14 +45,19 @@ TEST_F(YacTest, InvalidCaseWhenNotReceiveSupermajority) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_commit(_, _)).Times(0);
   EXPECT_CALL(*network, send_reject(_, _)).Times(my_peers.size());
   EXPECT_CALL(*network, send_vote(_, _)).Times(my_peers.size());
 
-  EXPECT_CALL(*timer, deny()).Times(0);
+  EXPECT_CALL(*timer, deny()).Times(1);
 
   EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
@@ -88,8 +93,13 @@ TEST_F(YacTest, InvalidCaseWhenDoesNotVerify) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
 
@@ -132,8 +142,13 @@ TEST_F(YacTest, ValidCaseWhenReceiveOnVoteAfterReject) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_commit(_, _)).Times(0);
   EXPECT_CALL(*network, send_reject(_, _))
@@ -142,7 +157,7 @@ TEST_F(YacTest, ValidCaseWhenReceiveOnVoteAfterReject) {
                                     // after reject happened
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*timer, deny()).Times(1);
+  EXPECT_CALL(*timer, deny()).Times(0);
 
   EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).WillOnce(Return(true));
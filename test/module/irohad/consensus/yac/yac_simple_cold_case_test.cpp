@@ -32,7 +32,6 @@
 
 using ::testing::_;
 using ::testing::An;
-using ::testing::AtLeast;
 using ::testing::Return;
 
 using namespace iroha::consensus::yac;
@@ -59,7 +58,9 @@ TEST_F(YacTest, YacWhenInit) {
   auto yac_ = Yac::create(YacVoteStorage(),
                           std::make_shared<MockYacNetwork>(network_),
                           std::make_shared<MockYacCryptoProvider>(crypto_),
-                          std::make_shared<MockTimer>(timer_),
+                          [&timer_] {
+                            return std::make_shared<MockTimer>(timer_);
+                          },
                           order.value(),
                           fake_delay_);
 
@@ -165,7 +166,7 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveCommitMessage) {
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<VoteMessage>())).Times(0);
 
-  EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
+  EXPECT_CALL(*timer, deny()).Times(0);
 
   auto committed_peer = default_peers.at(0);
   auto msg = CommitMessage(std::vector<VoteMessage>{});
@@ -176,4 +177,58 @@ TEST_F(YacTest, YacWhenColdStartAndAchieveCommitMessage) {
 
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given yac with stored vote of a peer
+ * @when commit with this vote and vote of another peer is received
+ * @then only vote of another peer is verified
+ */
+TEST_F(YacTest, YacWhenCommitContainsKnownVote) {
+  YacHash received_hash("my_proposal", "my_block");
+  auto known_vote = create_vote(received_hash, "1");
+  auto new_vote = create_vote(received_hash, "2");
+
+  EXPECT_CALL(*crypto, verify(An<VoteMessage>())).WillOnce(Return(true));
+  EXPECT_CALL(*crypto,
+              verify(CommitMessage(std::vector<VoteMessage>{new_vote})))
+      .WillOnce(Return(true));
+
+  network->notification->on_vote(known_vote);
+  network->notification->on_commit(
+      CommitMessage(std::vector<VoteMessage>{known_vote, new_vote}));
+}
+
+/**
+ * @given yac, which gossips commits with fanout 2
+ * @when the same commit is received twice
+ * @then commit is relayed to 2 peers only once
+ */
+TEST_F(YacTest, YacWhenGossipRelaysCommitOnce) {
+  auto order = ClusterOrdering::create(default_peers);
+  ASSERT_TRUE(order.has_value());
+  yac = Yac::create(
+      YacVoteStorage(),
+      network,
+      crypto,
+      timer_factory,
+      order.value(),
+      delay,
+      std::make_unique<InlineExecutor>(),
+      std::make_shared<GossipPropagation>(default_peers.at(0).pubkey, 2));
+  network->subscribe(yac);
+
+  EXPECT_CALL(*network, send_commit(_, _)).Times(2);
+  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*timer, deny()).Times(0);
+
+  YacHash propagated_hash("my_proposal", "my_block");
+  auto msg = CommitMessage(std::vector<VoteMessage>{});
+  for (const auto &peer : default_peers) {
+    msg.votes.push_back(create_vote(propagated_hash, peer.address));
+  }
+  network->notification->on_commit(msg);
+  network->notification->on_commit(msg);
+}
+
 #endif  // IROHA_YAC_SIMPLE_CASE_TEST_HPP
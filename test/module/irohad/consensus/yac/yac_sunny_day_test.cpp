@@ -45,14 +45,19 @@ TEST_F(YacTest, ValidCaseWhenReceiveSupermajority) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_commit(_, _)).Times(my_peers.size());
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(my_peers.size());
 
-  EXPECT_CALL(*timer, deny()).Times(0);
+  EXPECT_CALL(*timer, deny()).Times(1);
 
   EXPECT_CALL(*crypto, verify(An<CommitMessage>())).Times(0);
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
@@ -78,8 +83,13 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommit) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   YacHash my_hash("proposal_hash", "block_hash");
   auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
@@ -119,10 +129,15 @@ TEST_F(YacTest, ValidCaseWhenReceiveCommitTwice) {
   // delay preference
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
-  EXPECT_CALL(*timer, deny()).Times(2);
+  EXPECT_CALL(*timer, deny()).Times(1);
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   YacHash my_hash("proposal_hash", "block_hash");
   auto wrapper = make_test_subscriber<CallExact>(yac->on_commit(), 1);
@@ -168,8 +183,13 @@ TEST_F(YacTest, ValidCaseWhenSoloConsensus) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_commit(_, _)).Times(my_peers.size());
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
@@ -216,14 +236,19 @@ TEST_F(YacTest, ValidCaseWhenVoteAfterCommit) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_commit(_, _)).Times(0);
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
+  EXPECT_CALL(*timer, deny()).Times(0);
 
   EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
       .Times(1)
@@ -242,3 +267,56 @@ TEST_F(YacTest, ValidCaseWhenVoteAfterCommit) {
 
   yac->vote(my_hash, my_order.value());
 }
+
+/**
+ * @given yac, which voted for proposals of two consecutive rounds
+ * @when commit of the first round is received after the second vote
+ * @then only the timer of the first round is stopped, and the second round
+ * keeps retrying until yac is destroyed
+ */
+TEST_F(YacTest, ValidCaseWhenPreviousRoundCommitsAfterNextVote) {
+  auto my_peers = std::vector<iroha::model::Peer>(
+      {default_peers.begin(), default_peers.begin() + 4});
+  auto my_order = ClusterOrdering::create(my_peers);
+  ASSERT_TRUE(my_order.has_value());
+
+  auto previous_timer = std::make_shared<MockPendingTimer>();
+  auto next_timer = std::make_shared<MockPendingTimer>();
+  std::vector<std::shared_ptr<MockPendingTimer>> timers{previous_timer,
+                                                        next_timer};
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    [timers]() mutable -> std::shared_ptr<Timer> {
+                      auto timer = timers.front();
+                      timers.erase(timers.begin());
+                      return timer;
+                    },
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
+
+  EXPECT_CALL(*network, send_vote(_, _)).Times(2);
+  EXPECT_CALL(*previous_timer, invokeAfterDelay(delay, _)).Times(1);
+  EXPECT_CALL(*next_timer, invokeAfterDelay(delay, _)).Times(1);
+  EXPECT_CALL(*previous_timer, deny()).Times(1);
+  EXPECT_CALL(*next_timer, deny()).Times(0);
+
+  EXPECT_CALL(*crypto, verify(An<CommitMessage>()))
+      .WillRepeatedly(Return(true));
+
+  YacHash previous_hash("previous_proposal", "previous_block");
+  YacHash next_hash("next_proposal", "next_block");
+  yac->vote(previous_hash, my_order.value());
+  yac->vote(next_hash, my_order.value());
+
+  std::vector<VoteMessage> votes;
+  for (auto i = 0; i < 3; ++i) {
+    votes.push_back(create_vote(previous_hash, std::to_string(i)));
+  };
+  yac->on_commit(CommitMessage(votes));
+
+  ASSERT_TRUE(::testing::Mock::VerifyAndClearExpectations(next_timer.get()));
+  EXPECT_CALL(*next_timer, deny()).Times(AtLeast(1));
+  yac.reset();
+}
@@ -21,7 +21,6 @@
 
 using ::testing::_;
 using ::testing::An;
-using ::testing::AtLeast;
 using ::testing::Return;
 
 using namespace iroha::consensus::yac;
@@ -76,14 +75,19 @@ TEST_F(YacTest, UnknownVoteAfterCommit) {
   uint64_t wait_seconds = 10;
   delay = wait_seconds * 1000;
 
-  yac = Yac::create(
-      YacVoteStorage(), network, crypto, timer, my_order.value(), delay);
+  yac = Yac::create(YacVoteStorage(),
+                    network,
+                    crypto,
+                    timer_factory,
+                    my_order.value(),
+                    delay,
+                    std::make_unique<InlineExecutor>());
 
   EXPECT_CALL(*network, send_commit(_, _)).Times(0);
   EXPECT_CALL(*network, send_reject(_, _)).Times(0);
   EXPECT_CALL(*network, send_vote(_, _)).Times(0);
 
-  EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
+  EXPECT_CALL(*timer, deny()).Times(0);
 
   EXPECT_CALL(*crypto, verify(An<CommitMessage>())).WillOnce(Return(true));
   EXPECT_CALL(*crypto, verify(An<RejectMessage>())).Times(0);
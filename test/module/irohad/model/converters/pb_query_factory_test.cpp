@@ -113,6 +113,47 @@ TEST(PbQueryFactoryTest, SerializeGetAccountTransactions) {
   ASSERT_EQ(iroha::hash(*res_query.value()), iroha::hash(*query));
 }
 
+/**
+ * @given account transactions query without pager
+ * @when query is serialized
+ * @then proto query has no pager, so hash of query of the client is kept
+ */
+TEST(PbQueryFactoryTest, SerializeGetAccountTransactionsWithoutPager) {
+  PbQueryFactory query_factory;
+  auto query =
+      QueryGenerator{}.generateGetAccountTransactions(0, "123", 0, "test");
+  auto pb_query = query_factory.serialize(query);
+  ASSERT_TRUE(pb_query);
+  ASSERT_FALSE(pb_query->payload().get_account_transactions().has_pager());
+
+  auto res_query = query_factory.deserialize(*pb_query);
+  ASSERT_TRUE(res_query);
+  ASSERT_FALSE(std::static_pointer_cast<GetAccountTransactions>(*res_query)
+                   ->pager.present);
+}
+
+/**
+ * @given account asset transactions query with zero pager sent by client
+ * @when query is serialized and deserialized
+ * @then pager is kept, so hash of query is the same
+ */
+TEST(PbQueryFactoryTest, SerializeGetAccountAssetTransactionsWithPager) {
+  PbQueryFactory query_factory;
+  auto query = QueryGenerator{}.generateGetAccountAssetTransactions(
+      0, "123", 0, "test", "coin#test");
+  query->pager.present = true;
+  auto pb_query = query_factory.serialize(query);
+  ASSERT_TRUE(pb_query);
+  ASSERT_TRUE(pb_query->payload().get_account_asset_transactions().has_pager());
+
+  auto res_query = query_factory.deserialize(*pb_query);
+  ASSERT_TRUE(res_query);
+  ASSERT_EQ(iroha::hash(*res_query.value()), iroha::hash(*query));
+  ASSERT_NE(iroha::hash(*res_query.value()),
+            iroha::hash(*QueryGenerator{}.generateGetAccountAssetTransactions(
+                0, "123", 0, "test", "coin#test")));
+}
+
 TEST(PbQueryFactoryTest, SerializeGetTransactions) {
   iroha::hash256_t hash1, hash2;
   hash1[0] = 1;
@@ -43,6 +43,7 @@ using namespace iroha::model;
 using namespace framework::test_subscriber;
 using namespace shared_model::crypto;
 
+using testing::_;
 using testing::A;
 using testing::Return;
 
@@ -61,8 +62,9 @@ class BlockLoaderTest : public testing::Test {
     int port = 0;
     builder.AddListeningPort(
         "0.0.0.0:0", grpc::InsecureServerCredentials(), &port);
-    builder.RegisterService(service.get());
+    service->registerIn(builder);
     server = builder.BuildAndStart();
+    service->start();
 
     Peer peer;
     peer.address = "0.0.0.0:" + std::to_string(port);
@@ -74,6 +76,23 @@ class BlockLoaderTest : public testing::Test {
     ASSERT_NE(port, 0);
   }
 
+  /**
+   * Make storage return given serialized blocks starting with given height
+   */
+  void storeBlocks(uint64_t height,
+                   const std::vector<iroha::protocol::Block> &blocks) {
+    EXPECT_CALL(*storage, getRawBlock(_))
+        .WillRepeatedly(Return(boost::none));
+    for (const auto &block : blocks) {
+      auto bytes = std::make_shared<std::string>(block.SerializeAsString());
+      EXPECT_CALL(*storage, getRawBlock(height++))
+          .WillRepeatedly(Return(RawBlock{
+              reinterpret_cast<const uint8_t *>(bytes->data()),
+              bytes->size(),
+              bytes}));
+    }
+  }
+
   auto getBaseBlockBuilder() const {
     constexpr auto kTotal = (1 << 5) - 1;
     return shared_model::proto::TemplateBlockBuilder<
@@ -119,8 +138,7 @@ TEST_F(BlockLoaderTest, ValidWhenSameTopBlock) {
       .WillOnce(Return(std::vector<wPeer>{w_peer}));
   EXPECT_CALL(*storage, getTopBlocks(1))
       .WillOnce(Return(rxcpp::observable<>::just(*old_block)));
-  EXPECT_CALL(*storage, getBlocksFrom(block.height() + 1))
-      .WillOnce(Return(rxcpp::observable<>::empty<Block>()));
+  storeBlocks(block.height() + 1, {});
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(peer_key), 0);
   wrapper.subscribe();
@@ -139,7 +157,6 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
   std::unique_ptr<iroha::model::Block> old_block(block.makeOldModel());
 
   auto top_block = getBaseBlockBuilder().height(block.height() + 1).build();
-  std::unique_ptr<iroha::model::Block> old_top_block(top_block.makeOldModel());
 
   EXPECT_CALL(*provider, verify(A<const Block &>())).WillOnce(Return(true));
 
@@ -155,8 +172,7 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
       .WillOnce(Return(std::vector<wPeer>{w_peer}));
   EXPECT_CALL(*storage, getTopBlocks(1))
       .WillOnce(Return(rxcpp::observable<>::just(*old_block)));
-  EXPECT_CALL(*storage, getBlocksFrom(block.height() + 1))
-      .WillOnce(Return(rxcpp::observable<>::just(*old_top_block)));
+  storeBlocks(block.height() + 1, {top_block.getTransport()});
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(peer_key), 1);
   wrapper.subscribe(
@@ -178,11 +194,10 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
   auto num_blocks = 2;
   auto next_height = block.height() + 1;
 
-  std::vector<iroha::model::Block> blocks;
+  std::vector<iroha::protocol::Block> blocks;
   for (auto i = next_height; i < next_height + num_blocks; ++i) {
     auto blk = getBaseBlockBuilder().height(i).build();
-    std::unique_ptr<iroha::model::Block> old(blk.makeOldModel());
-    blocks.push_back(*old);
+    blocks.push_back(blk.getTransport());
   }
 
   EXPECT_CALL(*provider, verify(A<const Block &>()))
@@ -201,8 +216,7 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
       .WillOnce(Return(std::vector<wPeer>{w_peer}));
   EXPECT_CALL(*storage, getTopBlocks(1))
       .WillOnce(Return(rxcpp::observable<>::just(*old_block)));
-  EXPECT_CALL(*storage, getBlocksFrom(next_height))
-      .WillOnce(Return(rxcpp::observable<>::iterate(blocks)));
+  storeBlocks(next_height, blocks);
   auto wrapper = make_test_subscriber<CallExact>(
       loader->retrieveBlocks(peer_key), num_blocks);
   auto height = next_height;
@@ -220,7 +234,6 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
 TEST_F(BlockLoaderTest, ValidWhenBlockPresent) {
   // Request existing block => success
   auto requested = getBaseBlockBuilder().build();
-  std::unique_ptr<iroha::model::Block> old_requested(requested.makeOldModel());
 
   EXPECT_CALL(*provider, verify(A<const Block &>())).WillOnce(Return(true));
 
@@ -234,8 +247,8 @@ TEST_F(BlockLoaderTest, ValidWhenBlockPresent) {
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{w_peer}));
-  EXPECT_CALL(*storage, getBlocksFrom(1))
-      .WillOnce(Return(rxcpp::observable<>::just(*old_requested)));
+  EXPECT_CALL(*storage, getProtoBlockByHashSync(_))
+      .WillOnce(Return(requested.getTransport()));
   auto block = loader->retrieveBlock(peer_key, requested.hash());
 
   ASSERT_TRUE(block.has_value());
@@ -249,8 +262,6 @@ TEST_F(BlockLoaderTest, ValidWhenBlockPresent) {
  */
 TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
   // Request nonexisting block => failure
-  auto present = getBaseBlockBuilder().build();
-  std::unique_ptr<iroha::model::Block> old_present(present.makeOldModel());
 
   auto peer = peers.back();
   auto key = shared_model::crypto::PublicKey(peer.pubkey.to_string());
@@ -262,8 +273,8 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{w_peer}));
-  EXPECT_CALL(*storage, getBlocksFrom(1))
-      .WillOnce(Return(rxcpp::observable<>::just(*old_present)));
+  EXPECT_CALL(*storage, getProtoBlockByHashSync(_))
+      .WillOnce(Return(boost::none));
   auto block = loader->retrieveBlock(peer_key, Hash(std::string(32, '0')));
 
   ASSERT_FALSE(block.has_value());
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "network/impl/grpc_channel_cache.hpp"
+
+using namespace iroha::network;
+
+/**
+ * @given channel cache
+ * @when channel to the same address is requested twice
+ * @then the same channel is returned
+ */
+TEST(GrpcChannelCacheTest, ChannelIsReused) {
+  GrpcChannelCache cache;
+
+  auto channel = cache.channel("127.0.0.1:50051");
+
+  ASSERT_EQ(channel, cache.channel("127.0.0.1:50051"));
+  ASSERT_NE(channel, cache.channel("127.0.0.1:50052"));
+  ASSERT_EQ(2, cache.size());
+}
+
+/**
+ * @given channel cache with channels to several peers
+ * @when peer list is changed
+ * @then channels to removed peers are dropped
+ * @and channels to remaining peers are kept
+ */
+TEST(GrpcChannelCacheTest, ChannelsOfRemovedPeersAreDropped) {
+  GrpcChannelCache cache;
+  auto kept = cache.channel("127.0.0.1:50051");
+  auto dropped = cache.channel("127.0.0.1:50052");
+
+  cache.retain({"127.0.0.1:50051", "127.0.0.1:50053"});
+
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(kept, cache.channel("127.0.0.1:50051"));
+  ASSERT_NE(dropped, cache.channel("127.0.0.1:50052"));
+}
@@ -31,7 +31,10 @@ namespace iroha {
       MOCK_METHOD1(propagate_transaction,
                    void(std::shared_ptr<const model::Transaction>));
 
-      MOCK_METHOD0(on_proposal, rxcpp::observable<model::Proposal>());
+      MOCK_METHOD0(
+          on_proposal,
+          rxcpp::observable<
+              std::shared_ptr<shared_model::interface::Proposal>>());
 
       MOCK_METHOD0(on_commit, rxcpp::observable<Commit>());
     };
@@ -52,7 +55,10 @@ namespace iroha {
       MOCK_METHOD1(propagateTransaction,
                    void(std::shared_ptr<const model::Transaction> transaction));
 
-      MOCK_METHOD0(on_proposal, rxcpp::observable<model::Proposal>());
+      MOCK_METHOD0(
+          on_proposal,
+          rxcpp::observable<
+              std::shared_ptr<shared_model::interface::Proposal>>());
     };
 
     class MockConsensusGate : public ConsensusGate {
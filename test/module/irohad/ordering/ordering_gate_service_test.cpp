@@ -86,9 +86,13 @@ class OrderingGateServiceTest : public ::testing::Test {
     }
   }
 
-  TestSubscriber<iroha::model::Proposal> init(size_t times) {
+  TestSubscriber<std::shared_ptr<shared_model::interface::Proposal>> init(
+      size_t times) {
     auto wrapper = make_test_subscriber<CallExact>(gate->on_proposal(), times);
-    wrapper.subscribe([this](auto proposal) { proposals.push_back(proposal); });
+    // transactions are checked in old model
+    wrapper.subscribe([this](auto proposal) {
+      proposals.push_back(*std::unique_ptr<Proposal>(proposal->makeOldModel()));
+    });
     gate->on_proposal().subscribe([this](auto) {
       counter--;
       cv.notify_one();
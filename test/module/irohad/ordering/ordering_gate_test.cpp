@@ -33,8 +33,9 @@ using namespace iroha::network;
 using namespace framework::test_subscriber;
 using namespace std::chrono_literals;
 
+using ::testing::AtLeast;
 using ::testing::_;
-using ::testing::InvokeWithoutArgs;
+using ::testing::Invoke;
 
 class MockOrderingGateTransportGrpcService
     : public proto::OrderingServiceTransportGrpc::Service {
@@ -43,6 +44,10 @@ class MockOrderingGateTransportGrpcService
                ::grpc::Status(::grpc::ServerContext *,
                               const iroha::protocol::Transaction *,
                               ::google::protobuf::Empty *));
+  MOCK_METHOD3(onTransactions,
+               ::grpc::Status(::grpc::ServerContext *,
+                              const proto::TxList *,
+                              ::google::protobuf::Empty *));
 };
 
 class OrderingGateTest : public ::testing::Test {
@@ -61,7 +66,7 @@ class OrderingGateTest : public ::testing::Test {
       builder.RegisterService(fake_service.get());
 
       server = builder.BuildAndStart();
-      auto address = "0.0.0.0:" + std::to_string(port);
+      address = "0.0.0.0:" + std::to_string(port);
       // Initialize components after port has been bind
       transport = std::make_shared<OrderingGateTransportGrpc>(address);
       gate_impl = std::make_shared<OrderingGateImpl>(transport);
@@ -85,6 +90,7 @@ class OrderingGateTest : public ::testing::Test {
   }
 
   std::unique_ptr<grpc::Server> server;
+  std::string address;
 
   std::shared_ptr<OrderingGateTransportGrpc> transport;
   std::shared_ptr<OrderingGateImpl> gate_impl;
@@ -96,12 +102,14 @@ class OrderingGateTest : public ::testing::Test {
 
 TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
   // Init => send 5 transactions => 5 transactions are processed by server
+  // in batches
 
   size_t call_count = 0;
-  EXPECT_CALL(*fake_service, onTransaction(_, _, _))
-      .Times(5)
-      .WillRepeatedly(InvokeWithoutArgs([&] {
-        ++call_count;
+  EXPECT_CALL(*fake_service, onTransactions(_, _, _))
+      .Times(AtLeast(1))
+      .WillRepeatedly(Invoke([&](auto, auto request, auto) {
+        std::lock_guard<std::mutex> lock(m);
+        call_count += request->transactions_size();
         cv.notify_one();
         return grpc::Status::OK;
       }));
@@ -111,7 +119,36 @@ TEST_F(OrderingGateTest, TransactionReceivedByServerWhenSent) {
   }
 
   std::unique_lock<std::mutex> lock(m);
-  cv.wait_for(lock, 10s, [&] { return call_count == 5; });
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return call_count == 5; }));
+}
+
+/**
+ * @given transport with max batch size 2 and batch window longer than test
+ * @when 4 transactions are propagated
+ * @then they are sent in 2 batches of 2 transactions without waiting for
+ * the window
+ */
+TEST_F(OrderingGateTest, BatchSentWhenMaxSizeReached) {
+  auto batching_transport =
+      std::make_shared<OrderingGateTransportGrpc>(address, 2, 1h);
+
+  std::vector<int> batch_sizes;
+  EXPECT_CALL(*fake_service, onTransactions(_, _, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([&](auto, auto request, auto) {
+        std::lock_guard<std::mutex> lock(m);
+        batch_sizes.push_back(request->transactions_size());
+        cv.notify_one();
+        return grpc::Status::OK;
+      }));
+
+  for (size_t i = 0; i < 4; ++i) {
+    batching_transport->propagateTransaction(std::make_shared<Transaction>());
+  }
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return batch_sizes.size() == 2; }));
+  ASSERT_EQ(std::vector<int>({2, 2}), batch_sizes);
 }
 
 TEST_F(OrderingGateTest, ProposalReceivedByGateWhenSent) {
@@ -88,7 +88,7 @@ class OrderingServiceTest : public ::testing::Test {
 
   auto empty_tx() {
     return std::make_shared<shared_model::proto::Transaction>(
-        TestTransactionBuilder().build());
+        TestTransactionBuilder().txCounter(++tx_counter).build());
   }
 
   std::shared_ptr<MockOrderingServiceTransport> fake_transport;
@@ -98,6 +98,7 @@ class OrderingServiceTest : public ::testing::Test {
   std::string address{"0.0.0.0:50051"};
   model::Peer peer;
   std::shared_ptr<MockPeerQuery> wsv;
+  size_t tx_counter = 0;
 };
 
 TEST_F(OrderingServiceTest, SimpleTest) {
@@ -206,3 +207,165 @@ TEST_F(OrderingServiceTest, ValidWhenTimerStrategy) {
   ordering_service->onTransaction(empty_tx());
   cv.wait_for(lk, 10s);
 }
+
+/**
+ * @given ordering service with queue capacity less than proposal size
+ * @when more transactions than capacity are received before proposal
+ * @then transactions which do not fit into the queue are rejected
+ * @and rejections are counted in metrics
+ */
+TEST_F(OrderingServiceTest, RejectsTransactionsWhenQueueIsFull) {
+  const size_t max_proposal = 10;
+  const size_t commit_delay = 10000;
+  const size_t queue_capacity = 3;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            commit_delay,
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            queue_capacity);
+  fake_transport->subscribe(ordering_service);
+
+  for (size_t i = 0; i < queue_capacity; ++i) {
+    ASSERT_TRUE(ordering_service->onTransaction(empty_tx()));
+  }
+  ASSERT_FALSE(ordering_service->onTransaction(empty_tx()));
+
+  auto metrics = ordering_service->metrics();
+  ASSERT_EQ(queue_capacity, metrics.queue_depth);
+  ASSERT_EQ(queue_capacity, metrics.accepted);
+  ASSERT_EQ(1, metrics.dropped);
+}
+
+/**
+ * @given ordering service
+ * @when the same transaction is received several times
+ * @then only the first one is enqueued
+ * @and duplicates are counted in metrics
+ */
+TEST_F(OrderingServiceTest, DropsDuplicateTransactions) {
+  const size_t max_proposal = 10;
+  const size_t commit_delay = 10000;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+
+  auto ordering_service = std::make_shared<OrderingServiceImpl>(
+      wsv, max_proposal, commit_delay, fake_transport, fake_persistent_state);
+  fake_transport->subscribe(ordering_service);
+
+  auto tx = empty_tx();
+  ASSERT_TRUE(ordering_service->onTransaction(tx));
+  ASSERT_TRUE(ordering_service->onTransaction(tx));
+  ASSERT_TRUE(ordering_service->onTransaction(
+      std::make_shared<shared_model::proto::Transaction>(*tx)));
+  ASSERT_TRUE(ordering_service->onTransaction(empty_tx()));
+
+  auto metrics = ordering_service->metrics();
+  ASSERT_EQ(2, metrics.queue_depth);
+  ASSERT_EQ(2, metrics.accepted);
+  ASSERT_EQ(2, metrics.duplicates);
+  ASSERT_LT(0, metrics.seen_memory);
+}
+
+/**
+ * @given ordering service, which publishes proposal slowly
+ * @when proposal is generated by timer
+ * @then other timers of the same timer wheel are not delayed
+ */
+TEST_F(OrderingServiceTest, ProposalIsGeneratedOffTimerWheel) {
+  const size_t max_proposal = 100;
+  const size_t commit_delay = 10;
+  auto timer_wheel = std::make_shared<timer::TimerWheel>();
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+  EXPECT_CALL(*fake_persistent_state, saveProposalHeight(_))
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(*wsv, getLedgerPeers())
+      .WillRepeatedly(Return(std::vector<wPeer>{}));
+
+  bool publishing = false;
+  EXPECT_CALL(*fake_transport, publishProposalProxy(_, _))
+      .WillRepeatedly(InvokeWithoutArgs([&] {
+        {
+          std::lock_guard<std::mutex> lock(m);
+          publishing = true;
+        }
+        cv.notify_one();
+        std::this_thread::sleep_for(300ms);
+      }));
+
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            max_proposal,
+                                            commit_delay,
+                                            fake_transport,
+                                            fake_persistent_state,
+                                            1000,
+                                            1000,
+                                            timer_wheel);
+  ordering_service->onTransaction(empty_tx());
+
+  std::unique_lock<std::mutex> lock(m);
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return publishing; }));
+
+  bool fired = false;
+  auto start = std::chrono::steady_clock::now();
+  timer_wheel->schedule(1ms, [&] {
+    {
+      std::lock_guard<std::mutex> lock(m);
+      fired = true;
+    }
+    cv.notify_one();
+  });
+  ASSERT_TRUE(cv.wait_for(lock, 10s, [&] { return fired; }));
+  ASSERT_LT(std::chrono::steady_clock::now() - start, 200ms);
+}
+
+/**
+ * @given ordering service with queue capacity 2, and its grpc transport
+ * @when list of 3 transactions is received by transport
+ * @then 2 transactions are enqueued
+ * @and transport reports the rejected one with RESOURCE_EXHAUSTED status
+ */
+TEST_F(OrderingServiceTest, TransportReportsRejectedTransactions) {
+  const size_t queue_capacity = 2;
+
+  EXPECT_CALL(*fake_persistent_state, loadProposalHeight())
+      .Times(1)
+      .WillOnce(Return(boost::optional<size_t>(2)));
+
+  auto transport = std::make_shared<OrderingServiceTransportGrpc>();
+  auto ordering_service =
+      std::make_shared<OrderingServiceImpl>(wsv,
+                                            10,
+                                            10000,
+                                            transport,
+                                            fake_persistent_state,
+                                            queue_capacity);
+  transport->subscribe(ordering_service);
+
+  iroha::ordering::proto::TxList list;
+  for (size_t i = 0; i < queue_capacity + 1; ++i) {
+    *list.add_transactions() = empty_tx()->getTransport();
+  }
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+
+  auto status = transport->onTransactions(&context, &list, &response);
+
+  ASSERT_EQ(grpc::StatusCode::RESOURCE_EXHAUSTED, status.error_code());
+  ASSERT_EQ(0, status.error_message().find("1 of 3 transactions"));
+  auto metrics = ordering_service->metrics();
+  ASSERT_EQ(queue_capacity, metrics.accepted);
+  ASSERT_EQ(1, metrics.dropped);
+}
@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+
+#include "ordering/impl/seen_transactions.hpp"
+
+using namespace iroha::ordering;
+
+/**
+ * @given seen transactions
+ * @when many distinct hashes are inserted
+ * @then every hash is recorded, and every repeated one is rejected
+ */
+TEST(SeenTransactionsTest, RepeatedHashesAreRejected) {
+  const size_t capacity = 16000;
+  SeenTransactions seen(capacity);
+
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_TRUE(seen.insert("hash" + std::to_string(i)));
+  }
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_FALSE(seen.insert("hash" + std::to_string(i)));
+  }
+  ASSERT_GT(seen.memoryUsage(), 0);
+}
+
+/**
+ * @given seen transactions with hashes of a generation
+ * @when many more distinct hashes are inserted
+ * @then the old hashes are forgotten, and memory does not grow
+ */
+TEST(SeenTransactionsTest, OldHashesAreForgotten) {
+  const size_t capacity = 1600;
+  SeenTransactions seen(capacity);
+
+  for (size_t i = 0; i < 2 * capacity; ++i) {
+    seen.insert("old" + std::to_string(i));
+  }
+  auto memory = seen.memoryUsage();
+  for (size_t i = 0; i < 4 * capacity; ++i) {
+    seen.insert("new" + std::to_string(i));
+  }
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_TRUE(seen.insert("old" + std::to_string(i)));
+  }
+  ASSERT_LE(seen.memoryUsage(), memory * 11 / 10);
+}
+
+/**
+ * @given seen transactions with recorded hash
+ * @when the hash is erased
+ * @then it can be recorded again
+ */
+TEST(SeenTransactionsTest, ErasedHashIsRecordedAgain) {
+  SeenTransactions seen(1000);
+
+  ASSERT_TRUE(seen.insert("hash"));
+  seen.erase("hash");
+  ASSERT_TRUE(seen.insert("hash"));
+  ASSERT_FALSE(seen.insert("hash"));
+}
+
+/**
+ * @given seen transactions
+ * @when the same hashes are inserted from several threads
+ * @then each hash is recorded exactly once
+ */
+TEST(SeenTransactionsTest, ConcurrentInsertRecordsOnce) {
+  const size_t hashes = 10000, threads = 4;
+  SeenTransactions seen(hashes);
+  std::atomic<size_t> recorded{0};
+
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&] {
+      for (size_t i = 0; i < hashes; ++i) {
+        if (seen.insert("hash" + std::to_string(i))) {
+          ++recorded;
+        }
+      }
+    });
+  }
+  for (auto &worker : workers) {
+    worker.join();
+  }
+  ASSERT_EQ(hashes, recorded);
+}
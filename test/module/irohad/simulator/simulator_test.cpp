@@ -34,6 +34,7 @@ using namespace framework::test_subscriber;
 
 using ::testing::_;
 using ::testing::A;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnArg;
 
@@ -47,9 +48,25 @@ class SimulatorTest : public ::testing::Test {
     crypto_provider = std::make_shared<MockCryptoProvider>();
   }
 
-  void init() {
+  void init(bool pipelined = false) {
     simulator = std::make_shared<Simulator>(
-        ordering_gate, validator, factory, query, crypto_provider);
+        ordering_gate, validator, factory, query, crypto_provider, pipelined);
+  }
+
+  /**
+   * Temporary wsv, which expects given number of applied transactions
+   */
+  static expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
+  makeTemporaryWsv(size_t applied) {
+    auto wsv = std::make_unique<MockTemporaryWsv>();
+    EXPECT_CALL(*wsv, apply(_, _)).Times(applied).WillRepeatedly(Return(true));
+    return expected::makeValue<std::unique_ptr<TemporaryWsv>>(std::move(wsv));
+  }
+
+  static std::shared_ptr<shared_model::interface::Proposal> toShared(
+      const model::Proposal &proposal) {
+    return std::make_shared<shared_model::proto::Proposal>(
+        shared_model::proto::from_old(proposal));
   }
 
   std::shared_ptr<MockStatefulValidator> validator;
@@ -64,7 +81,8 @@ class SimulatorTest : public ::testing::Test {
 TEST_F(SimulatorTest, ValidWhenInitialized) {
   // simulator constructor => on_proposal subscription called
   EXPECT_CALL(*ordering_gate, on_proposal())
-      .WillOnce(Return(rxcpp::observable<>::empty<Proposal>()));
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
 
   init();
 }
@@ -89,7 +107,8 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   EXPECT_CALL(*validator, validate(_, _)).WillOnce(Return(iprop));
 
   EXPECT_CALL(*ordering_gate, on_proposal())
-      .WillOnce(Return(rxcpp::observable<>::empty<Proposal>()));
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
 
   EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(1);
 
@@ -98,8 +117,10 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
   auto proposal_wrapper =
       make_test_subscriber<CallExact>(simulator->on_verified_proposal(), 1);
   proposal_wrapper.subscribe([&proposal](auto verified_proposal) {
-    ASSERT_EQ(verified_proposal.height, proposal.height);
-    ASSERT_EQ(verified_proposal.transactions, proposal.transactions);
+    ASSERT_EQ(verified_proposal->height(), proposal.height);
+    std::unique_ptr<model::Proposal> old_proposal(
+        verified_proposal->makeOldModel());
+    ASSERT_EQ(old_proposal->transactions, proposal.transactions);
   });
 
   auto block_wrapper =
@@ -109,7 +130,7 @@ TEST_F(SimulatorTest, ValidWhenPreviousBlock) {
     ASSERT_EQ(block.transactions, proposal.transactions);
   });
 
-  simulator->process_proposal(proposal);
+  simulator->process_proposal(*toShared(proposal));
 
   ASSERT_TRUE(proposal_wrapper.validate());
   ASSERT_TRUE(block_wrapper.validate());
@@ -129,7 +150,8 @@ TEST_F(SimulatorTest, FailWhenNoBlock) {
   EXPECT_CALL(*validator, validate(_, _)).Times(0);
 
   EXPECT_CALL(*ordering_gate, on_proposal())
-      .WillOnce(Return(rxcpp::observable<>::empty<Proposal>()));
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
 
   EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(0);
 
@@ -143,7 +165,7 @@ TEST_F(SimulatorTest, FailWhenNoBlock) {
       make_test_subscriber<CallExact>(simulator->on_block(), 0);
   block_wrapper.subscribe();
 
-  simulator->process_proposal(proposal);
+  simulator->process_proposal(*toShared(proposal));
 
   ASSERT_TRUE(proposal_wrapper.validate());
   ASSERT_TRUE(block_wrapper.validate());
@@ -166,7 +188,8 @@ TEST_F(SimulatorTest, FailWhenSameAsProposalHeight) {
   EXPECT_CALL(*validator, validate(_, _)).Times(0);
 
   EXPECT_CALL(*ordering_gate, on_proposal())
-      .WillOnce(Return(rxcpp::observable<>::empty<Proposal>()));
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
 
   EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(0);
 
@@ -180,8 +203,100 @@ TEST_F(SimulatorTest, FailWhenSameAsProposalHeight) {
       make_test_subscriber<CallExact>(simulator->on_block(), 0);
   block_wrapper.subscribe();
 
-  simulator->process_proposal(proposal);
+  simulator->process_proposal(*toShared(proposal));
 
   ASSERT_TRUE(proposal_wrapper.validate());
   ASSERT_TRUE(block_wrapper.validate());
 }
+
+/**
+ * @given pipelined simulator, ledger with block of height 1
+ * @when proposals with height 2 and 3 are received before block 2 is committed
+ * @then proposal 3 is validated on top of transactions of block 2
+ * @and block 3 is created on top of block 2
+ */
+TEST_F(SimulatorTest, PipelinedWhenPreviousBlockIsNotCommitted) {
+  auto txs = std::vector<model::Transaction>(2);
+  auto proposal = model::Proposal(txs);
+  proposal.height = 2;
+  auto next_proposal = model::Proposal(txs);
+  next_proposal.height = 3;
+
+  model::Block block;
+  block.height = proposal.height - 1;
+
+  EXPECT_CALL(*factory, createTemporaryWsv())
+      .WillOnce(Invoke([] { return makeTemporaryWsv(0); }))
+      .WillOnce(Invoke([&txs] { return makeTemporaryWsv(txs.size()); }));
+  EXPECT_CALL(*query, getTopBlocks(1))
+      .WillRepeatedly(Return(rxcpp::observable<>::just(block)));
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Return(toShared(proposal)))
+      .WillOnce(Return(toShared(next_proposal)));
+  EXPECT_CALL(*ordering_gate, on_proposal())
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
+  EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(2);
+
+  init(true);
+
+  std::vector<model::Block> blocks;
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 2);
+  block_wrapper.subscribe([&blocks](auto block) { blocks.push_back(block); });
+
+  simulator->process_proposal(*toShared(proposal));
+  simulator->process_proposal(*toShared(next_proposal));
+
+  ASSERT_TRUE(block_wrapper.validate());
+  ASSERT_EQ(blocks.at(0).prev_hash, block.hash);
+  ASSERT_EQ(blocks.at(1).height, next_proposal.height);
+  ASSERT_EQ(blocks.at(1).prev_hash, blocks.at(0).hash);
+}
+
+/**
+ * @given pipelined simulator, which has created block 2
+ * @when another block 2 is committed, and proposal 3 is received
+ * @then created block is discarded
+ * @and block 3 is created on top of the committed block
+ */
+TEST_F(SimulatorTest, PipelinedWhenCommittedBlockDiffers) {
+  auto txs = std::vector<model::Transaction>(2);
+  auto proposal = model::Proposal(txs);
+  proposal.height = 2;
+  auto next_proposal = model::Proposal(txs);
+  next_proposal.height = 3;
+
+  model::Block block;
+  block.height = proposal.height - 1;
+  model::Block committed_block;
+  committed_block.height = proposal.height;
+  committed_block.hash.fill(1);
+
+  EXPECT_CALL(*factory, createTemporaryWsv())
+      .Times(2)
+      .WillRepeatedly(Invoke([] { return makeTemporaryWsv(0); }));
+  EXPECT_CALL(*query, getTopBlocks(1))
+      .WillOnce(Return(rxcpp::observable<>::just(block)))
+      .WillOnce(Return(rxcpp::observable<>::just(committed_block)));
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Return(toShared(proposal)))
+      .WillOnce(Return(toShared(next_proposal)));
+  EXPECT_CALL(*ordering_gate, on_proposal())
+      .WillOnce(Return(rxcpp::observable<>::empty<
+                       std::shared_ptr<shared_model::interface::Proposal>>()));
+  EXPECT_CALL(*crypto_provider, sign(A<Block &>())).Times(2);
+
+  init(true);
+
+  std::vector<model::Block> blocks;
+  auto block_wrapper =
+      make_test_subscriber<CallExact>(simulator->on_block(), 2);
+  block_wrapper.subscribe([&blocks](auto block) { blocks.push_back(block); });
+
+  simulator->process_proposal(*toShared(proposal));
+  simulator->process_proposal(*toShared(next_proposal));
+
+  ASSERT_TRUE(block_wrapper.validate());
+  ASSERT_EQ(blocks.at(1).prev_hash, committed_block.hash);
+}
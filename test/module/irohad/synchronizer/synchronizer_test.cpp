@@ -76,7 +76,7 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
       SetFactory(&createMockMutableStorage);
   EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
 
-  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+  EXPECT_CALL(*mutable_factory, commit_(_)).WillOnce(Return(true));
 
   EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
       .WillOnce(Return(true));
@@ -104,6 +104,40 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given valid block from consensus
+ * @when storage fails to commit it
+ * @then no commit is emitted
+ */
+TEST_F(SynchronizerTest, NoCommitWhenStorageCommitFails) {
+  Block test_block;
+  test_block.height = 5;
+
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  EXPECT_CALL(*mutable_factory, commit_(_)).WillOnce(Return(false));
+
+  EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
+      .WillOnce(Return(true));
+
+  EXPECT_CALL(*block_loader, retrieveBlocks(_)).Times(0);
+
+  EXPECT_CALL(*consensus_gate, on_commit())
+      .WillOnce(Return(rxcpp::observable<>::empty<Block>()));
+
+  init();
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 0);
+  wrapper.subscribe();
+
+  synchronizer->process_commit(test_block);
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 TEST_F(SynchronizerTest, ValidWhenBadStorage) {
   // commit from consensus => storage not created => no commit
   Block test_block;
@@ -142,7 +176,7 @@ TEST_F(SynchronizerTest, ValidWhenBlockValidationFailure) {
       SetFactory(&createMockMutableStorage);
   EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(2);
 
-  EXPECT_CALL(*mutable_factory, commit_(_)).Times(1);
+  EXPECT_CALL(*mutable_factory, commit_(_)).WillOnce(Return(true));
 
   EXPECT_CALL(*chain_validator, validateBlock(test_block, _))
       .WillOnce(Return(false));
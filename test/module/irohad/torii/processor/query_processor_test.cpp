@@ -26,6 +26,7 @@
 #include "torii/processor/query_processor_impl.hpp"
 
 #include "backend/protobuf/query_responses/proto_error_query_response.hpp"
+#include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/keypair.hpp"
 #include "module/shared_model/builders/protobuf/test_query_builder.hpp"
@@ -38,6 +39,7 @@ using namespace framework::test_subscriber;
 using ::testing::_;
 using ::testing::A;
 using ::testing::Return;
+using ::testing::Truly;
 
 class QueryProcessorTest : public ::testing::Test {
  public:
@@ -110,3 +112,77 @@ TEST_F(QueryProcessorTest, QueryProcessorWhereInvokeInvalidQuery) {
   qpi.queryHandle(
       std::make_shared<shared_model::proto::Query>(query.getTransport()));
 }
+
+/**
+ * @given account with 3 transactions and query processor, which streams
+ * pages of 2 transactions
+ * @when account history is requested page by page
+ * @then Query Processor returns 2 pages, the second one starts right after the
+ * last transaction of the first one
+ */
+TEST_F(QueryProcessorTest, QueryPagesStreamsAccountHistory) {
+  auto wsv_queries = std::make_shared<MockWsvQuery>();
+  auto block_queries = std::make_shared<MockBlockQuery>();
+  auto qpf = std::make_unique<model::QueryProcessingFactory>(wsv_queries,
+                                                             block_queries);
+
+  iroha::torii::QueryProcessorImpl qpi(std::move(qpf), 2);
+
+  auto query = TestUnsignedQueryBuilder()
+                   .createdTime(created_time)
+                   .creatorAccountId(account_id)
+                   .getAccountTransactions(account_id)
+                   .queryCounter(counter)
+                   .build()
+                   .signAndAddSignature(keypair);
+
+  std::vector<TransactionWithCursor> txs;
+  for (uint32_t i = 0; i < 3; ++i) {
+    model::TxCursor cursor;
+    cursor.height = 1;
+    cursor.index = i;
+    model::Transaction tx;
+    tx.creator_account_id = account_id;
+    tx.tx_counter = i;
+    txs.emplace_back(cursor, tx);
+  }
+  auto role = "user";
+  std::vector<std::string> roles = {role};
+  std::vector<std::string> perms = {iroha::model::can_get_my_acc_txs};
+
+  EXPECT_CALL(*wsv_queries, getAccountRoles(account_id))
+      .WillRepeatedly(Return(roles));
+  EXPECT_CALL(*wsv_queries, getRolePermissions(role))
+      .WillRepeatedly(Return(perms));
+  EXPECT_CALL(*block_queries,
+              getAccountTransactions(
+                  account_id, Truly([](const model::Pager &pager) {
+                    return pager.page_size == 2 and pager.cursor.height == 0
+                        and pager.cursor.index == 0;
+                  })))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<TransactionWithCursor>(txs.begin(), txs.begin() + 2))));
+  EXPECT_CALL(*block_queries,
+              getAccountTransactions(
+                  account_id, Truly([](const model::Pager &pager) {
+                    return pager.page_size == 2 and pager.cursor.height == 1
+                        and pager.cursor.index == 1;
+                  })))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<TransactionWithCursor>(txs.begin() + 2, txs.end()))));
+
+  std::vector<int> page_sizes;
+  auto wrapper = make_test_subscriber<CallExact>(
+      qpi.queryPages(
+          std::make_shared<shared_model::proto::Query>(query.getTransport())),
+      2);
+  wrapper.subscribe([&page_sizes](auto response) {
+    page_sizes.push_back(
+        static_cast<shared_model::proto::QueryResponse &>(*response)
+            .getTransport()
+            .transactions_response()
+            .transactions_size());
+  });
+  ASSERT_TRUE(wrapper.validate());
+  ASSERT_EQ(std::vector<int>({2, 1}), page_sizes);
+}
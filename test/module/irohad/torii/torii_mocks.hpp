@@ -32,6 +32,10 @@ namespace iroha {
       MOCK_METHOD0(queryNotifier,
                    rxcpp::observable<std::shared_ptr<
                        shared_model::interface::QueryResponse>>());
+      MOCK_METHOD1(queryPages,
+                   rxcpp::observable<std::shared_ptr<
+                       shared_model::interface::QueryResponse>>(
+                       std::shared_ptr<shared_model::interface::Query>));
     };
   }  // namespace torii
 }  // namespace iroha
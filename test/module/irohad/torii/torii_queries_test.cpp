@@ -61,7 +61,9 @@ class ToriiQueriesTest : public testing::Test {
     wsv_query = std::make_shared<MockWsvQuery>();
     block_query = std::make_shared<MockBlockQuery>();
 
-    rxcpp::subjects::subject<iroha::model::Proposal> prop_notifier;
+    rxcpp::subjects::subject<
+        std::shared_ptr<shared_model::interface::Proposal>>
+        prop_notifier;
     rxcpp::subjects::subject<Commit> commit_notifier;
 
     EXPECT_CALL(*pcsMock, on_proposal())
@@ -470,12 +472,15 @@ TEST_F(ToriiQueriesTest, FindTransactionsWhenValid) {
   account.account_id = "accountA";
 
   auto txs_observable = rxcpp::observable<>::iterate([account] {
-    std::vector<iroha::model::Transaction> result;
+    std::vector<TransactionWithCursor> result;
     for (size_t i = 0; i < 3; ++i) {
       iroha::model::Transaction current;
       current.creator_account_id = account.account_id;
       current.tx_counter = i;
-      result.push_back(current);
+      iroha::model::TxCursor cursor;
+      cursor.height = 1;
+      cursor.index = i;
+      result.emplace_back(cursor, current);
     }
     return result;
   }());
@@ -485,7 +490,7 @@ TEST_F(ToriiQueriesTest, FindTransactionsWhenValid) {
   EXPECT_CALL(*wsv_query, getAccountRoles("a@domain")).WillOnce(Return(roles));
   std::vector<std::string> perm = {can_get_my_acc_txs};
   EXPECT_CALL(*wsv_query, getRolePermissions("test")).WillOnce(Return(perm));
-  EXPECT_CALL(*block_query, getAccountTransactions("a@domain"))
+  EXPECT_CALL(*block_query, getAccountTransactions("a@domain", _))
       .WillOnce(Return(txs_observable));
 
   iroha::protocol::QueryResponse response;
@@ -520,6 +525,48 @@ TEST_F(ToriiQueriesTest, FindTransactionsWhenValid) {
             response.query_hash());
 }
 
+/**
+ * @given account transactions query of a client, which sends no pager
+ * @when query is sent to Find
+ * @then whole history is requested from block query and response refers
+ * to hash of query sent by the client
+ */
+TEST_F(ToriiQueriesTest, FindTransactionsWithoutPager) {
+  std::vector<std::string> roles = {"test"};
+  EXPECT_CALL(*wsv_query, getAccountRoles("a@domain")).WillOnce(Return(roles));
+  std::vector<std::string> perm = {can_get_my_acc_txs};
+  EXPECT_CALL(*wsv_query, getRolePermissions("test")).WillOnce(Return(perm));
+  EXPECT_CALL(*block_query,
+              getAccountTransactions(
+                  "a@domain", ::testing::Truly([](const Pager &pager) {
+                    return not pager.present and pager.page_size == 0;
+                  })))
+      .WillOnce(Return(rxcpp::observable<>::empty<TransactionWithCursor>()));
+
+  auto model_query = shared_model::proto::QueryBuilder()
+                         .creatorAccountId("a@domain")
+                         .queryCounter(1)
+                         .createdTime(iroha::time::now())
+                         .getAccountTransactions("a@domain")
+                         .build()
+                         .signAndAddSignature(
+                             shared_model::crypto::DefaultCryptoAlgorithmType::
+                                 generateKeypair());
+  ASSERT_FALSE(model_query.getTransport()
+                   .payload()
+                   .get_account_transactions()
+                   .has_pager());
+
+  iroha::protocol::QueryResponse response;
+  auto stat = torii_utils::QuerySyncClient(Ip, Port).Find(
+      model_query.getTransport(), response);
+  ASSERT_TRUE(stat.ok());
+  ASSERT_TRUE(response.has_transactions_response());
+  ASSERT_FALSE(response.transactions_response().has_next_cursor());
+  ASSERT_EQ(iroha::hash(model_query.getTransport()).to_string(),
+            response.query_hash());
+}
+
 TEST_F(ToriiQueriesTest, FindManyTimesWhereQueryServiceSync) {
   auto client = torii_utils::QuerySyncClient(Ip, Port);
 
@@ -31,6 +31,7 @@ limitations under the License.
 #include "torii/query_client.hpp"
 #include "torii/query_service.hpp"
 
+#include "backend/protobuf/from_old_model.hpp"
 #include "builders/protobuf/transaction.hpp"
 
 constexpr const char *Ip = "0.0.0.0";
@@ -54,14 +55,16 @@ using Commit = rxcpp::observable<iroha::model::Block>;
 class CustomPeerCommunicationServiceMock : public PeerCommunicationService {
  public:
   CustomPeerCommunicationServiceMock(
-      rxcpp::subjects::subject<iroha::model::Proposal> prop_notifier,
+      rxcpp::subjects::subject<
+          std::shared_ptr<shared_model::interface::Proposal>> prop_notifier,
       rxcpp::subjects::subject<Commit> commit_notifier)
       : prop_notifier_(prop_notifier), commit_notifier_(commit_notifier){};
 
   void propagate_transaction(
       std::shared_ptr<const iroha::model::Transaction> transaction) override {}
 
-  rxcpp::observable<iroha::model::Proposal> on_proposal() override {
+  rxcpp::observable<std::shared_ptr<shared_model::interface::Proposal>>
+  on_proposal() override {
     return prop_notifier_.get_observable();
   }
   rxcpp::observable<Commit> on_commit() override {
@@ -69,7 +72,9 @@ class CustomPeerCommunicationServiceMock : public PeerCommunicationService {
   }
 
  private:
-  rxcpp::subjects::subject<iroha::model::Proposal> prop_notifier_;
+  rxcpp::subjects::subject<
+      std::shared_ptr<shared_model::interface::Proposal>>
+      prop_notifier_;
   rxcpp::subjects::subject<Commit> commit_notifier_;
 };
 
@@ -119,7 +124,9 @@ class ToriiServiceTest : public testing::Test {
   std::shared_ptr<MockWsvQuery> wsv_query;
   std::shared_ptr<MockBlockQuery> block_query;
 
-  rxcpp::subjects::subject<iroha::model::Proposal> prop_notifier_;
+  rxcpp::subjects::subject<
+      std::shared_ptr<shared_model::interface::Proposal>>
+      prop_notifier_;
   rxcpp::subjects::subject<Commit> commit_notifier_;
 
   std::shared_ptr<CustomPeerCommunicationServiceMock> pcsMock;
@@ -233,7 +240,9 @@ TEST_F(ToriiServiceTest, StatusWhenBlocking) {
 
   // create proposal from these transactions
   iroha::model::Proposal proposal(txs);
-  prop_notifier_.get_subscriber().on_next(proposal);
+  prop_notifier_.get_subscriber().on_next(
+      std::make_shared<shared_model::proto::Proposal>(
+          shared_model::proto::from_old(proposal)));
 
   torii::CommandSyncClient client2(client1);
 
@@ -368,7 +377,9 @@ TEST_F(ToriiServiceTest, StreamingFullPipelineTest) {
   std::vector<iroha::model::Transaction> txs;
   txs.push_back(*iroha_tx);
   iroha::model::Proposal proposal(txs);
-  prop_notifier_.get_subscriber().on_next(proposal);
+  prop_notifier_.get_subscriber().on_next(
+      std::make_shared<shared_model::proto::Proposal>(
+          shared_model::proto::from_old(proposal)));
 
   iroha::model::Block block;
   block.transactions.push_back(*iroha_tx);
@@ -65,6 +65,22 @@ class QueryValidateExecuteTest : public ::testing::Test {
     return factory->execute(query);
   }
 
+  /**
+   * Attach positions to transactions, as block query does for pages of
+   * account history. Transaction counter is used as index in the block
+   * @param txs - transactions
+   * @return transactions with their positions
+   */
+  rxcpp::observable<TransactionWithCursor> withCursors(
+      rxcpp::observable<Transaction> txs) {
+    return txs.map([](const auto &tx) {
+      TxCursor cursor;
+      cursor.height = 1;
+      cursor.index = tx.tx_counter;
+      return std::make_pair(cursor, tx);
+    });
+  }
+
   std::string admin_id = "admin@test", account_id = "test@test",
               asset_id = "coin#test", domain_id = "test";
 
@@ -581,8 +597,8 @@ TEST_F(GetAccountTransactionsTest, MyAccountValidCase) {
 
   txs_observable = getDefaultTransactions(admin_id);
 
-  EXPECT_CALL(*block_query, getAccountTransactions(admin_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query, getAccountTransactions(admin_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
   auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
 
@@ -606,8 +622,8 @@ TEST_F(GetAccountTransactionsTest, AllAccountValidCase) {
   EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
       .WillOnce(Return(role_permissions));
 
-  EXPECT_CALL(*block_query, getAccountTransactions(account_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query, getAccountTransactions(account_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
 
   auto TxWrapper = make_test_subscriber<CallExact>(txs_observable, N);
@@ -630,8 +646,8 @@ TEST_F(GetAccountTransactionsTest, DomainAccountValidCase) {
   EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
       .WillOnce(Return(role_permissions));
 
-  EXPECT_CALL(*block_query, getAccountTransactions(account_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query, getAccountTransactions(account_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
 
   auto TxWrapper = make_test_subscriber<CallExact>(txs_observable, N);
@@ -658,8 +674,8 @@ TEST_F(GetAccountTransactionsTest, GrantAccountValidCase) {
                   admin_id, get_tx->account_id, can_get_my_acc_txs))
       .WillOnce(Return(true));
 
-  EXPECT_CALL(*block_query, getAccountTransactions(account_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query, getAccountTransactions(account_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
 
   auto TxWrapper = make_test_subscriber<CallExact>(txs_observable, N);
@@ -705,11 +721,61 @@ TEST_F(GetAccountTransactionsTest, NoAccountExist) {
   EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
       .WillOnce(Return(role_permissions));
 
-  EXPECT_CALL(*block_query, getAccountTransactions(get_tx->account_id))
-      .WillOnce(Return(rxcpp::observable<>::empty<Transaction>()));
+  EXPECT_CALL(*block_query, getAccountTransactions(get_tx->account_id, _))
+      .WillOnce(Return(rxcpp::observable<>::empty<TransactionWithCursor>()));
+
+  auto response = validateAndExecute();
+  auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
+}
+
+/**
+ * @given initialized storage, permission to his/her account
+ * @when get a page of account transactions, which is filled completely
+ * @then Return transactions of the page and cursor of the last of them
+ */
+TEST_F(GetAccountTransactionsTest, FullPageHasNextCursor) {
+  EXPECT_CALL(*wsv_query, getAccountRoles(admin_id))
+      .WillOnce(Return(admin_roles));
+  EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
+      .WillOnce(Return(role_permissions));
+
+  get_tx->pager.page_size = N;
+  txs_observable = getDefaultTransactions(admin_id);
+  EXPECT_CALL(*block_query, getAccountTransactions(admin_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
+  auto response = validateAndExecute();
+  auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
+
+  auto TxWrapper = make_test_subscriber<CallExact>(cast_resp->transactions, N);
+  TxWrapper.subscribe();
+  ASSERT_TRUE(TxWrapper.validate());
+  ASSERT_TRUE(cast_resp->next_cursor);
+  ASSERT_EQ(1, cast_resp->next_cursor->height);
+  ASSERT_EQ(N - 1, cast_resp->next_cursor->index);
+}
+
+/**
+ * @given initialized storage, permission to his/her account
+ * @when get a page of account transactions, which is not filled completely
+ * @then Return transactions of the page without cursor of the next page
+ */
+TEST_F(GetAccountTransactionsTest, LastPageHasNoNextCursor) {
+  EXPECT_CALL(*wsv_query, getAccountRoles(admin_id))
+      .WillOnce(Return(admin_roles));
+  EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
+      .WillOnce(Return(role_permissions));
 
+  get_tx->pager.page_size = N + 1;
+  txs_observable = getDefaultTransactions(admin_id);
+  EXPECT_CALL(*block_query, getAccountTransactions(admin_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
   auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
+
+  auto TxWrapper = make_test_subscriber<CallExact>(cast_resp->transactions, N);
+  TxWrapper.subscribe();
+  ASSERT_TRUE(TxWrapper.validate());
+  ASSERT_FALSE(cast_resp->next_cursor);
 }
 
 /// --------- Get Account Assets Transactions-------------
@@ -758,8 +824,9 @@ TEST_F(GetAccountAssetsTransactionsTest, MyAccountValidCase) {
   get_tx->account_id = admin_id;
   txs_observable = getDefaultTransactions(admin_id, asset_id);
 
-  EXPECT_CALL(*block_query, getAccountAssetTransactions(admin_id, asset_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query,
+              getAccountAssetTransactions(admin_id, asset_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
   auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
 
@@ -783,8 +850,9 @@ TEST_F(GetAccountAssetsTransactionsTest, AllAccountValidCase) {
   EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
       .WillOnce(Return(role_permissions));
 
-  EXPECT_CALL(*block_query, getAccountAssetTransactions(account_id, asset_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query,
+              getAccountAssetTransactions(account_id, asset_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
 
   auto TxWrapper = make_test_subscriber<CallExact>(txs_observable, N);
@@ -807,8 +875,9 @@ TEST_F(GetAccountAssetsTransactionsTest, DomainAccountValidCase) {
   EXPECT_CALL(*wsv_query, getRolePermissions(admin_role))
       .WillOnce(Return(role_permissions));
 
-  EXPECT_CALL(*block_query, getAccountAssetTransactions(account_id, asset_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query,
+              getAccountAssetTransactions(account_id, asset_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
 
   auto TxWrapper = make_test_subscriber<CallExact>(txs_observable, N);
@@ -835,8 +904,9 @@ TEST_F(GetAccountAssetsTransactionsTest, GrantAccountValidCase) {
                   admin_id, get_tx->account_id, can_get_my_acc_ast_txs))
       .WillOnce(Return(true));
 
-  EXPECT_CALL(*block_query, getAccountAssetTransactions(account_id, asset_id))
-      .WillOnce(Return(txs_observable));
+  EXPECT_CALL(*block_query,
+              getAccountAssetTransactions(account_id, asset_id, _))
+      .WillOnce(Return(withCursors(txs_observable)));
   auto response = validateAndExecute();
 
   auto TxWrapper = make_test_subscriber<CallExact>(txs_observable, N);
@@ -883,8 +953,8 @@ TEST_F(GetAccountAssetsTransactionsTest, NoAccountExist) {
       .WillOnce(Return(role_permissions));
 
   EXPECT_CALL(*block_query,
-              getAccountAssetTransactions(get_tx->account_id, asset_id))
-      .WillOnce(Return(rxcpp::observable<>::empty<Transaction>()));
+              getAccountAssetTransactions(get_tx->account_id, asset_id, _))
+      .WillOnce(Return(rxcpp::observable<>::empty<TransactionWithCursor>()));
 
   auto response = validateAndExecute();
   auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
@@ -906,8 +976,9 @@ TEST_F(GetAccountAssetsTransactionsTest, NoAssetExist) {
       .WillOnce(Return(role_permissions));
 
   EXPECT_CALL(*block_query,
-              getAccountAssetTransactions(get_tx->account_id, get_tx->asset_id))
-      .WillOnce(Return(rxcpp::observable<>::empty<Transaction>()));
+              getAccountAssetTransactions(
+                  get_tx->account_id, get_tx->asset_id, _))
+      .WillOnce(Return(rxcpp::observable<>::empty<TransactionWithCursor>()));
 
   auto response = validateAndExecute();
   auto cast_resp = std::static_pointer_cast<TransactionsResponse>(response);
@@ -0,0 +1,172 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <set>
+
+#include <gmock/gmock.h>
+
+#include "datetime/time.hpp"
+#include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/stateful_validator_impl.hpp"
+
+using namespace iroha;
+using namespace iroha::validation;
+using namespace iroha::ametsuchi;
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+/**
+ * Temporary wsv, where an account can transfer the coin only if it holds it.
+ * Created copies start from the same holders, as the ones made by storage
+ */
+class HoldersWsv : public TemporaryWsv {
+ public:
+  explicit HoldersWsv(std::set<std::string> holders)
+      : holders_(std::move(holders)) {
+    model::Account account;
+    account.quorum = 0;
+    ON_CALL(queries_, getAccount(_)).WillByDefault(Return(account));
+    ON_CALL(queries_, getSignatories(_))
+        .WillByDefault(Return(std::vector<pubkey_t>{}));
+  }
+
+  bool apply(const shared_model::interface::Transaction &tx,
+             std::function<bool(const shared_model::interface::Transaction &,
+                                WsvQuery &)> function) override {
+    if (not function(tx, queries_)) {
+      return false;
+    }
+    for (const auto &command : tx.commands()) {
+      auto transfer = boost::get<shared_model::detail::PolymorphicWrapper<
+          shared_model::interface::TransferAsset>>(&command->get());
+      if (transfer == nullptr
+          or holders_.erase((*transfer)->srcAccountId()) == 0) {
+        return false;
+      }
+      holders_.insert((*transfer)->destAccountId());
+    }
+    return true;
+  }
+
+ private:
+  std::set<std::string> holders_;
+  NiceMock<MockWsvQuery> queries_;
+};
+
+class StatefulValidatorTest : public ::testing::Test {
+ public:
+  void addTransfer(const std::string &src, const std::string &dest) {
+    transactions.push_back(TestTransactionBuilder()
+                               .creatorAccountId(src)
+                               .txCounter(transactions.size() + 1)
+                               .createdTime(iroha::time::now())
+                               .transferAsset(src, dest, "coin#test", "", "1.00")
+                               .build());
+  }
+
+  auto proposal() const {
+    return TestProposalBuilder()
+        .height(1)
+        .createdTime(iroha::time::now())
+        .transactions(transactions)
+        .build();
+  }
+
+  /**
+   * @return indexes in proposal of transactions left in validated proposal
+   */
+  std::vector<size_t> validIndexes(
+      const shared_model::interface::Proposal &validated) const {
+    std::vector<size_t> indexes;
+    for (const auto &tx : validated.transactions()) {
+      for (size_t i = 0; i < transactions.size(); ++i) {
+        if (transactions[i].hash() == tx->hash()) {
+          indexes.push_back(i);
+        }
+      }
+    }
+    return indexes;
+  }
+
+  /**
+   * Transfers a -> b, c -> d, a -> e, b -> a, d -> f, where a and c hold the
+   * coin. Transfers between a, b, e and between c, d, f are independent, and
+   * third transfer is invalid, because a has already sent the coin
+   */
+  void SetUp() override {
+    addTransfer("a@test", "b@test");
+    addTransfer("c@test", "d@test");
+    addTransfer("a@test", "e@test");
+    addTransfer("b@test", "a@test");
+    addTransfer("d@test", "f@test");
+  }
+
+  const std::set<std::string> holders{"a@test", "c@test"};
+  std::vector<shared_model::proto::Transaction> transactions;
+  StatefulValidatorImpl validator{2};
+};
+
+/**
+ * @given proposal with conflicting and independent transfers
+ * @when it is validated in parallel on created wsvs
+ * @then validated proposal is the same as of sequential validation
+ */
+TEST_F(StatefulValidatorTest, ParallelMatchesSequential) {
+  auto proposal = this->proposal();
+  HoldersWsv sequential_wsv(holders);
+  auto sequential = validator.validate(proposal, sequential_wsv);
+
+  HoldersWsv wsv(holders);
+  size_t created = 0;
+  auto parallel = validator.validate(
+      proposal,
+      wsv,
+      [&]() -> expected::Result<std::unique_ptr<TemporaryWsv>, std::string> {
+        ++created;
+        return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
+            std::make_unique<HoldersWsv>(holders));
+      });
+
+  EXPECT_EQ(1, created);
+  EXPECT_EQ(std::vector<size_t>({0, 1, 3, 4}), validIndexes(*sequential));
+  EXPECT_EQ(validIndexes(*sequential), validIndexes(*parallel));
+}
+
+/**
+ * @given proposal with conflicting and independent transfers
+ * @when temporary wsv for second batch cannot be created
+ * @then the batch is validated on given wsv and validated proposal is the
+ * same as of sequential validation
+ */
+TEST_F(StatefulValidatorTest, FallbackToGivenWsvMatchesSequential) {
+  auto proposal = this->proposal();
+  HoldersWsv sequential_wsv(holders);
+  auto sequential = validator.validate(proposal, sequential_wsv);
+
+  HoldersWsv wsv(holders);
+  auto parallel = validator.validate(
+      proposal,
+      wsv,
+      []() -> expected::Result<std::unique_ptr<TemporaryWsv>, std::string> {
+        return expected::makeError(std::string("no connection"));
+      });
+
+  EXPECT_EQ(validIndexes(*sequential), validIndexes(*parallel));
+}
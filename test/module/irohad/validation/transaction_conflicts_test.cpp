@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2018 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gmock/gmock.h>
+
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "validation/impl/transaction_conflicts.hpp"
+
+using namespace iroha::validation;
+using ::testing::ElementsAre;
+
+class TransactionConflictsTest : public ::testing::Test {
+ public:
+  /**
+   * Add transaction of given creator with commands set by the builder
+   */
+  void addTransaction(const TestTransactionBuilder &builder) {
+    transactions.emplace_back(
+        std::make_shared<shared_model::proto::Transaction>(builder.build()));
+  }
+
+  auto transaction(const std::string &creator) {
+    return TestTransactionBuilder()
+        .creatorAccountId(creator)
+        .txCounter(++tx_counter);
+  }
+
+  std::vector<shared_model::detail::PolymorphicWrapper<
+      shared_model::interface::Transaction>>
+      transactions;
+  uint64_t tx_counter = 0;
+};
+
+/**
+ * @given transfers between disjoint pairs of accounts of the same asset
+ * @when transactions are grouped
+ * @then each transfer forms its own group, because asset is only read
+ */
+TEST_F(TransactionConflictsTest, IndependentTransfersAreSeparated) {
+  addTransaction(transaction("a@test").transferAsset(
+      "a@test", "b@test", "coin#test", "", "1.00"));
+  addTransaction(transaction("c@test").transferAsset(
+      "c@test", "d@test", "coin#test", "", "1.00"));
+
+  auto groups = independentGroups(transactions);
+
+  ASSERT_EQ(2, groups.size());
+  EXPECT_THAT(groups[0], ElementsAre(0));
+  EXPECT_THAT(groups[1], ElementsAre(1));
+}
+
+/**
+ * @given chain of transfers a -> b, c -> d, b -> c
+ * @when transactions are grouped
+ * @then all of them form a single group in proposal order
+ */
+TEST_F(TransactionConflictsTest, SharedAccountJoinsGroups) {
+  addTransaction(transaction("a@test").transferAsset(
+      "a@test", "b@test", "coin#test", "", "1.00"));
+  addTransaction(transaction("c@test").transferAsset(
+      "c@test", "d@test", "coin#test", "", "1.00"));
+  addTransaction(transaction("b@test").transferAsset(
+      "b@test", "c@test", "coin#test", "", "1.00"));
+
+  auto groups = independentGroups(transactions);
+
+  ASSERT_EQ(1, groups.size());
+  EXPECT_THAT(groups[0], ElementsAre(0, 1, 2));
+}
+
+/**
+ * @given creation of an asset and transfers of it, and unrelated transfer
+ * @when transactions are grouped
+ * @then creation and transfers of the asset form one group
+ */
+TEST_F(TransactionConflictsTest, DefinitionChangeJoinsReaders) {
+  addTransaction(transaction("admin@test").createAsset("coin", "test", 2));
+  addTransaction(transaction("e@test").transferAsset(
+      "e@test", "f@test", "bill#test", "", "1.00"));
+  addTransaction(transaction("a@test").transferAsset(
+      "a@test", "b@test", "coin#test", "", "1.00"));
+  addTransaction(transaction("c@test").transferAsset(
+      "c@test", "d@test", "coin#test", "", "1.00"));
+
+  auto groups = independentGroups(transactions);
+
+  ASSERT_EQ(2, groups.size());
+  EXPECT_THAT(groups[0], ElementsAre(0, 2, 3));
+  EXPECT_THAT(groups[1], ElementsAre(1));
+}
@@ -34,6 +34,8 @@ namespace iroha {
 
     class MockStatefulValidator : public validation::StatefulValidator {
      public:
+      using StatefulValidator::validate;
+
       MOCK_METHOD2(validate,
                    std::shared_ptr<shared_model::interface::Proposal>(
                        const shared_model::interface::Proposal &,
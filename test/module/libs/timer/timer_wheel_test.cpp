@@ -0,0 +1,177 @@
+/**
+ * Copyright Soramitsu Co., Ltd. 2017 All Rights Reserved.
+ * http://soramitsu.co.jp
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+
+#include "timer/timer_wheel.hpp"
+
+using namespace iroha::timer;
+using namespace std::chrono_literals;
+
+class TimerWheelTest : public ::testing::Test {
+ public:
+  /**
+   * Wait until predicate is satisfied or timeout is reached
+   */
+  template <typename Predicate>
+  bool waitFor(Predicate &&predicate) {
+    std::unique_lock<std::mutex> lock(mutex);
+    return cv.wait_for(lock, 5s, std::forward<Predicate>(predicate));
+  }
+
+  void notify() {
+    std::lock_guard<std::mutex> lock(mutex);
+    cv.notify_all();
+  }
+
+  TimerWheel wheel{500us, 16};
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
+/**
+ * @given timer wheel
+ * @when timer is scheduled
+ * @then handler is invoked not earlier than after the delay
+ */
+TEST_F(TimerWheelTest, HandlerIsInvokedAfterDelay) {
+  auto start = TimerWheel::Clock::now();
+  std::atomic<bool> invoked{false};
+  TimerWheel::Clock::time_point invoked_at;
+
+  wheel.schedule(20ms, [&] {
+    invoked_at = TimerWheel::Clock::now();
+    invoked = true;
+    notify();
+  });
+
+  ASSERT_TRUE(waitFor([&] { return invoked.load(); }));
+  ASSERT_GE(invoked_at - start, 20ms);
+  ASSERT_EQ(0, wheel.pending());
+}
+
+/**
+ * @given timer wheel with pending timer
+ * @when timer is cancelled
+ * @then handler is not invoked, while other timers are
+ */
+TEST_F(TimerWheelTest, CancelledHandlerIsNotInvoked) {
+  std::atomic<bool> cancelled_invoked{false};
+  std::atomic<bool> invoked{false};
+
+  auto id = wheel.schedule(5ms, [&] { cancelled_invoked = true; });
+  wheel.schedule(10ms, [&] {
+    invoked = true;
+    notify();
+  });
+
+  ASSERT_TRUE(wheel.cancel(id));
+  ASSERT_FALSE(wheel.cancel(id));
+  ASSERT_TRUE(waitFor([&] { return invoked.load(); }));
+  ASSERT_FALSE(cancelled_invoked);
+}
+
+/**
+ * @given timer wheel with few slots
+ * @when timers are scheduled for delays longer than a wheel revolution
+ * @then every handler is invoked once
+ */
+TEST_F(TimerWheelTest, TimersBeyondRevolutionAreInvoked) {
+  const size_t timers = 100;
+  std::atomic<size_t> invoked{0};
+
+  for (size_t i = 0; i < timers; ++i) {
+    wheel.schedule(std::chrono::milliseconds(i % 30), [&] {
+      ++invoked;
+      notify();
+    });
+  }
+
+  ASSERT_TRUE(waitFor([&] { return invoked == timers; }));
+  ASSERT_EQ(0, wheel.pending());
+}
+
+/**
+ * @given timer wheel sleeping until a timer far beyond a wheel revolution
+ * @when earlier timer is scheduled
+ * @then earlier handler is invoked without waiting for the later one
+ */
+TEST_F(TimerWheelTest, EarlierTimerInterruptsSleep) {
+  std::atomic<bool> invoked{false};
+  auto later = wheel.schedule(10s, [] {});
+  // let the wheel fall asleep until the later deadline
+  std::this_thread::sleep_for(5ms);
+
+  auto start = TimerWheel::Clock::now();
+  wheel.schedule(10ms, [&] {
+    invoked = true;
+    notify();
+  });
+
+  ASSERT_TRUE(waitFor([&] { return invoked.load(); }));
+  ASSERT_LT(TimerWheel::Clock::now() - start, 1s);
+  ASSERT_TRUE(wheel.cancel(later));
+}
+
+/**
+ * @given timer wheel invoking a long handler
+ * @when the timer is cancelled from another thread
+ * @then cancel returns after the handler is finished
+ */
+TEST_F(TimerWheelTest, CancelWaitsForRunningHandler) {
+  std::atomic<bool> started{false};
+  std::atomic<bool> finished{false};
+
+  auto id = wheel.schedule(1ms, [&] {
+    started = true;
+    notify();
+    std::this_thread::sleep_for(50ms);
+    finished = true;
+  });
+
+  ASSERT_TRUE(waitFor([&] { return started.load(); }));
+  ASSERT_FALSE(wheel.cancel(id));
+  ASSERT_TRUE(finished);
+}
+
+/**
+ * @given timer wheel
+ * @when handler cancels its own timer and schedules another one
+ * @then cancel does not wait for the handler, and the other timer is invoked
+ */
+TEST_F(TimerWheelTest, HandlerCancelsItsTimer) {
+  std::atomic<bool> invoked{false};
+  TimerWheel::TimerId id = 0;
+  std::mutex id_mutex;
+
+  {
+    std::lock_guard<std::mutex> lock(id_mutex);
+    id = wheel.schedule(1ms, [&] {
+      std::lock_guard<std::mutex> lock(id_mutex);
+      wheel.cancel(id);
+      wheel.schedule(1ms, [&] {
+        invoked = true;
+        notify();
+      });
+    });
+  }
+
+  ASSERT_TRUE(waitFor([&] { return invoked.load(); }));
+}
@@ -46,3 +46,28 @@ TEST_F(CryptoInitialization, RawSignAndVerifyTest) {
       CryptoVerifier<>::verify(signed_blob, *data, keypair->publicKey());
   ASSERT_TRUE(verified);
 }
+
+/**
+ * @given signatures of the same data by several keypairs, one of which signed
+ * different data
+ * @when signatures are verified in a batch
+ * @then only signature of different data is invalid
+ */
+TEST_F(CryptoInitialization, BatchVerifyTest) {
+  const size_t signatures_number = 5, invalid_index = 2;
+  std::vector<std::pair<Signed, PublicKey>> signatures;
+  for (size_t i = 0; i < signatures_number; ++i) {
+    auto signatory = CryptoProviderEd25519Sha3::generateKeypair();
+    auto signed_blob = i == invalid_index
+        ? CryptoSigner<>::sign(Blob("other data"), signatory)
+        : CryptoSigner<>::sign(*data, signatory);
+    signatures.emplace_back(signed_blob, signatory.publicKey());
+  }
+
+  auto verified = CryptoVerifier<>::verify(signatures, *data);
+
+  ASSERT_EQ(signatures_number, verified.size());
+  for (size_t i = 0; i < signatures_number; ++i) {
+    ASSERT_EQ(i != invalid_index, verified[i]) << "signature " << i;
+  }
+}